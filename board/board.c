@@ -10,6 +10,9 @@
 #include "clock_config.h"
 #include "board.h"
 #include "fsl_debug_console.h"
+#include "fsl_power.h"
+#include "clock_pll_table.h"
+#include "fsl_vfifo.h"
 
 /*******************************************************************************
  * Variables
@@ -18,6 +21,18 @@
 /* Clock rate on the CLKIN pin */
 const uint32_t ExtClockIn = BOARD_EXTCLKINRATE;
 
+/* Names printed by BOARD_PrintClockTree(), in the order of clock_name_t, clock_tree_source_t and the violations */
+static const char *const s_clockName[CLOCK_NAME_COUNT] = {
+    "MainClk", "CoreSysClk", "BusClk", "Irc", "ExtClk", "PllOut", "WdtOsc", "FRG", "AsyncApbClk", "Adc", "ClockOut",
+};
+static const char *const s_clockSourceName[] = {
+    "-", "Irc", "ExtClk", "WdtOsc", "Osc32k", "PllIn", "PllOut", "MainClk", "AsyncApbClk",
+};
+static const char *const s_clockViolationName[] = {
+    "core clock stopped", "clock too high", "flash too fast", "PLL not locked", "PLL input too low",
+    "source stopped", "async APB stopped", "FRG DIV invalid",
+};
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -44,3 +59,107 @@ status_t BOARD_InitDebugConsole_Core1(void)
     assert(kStatus_Success == result);
     return result;
 }
+
+/* Share the system FIFO out by the throughput of the peripherals of the board, only the debug console is used. */
+status_t BOARD_InitSystemFifo(void)
+{
+    vfifo_profile_t profile[VFIFO_INSTANCE_COUNT] = {{0U}};
+    vfifo_partition_t partition;
+    status_t result;
+
+    /* A character is 10 bits on the line. */
+    profile[kVFIFO_Usart0 + BOARD_DEBUG_UART_INSTANCE].rxRate = BOARD_DEBUG_UART_BAUDRATE / 10U;
+    profile[kVFIFO_Usart0 + BOARD_DEBUG_UART_INSTANCE].txRate = BOARD_DEBUG_UART_BAUDRATE / 10U;
+    result = VFIFO_CalculatePartition(profile, &partition);
+    if (kStatus_Success == result)
+    {
+        result = VFIFO_ApplyPartition(&partition);
+    }
+    assert(kStatus_Success == result);
+    return result;
+}
+
+/* Enter deep sleep, the main clock is switched to the IRC while the PLL is powered down. */
+void BOARD_EnterDeepSleep(void)
+{
+    uint32_t mainClkSelA = SYSCON->MAINCLKSELA;
+    uint32_t mainClkSelB = SYSCON->MAINCLKSELB;
+
+    CLOCK_AttachClk(kIRC12M_to_MAIN_CLK);
+    POWER_EnterDeepSleep(BOARD_DEEP_SLEEP_EXCLUDE_FROM_PD);
+
+    if (SYSCON_MAINCLKSELB_SEL(2U) == (mainClkSelB & SYSCON_MAINCLKSELB_SEL_MASK))
+    {
+        while (!CLOCK_IsSystemPLLLocked())
+        {
+        }
+    }
+    SYSCON->MAINCLKSELA = mainClkSelA;
+    SYSCON->MAINCLKSELB = mainClkSelB;
+}
+
+/* Start the 150 MHz PLL from the IRC without waiting for the lock, the core keeps running from the IRC. */
+void BOARD_BootClockPLL150MStart(void)
+{
+    pll_setup_t pllSetup = g_clockPllSetupTable[kCLOCK_PllSetup12MTo150M].setup;
+
+    POWER_DisablePD(kPDRUNCFG_PD_IRC_OSC);
+    POWER_DisablePD(kPDRUNCFG_PD_IRC);
+    CLOCK_AttachClk(kIRC12M_to_MAIN_CLK);
+
+    CLOCK_AttachClk(kIRC12M_to_SYS_PLL);
+    pllSetup.flags = PLL_SETUPFLAG_POWERUP;
+    (void)CLOCK_SetPLLFreq(&pllSetup);
+
+    /* Same dividers as BOARD_BootClockPLL150M(). */
+    CLOCK_SetClkDiv(kCLOCK_DivAhbClk, 1U, false);
+    SYSCON->ASYNCAPBCTRL = SYSCON_ASYNCAPBCTRL_ENABLE_MASK;
+    Clock_SetAsyncClkDiv(1U);
+    ASYNC_SYSCON->FRGCTRL = (ASYNC_SYSCON->FRGCTRL & ~ASYNC_SYSCON_FRGCTRL_MULT_MASK) | ASYNC_SYSCON_FRGCTRL_MULT(0U);
+    ASYNC_SYSCON->ASYNCAPBCLKCTRL |= ASYNC_SYSCON_ASYNCAPBCLKCTRL_FRG0_MASK;
+}
+
+/* Switch the core to the PLL started by BOARD_BootClockPLL150MStart() once it locks, it does not wait. */
+bool BOARD_BootClockPLL150MSwitch(void)
+{
+    if (SYSCON_MAINCLKSELB_SEL(2U) == (SYSCON->MAINCLKSELB & SYSCON_MAINCLKSELB_SEL_MASK))
+    {
+        return true;
+    }
+    if (!CLOCK_IsSystemPLLLocked())
+    {
+        return false;
+    }
+
+    POWER_SetVoltageForFreq(BOARD_BOOTCLOCKPLL150M_CORE_CLOCK);
+    CLOCK_SetFLASHAccessCyclesForFreq(BOARD_BOOTCLOCKPLL150M_CORE_CLOCK);
+    CLOCK_AttachClk(kSYS_PLL_OUT_to_MAIN_CLK);
+
+    return true;
+}
+
+/* Print the active clock tree and the out of spec combinations found in it. */
+uint32_t BOARD_PrintClockTree(void)
+{
+    clock_tree_info_t info;
+    uint32_t violations = CLOCK_GetClockTreeInfo(&info);
+    uint32_t i;
+
+    (void)PRINTF("Clock tree:\r\n");
+    for (i = 0U; i < CLOCK_NAME_COUNT; i++)
+    {
+        (void)PRINTF("  %-12s %10u Hz  from %-12s div %u\r\n", s_clockName[i], info.clock[i].freq,
+                     s_clockSourceName[info.clock[i].source], info.clock[i].divider);
+    }
+    (void)PRINTF("  FLASH %u cycles, %u required\r\n", (uint32_t)info.flashCycles + 1U,
+                 (uint32_t)info.flashCyclesRequired + 1U);
+    for (i = 0U; i < ARRAY_SIZE(s_clockViolationName); i++)
+    {
+        if ((violations & (1UL << i)) != 0U)
+        {
+            (void)PRINTF("  Violation: %s\r\n", s_clockViolationName[i]);
+        }
+    }
+
+    return violations;
+}
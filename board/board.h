@@ -24,14 +24,19 @@
 #define BOARD_DEBUG_UART_TYPE kSerialPort_Uart
 #define BOARD_DEBUG_UART_BASEADDR (uint32_t) USART0
 #define BOARD_DEBUG_UART_INSTANCE 0U
+#if (defined(HAL_UART_FRACTIONAL_BAUDRATE) && (HAL_UART_FRACTIONAL_BAUDRATE > 0U))
+/* The UART adapter programs the FRG, so it is given the clock feeding the FRG. */
+#define BOARD_DEBUG_UART_CLK_FREQ CLOCK_GetAsyncApbClkFreq()
+#else
 #define BOARD_DEBUG_UART_CLK_FREQ CLOCK_GetUsartClkFreq()
+#endif
 #define BOARD_DEBUG_UART_CLK_ATTACH kIRC12M_to_USART
 #define BOARD_DEBUG_UART_RST kUSART0_RST_SHIFT_RSTn
 
 #define BOARD_DEBUG_UART_TYPE_CORE1 kSerialPort_Uart
 #define BOARD_DEBUG_UART_BASEADDR_CORE1 (uint32_t) USART2
 #define BOARD_DEBUG_UART_INSTANCE_CORE1 2U
-#define BOARD_DEBUG_UART_CLK_FREQ_CORE1 CLOCK_GetUsartClkFreq()
+#define BOARD_DEBUG_UART_CLK_FREQ_CORE1 BOARD_DEBUG_UART_CLK_FREQ
 #define BOARD_DEBUG_UART_CLK_ATTACH_CORE1 kIRC12M_to_USART
 #define BOARD_DEBUG_UART_RST_CORE1 kUSART2_RST_SHIFT_RSTn
 
@@ -45,6 +50,26 @@
 #define BOARD_DEBUG_UART_BAUDRATE_CORE1 115200
 #endif /* BOARD_DEBUG_UART_BAUDRATE_CORE1 */
 
+/* Blocks kept powered in deep sleep: the IRC clocks the debug USART so that the wake up character is received, the
+ * SRAM is retained, and the RTC oscillator runs the wake-up timer of the idle module. */
+#ifndef BOARD_DEEP_SLEEP_EXCLUDE_FROM_PD
+#define BOARD_DEEP_SLEEP_EXCLUDE_FROM_PD                                                                    \
+    (SYSCON_PDRUNCFG_PDEN_IRC_OSC_MASK | SYSCON_PDRUNCFG_PDEN_IRC_MASK | SYSCON_PDRUNCFG_PDEN_SRAM0A_MASK | \
+     SYSCON_PDRUNCFG_PDEN_SRAM0B_MASK | SYSCON_PDRUNCFG_PDEN_SRAM1_MASK | SYSCON_PDRUNCFG_PDEN_SRAM2_MASK | \
+     SYSCON_PDRUNCFG_PDEN_32K_OSC_MASK)
+#endif /* BOARD_DEEP_SLEEP_EXCLUDE_FROM_PD */
+
+/*! @brief Whether the application boots from the IRC and switches to the 150 MHz PLL once it locks (1 - enable, 0 -
+ * disable).
+ *
+ * BOARD_BootClockPLL150MStart() starts the PLL without waiting for the lock, and BOARD_BootClockPLL150MSwitch() is
+ * polled once the early initialization ran from the IRC. The hello_world application polls it from its main loop, so
+ * the system FIFO, the debug console and the work that does not need 150 MHz overlap the PLL lock.
+ */
+#ifndef BOARD_FAST_BOOT
+#define BOARD_FAST_BOOT (0U)
+#endif /* BOARD_FAST_BOOT */
+
 #ifndef BOARD_LED_RED_GPIO
 #define BOARD_LED_RED_GPIO GPIO
 #endif
@@ -147,6 +172,11 @@ extern "C" {
 
 status_t BOARD_InitDebugConsole(void);
 status_t BOARD_InitDebugConsole_Core1(void);
+status_t BOARD_InitSystemFifo(void);
+void BOARD_EnterDeepSleep(void);
+void BOARD_BootClockPLL150MStart(void);
+bool BOARD_BootClockPLL150MSwitch(void);
+uint32_t BOARD_PrintClockTree(void);
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -0,0 +1,56 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Generated by tools/pll_table_gen.py, do not edit. Command line:
+ *   pll_table_gen.py 12000000:48000000 12000000:96000000 12000000:150000000
+ */
+
+#include "clock_pll_table.h"
+
+const pll_setup_entry_t g_clockPllSetupTable[kCLOCK_PllSetupCount] = {
+    /* kCLOCK_PllSetup12MTo48M: 12000000 Hz to 48000000 Hz, integer mode, M = 8, N = 1, P = 1 */
+    [kCLOCK_PllSetup12MTo48M] =
+        {
+            .inputRate = 12000000U,
+            .setup =
+                {
+                    .syspllctrl   = 0x000D14C0U,
+                    .syspllndec   = 0x302U,
+                    .syspllpdec   = 0x62U,
+                    .syspllssctrl = {0x0004003FU, 0x10000000U},
+                    .pllRate      = 48000000U,
+                    .flags        = PLL_SETUPFLAG_WAITLOCK,
+                },
+        },
+    /* kCLOCK_PllSetup12MTo96M: 12000000 Hz to 96000000 Hz, integer mode, M = 8, N = 1, P = 0 */
+    [kCLOCK_PllSetup12MTo96M] =
+        {
+            .inputRate = 12000000U,
+            .setup =
+                {
+                    .syspllctrl   = 0x001D14C0U,
+                    .syspllndec   = 0x302U,
+                    .syspllpdec   = 0x7FU,
+                    .syspllssctrl = {0x0004003FU, 0x10000000U},
+                    .pllRate      = 96000000U,
+                    .flags        = PLL_SETUPFLAG_WAITLOCK,
+                },
+        },
+    /* kCLOCK_PllSetup12MTo150M: 12000000 Hz to 150000000 Hz, integer mode, M = 25, N = 2, P = 0 */
+    [kCLOCK_PllSetup12MTo150M] =
+        {
+            .inputRate = 12000000U,
+            .setup =
+                {
+                    .syspllctrl   = 0x001535C0U,
+                    .syspllndec   = 0x202U,
+                    .syspllpdec   = 0x7FU,
+                    .syspllssctrl = {0x00047F55U, 0x10000000U},
+                    .pllRate      = 150000000U,
+                    .flags        = PLL_SETUPFLAG_WAITLOCK,
+                },
+        },
+};
@@ -0,0 +1,28 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Generated by tools/pll_table_gen.py, do not edit. Command line:
+ *   pll_table_gen.py 12000000:48000000 12000000:96000000 12000000:150000000
+ */
+
+#ifndef _CLOCK_PLL_TABLE_H_
+#define _CLOCK_PLL_TABLE_H_
+
+#include "fsl_clock.h"
+
+/*! @brief Indexes of the precomputed System PLL setups of g_clockPllSetupTable */
+typedef enum _clock_pll_setup_index
+{
+    kCLOCK_PllSetup12MTo48M  = 0U, /*!< 12000000 Hz to 48000000 Hz */
+    kCLOCK_PllSetup12MTo96M  = 1U, /*!< 12000000 Hz to 96000000 Hz */
+    kCLOCK_PllSetup12MTo150M = 2U, /*!< 12000000 Hz to 150000000 Hz */
+    kCLOCK_PllSetupCount     = 3U, /*!< Number of setups */
+} clock_pll_setup_index_t;
+
+/*! @brief Precomputed System PLL setups, applied with CLOCK_SetPLLFreqFromTable() */
+extern const pll_setup_entry_t g_clockPllSetupTable[kCLOCK_PllSetupCount];
+
+#endif /* _CLOCK_PLL_TABLE_H_ */
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_common.h"
+#include "fsl_clock.h"
+#include "fsl_debug_console.h"
+
+#include "boot_profile.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* The boot profile state structure */
+typedef struct _boot_profile_state
+{
+    uint32_t marked;                              /*!< the stages marked, one bit per stage */
+    uint32_t coreClock;                           /*!< the core clock the cycles are counted at */
+    uint32_t baseCycles;                          /*!< the cycle count at the last change of the core clock */
+    uint64_t baseTime;                            /*!< the time at the last change of the core clock, in ns */
+    uint32_t cycles[kBOOT_PROFILE_StageCount];    /*!< the cycle count at the end of each stage */
+    uint32_t timestamp[kBOOT_PROFILE_StageCount]; /*!< the time at the end of each stage, in microseconds */
+} boot_profile_state_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* The state is written before the startup copies .data and clears .bss, it is kept in the .noinit section. */
+static boot_profile_state_t s_bootProfile __attribute__((section(".noinit")));
+static clock_notify_handle_t s_bootProfileClockNotify;
+
+static const char *const s_bootProfileStageName[kBOOT_PROFILE_StageCount] = {
+    "SystemInit", ".data copy", ".bss clear", "main entry", "clock init", "console init", "clock switch",
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint64_t BOOT_PROFILE_GetTime(uint32_t cycles)
+{
+    return s_bootProfile.baseTime +
+           (((uint64_t)(cycles - s_bootProfile.baseCycles) * 1000000000U) / s_bootProfile.coreClock);
+}
+
+static void BOOT_PROFILE_CoreClockChanged(clock_notify_handle_t *handle, uint32_t changedMask)
+{
+    uint32_t cycles = DWT->CYCCNT;
+
+    /* The cycles counted so far are converted at the former core clock. */
+    s_bootProfile.baseTime   = BOOT_PROFILE_GetTime(cycles);
+    s_bootProfile.baseCycles = cycles;
+    s_bootProfile.coreClock  = CLOCK_GetCoreClkFreq();
+}
+
+void BOOT_PROFILE_Start(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    s_bootProfile.marked     = 0U;
+    s_bootProfile.coreClock  = CLK_IRC_12MHZ;
+    s_bootProfile.baseCycles = 0U;
+    s_bootProfile.baseTime   = 0U;
+}
+
+void BOOT_PROFILE_Mark(boot_profile_stage_t stage)
+{
+    uint32_t cycles = DWT->CYCCNT;
+    uint32_t regPrimask;
+
+    assert(stage < kBOOT_PROFILE_StageCount);
+
+    regPrimask                     = DisableGlobalIRQ();
+    s_bootProfile.cycles[stage]    = cycles;
+    s_bootProfile.timestamp[stage] = (uint32_t)(BOOT_PROFILE_GetTime(cycles) / 1000U);
+    s_bootProfile.marked |= (1UL << (uint32_t)stage);
+    EnableGlobalIRQ(regPrimask);
+
+    /* The clock driver state is only valid once the C runtime is initialized. */
+    if (kBOOT_PROFILE_Main == stage)
+    {
+        s_bootProfileClockNotify.clockMask = CLOCK_NOTIFY_MASK(kCLOCK_CoreSysClk);
+        s_bootProfileClockNotify.callback  = BOOT_PROFILE_CoreClockChanged;
+        s_bootProfileClockNotify.userData  = NULL;
+        CLOCK_RegisterNotify(&s_bootProfileClockNotify);
+    }
+}
+
+uint32_t BOOT_PROFILE_GetTimestamp(boot_profile_stage_t stage)
+{
+    assert(stage < kBOOT_PROFILE_StageCount);
+
+    return (0U != (s_bootProfile.marked & (1UL << (uint32_t)stage))) ? s_bootProfile.timestamp[stage] : 0U;
+}
+
+void BOOT_PROFILE_Report(void)
+{
+    uint32_t lastCycles    = 0U;
+    uint32_t lastTimestamp = 0U;
+
+    (void)PRINTF("Boot profile:\r\n");
+    for (uint32_t i = 0U; i < (uint32_t)kBOOT_PROFILE_StageCount; i++)
+    {
+        if (0U == (s_bootProfile.marked & (1UL << i)))
+        {
+            continue;
+        }
+        (void)PRINTF("  %-14s %8u us %10u cycles\r\n", s_bootProfileStageName[i],
+                     s_bootProfile.timestamp[i] - lastTimestamp, s_bootProfile.cycles[i] - lastCycles);
+        lastCycles    = s_bootProfile.cycles[i];
+        lastTimestamp = s_bootProfile.timestamp[i];
+    }
+    (void)PRINTF("  %-14s %8u us\r\n", "total", lastTimestamp);
+}
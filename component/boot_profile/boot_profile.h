@@ -0,0 +1,93 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __BOOT_PROFILE_H__
+#define __BOOT_PROFILE_H__
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup boot_profile
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Whether the boot stages are timestamped (1 - enable, 0 - disable).
+ *
+ * It should be defined for the assembler as well, the startup file marks the stages run before main. The
+ * BOOT_PROFILE_ENABLE option of CMakeLists.txt defines it for both.
+ */
+#ifndef BOOT_PROFILE_ENABLE
+#define BOOT_PROFILE_ENABLE (0U)
+#endif
+
+/*! @brief The boot stages, each one is marked once it ends.
+ *
+ * The stages up to #kBOOT_PROFILE_BssClear are marked by the startup file, which uses their values.
+ */
+typedef enum _boot_profile_stage
+{
+    kBOOT_PROFILE_SystemInit  = 0U, /*!< SystemInit */
+    kBOOT_PROFILE_DataCopy    = 1U, /*!< Copy of .data from the flash */
+    kBOOT_PROFILE_BssClear    = 2U, /*!< Clear of .bss */
+    kBOOT_PROFILE_Main        = 3U, /*!< C library initialization up to main */
+    kBOOT_PROFILE_ClockInit   = 4U, /*!< Clock configuration */
+    kBOOT_PROFILE_ConsoleInit = 5U, /*!< Debug console initialization */
+    kBOOT_PROFILE_ClockSwitch = 6U, /*!< Initialization from the IRC up to the switch to the PLL, in the fast boot */
+    kBOOT_PROFILE_StageCount  = 7U, /*!< Number of stages */
+} boot_profile_stage_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* _cplusplus */
+
+/*!
+ * @brief Starts the boot profile, it is called by the startup file before SystemInit.
+ *
+ * The DWT cycle counter is enabled and cleared. The profile is kept in the .noinit section, which is neither copied
+ * nor cleared by the startup, so that it can be written before the C runtime is initialized. The core is assumed to
+ * run from the 12 MHz IRC, as it does out of reset.
+ */
+void BOOT_PROFILE_Start(void);
+
+/*!
+ * @brief Marks the end of a boot stage.
+ *
+ * The stage starts at the end of the last stage marked. The cycles are converted to time at the core clock they
+ * are counted at, the changes of the core clock are notified by the clock driver once main is marked. The DWT
+ * cycle counter wraps after 2^32 cycles, about 28 seconds at 150 MHz, so a stage should be shorter than that.
+ *
+ * @param stage The stage ended.
+ */
+void BOOT_PROFILE_Mark(boot_profile_stage_t stage);
+
+/*!
+ * @brief Gets the time from the start of the profile to the end of a boot stage.
+ *
+ * @param stage The stage.
+ * @retval The time in microseconds, 0 if the stage is not marked.
+ */
+uint32_t BOOT_PROFILE_GetTimestamp(boot_profile_stage_t stage);
+
+/*!
+ * @brief Prints the time and the cycles taken by each stage marked, it should be called once the debug console is
+ * initialized.
+ */
+void BOOT_PROFILE_Report(void);
+
+#if defined(__cplusplus)
+}
+#endif
+/*! @}*/
+#endif /* __BOOT_PROFILE_H__ */
@@ -0,0 +1,218 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_common.h"
+#include <string.h>
+
+#include "debounce.h"
+#if (defined(DEBOUNCE_TIMER_MANAGER_ENABLE) && (DEBOUNCE_TIMER_MANAGER_ENABLE > 0U))
+#include "timer_manager.h"
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#if ((DEBOUNCE_EVENT_QUEUE_SIZE == 0U) || ((DEBOUNCE_EVENT_QUEUE_SIZE & (DEBOUNCE_EVENT_QUEUE_SIZE - 1U)) != 0U))
+#error DEBOUNCE_EVENT_QUEUE_SIZE should be a power of 2.
+#endif
+
+#define DEBOUNCE_EVENT_QUEUE_MASK (DEBOUNCE_EVENT_QUEUE_SIZE - 1U)
+
+/* The vertical counter of a port, bit n of the counter planes is the count of the pin n. */
+typedef struct _debounce_port
+{
+    uint32_t mask;   /*!< the monitored pins */
+    uint32_t levels; /*!< the stable levels */
+    uint32_t count0; /*!< bit 0 of the counters */
+    uint32_t count1; /*!< bit 1 of the counters */
+} debounce_port_t;
+
+/* The debounce state structure */
+typedef struct _debounce_state
+{
+    debounce_port_t port[DEBOUNCE_PORT_COUNT];
+    debounce_event_t events[DEBOUNCE_EVENT_QUEUE_SIZE]; /*!< the event queue, written by the sampling only */
+    volatile uint32_t head;                             /*!< the count of queued events, advanced by the sampling */
+    volatile uint32_t tail;                             /*!< the count of read events, advanced by the reader */
+    uint32_t dropped;
+    uint32_t sample;
+    GPIO_Type *base;
+    debounce_callback_t callback;
+    void *callbackParam;
+#if (defined(DEBOUNCE_TIMER_MANAGER_ENABLE) && (DEBOUNCE_TIMER_MANAGER_ENABLE > 0U))
+    uint32_t timerHandle[(TIMER_HANDLE_SIZE + sizeof(uint32_t) - 1U) / sizeof(uint32_t)];
+#endif
+} debounce_state_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static debounce_state_t s_debounce;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+#if (defined(DEBOUNCE_TIMER_MANAGER_ENABLE) && (DEBOUNCE_TIMER_MANAGER_ENABLE > 0U))
+static void DEBOUNCE_TimerCallback(void *param)
+{
+    DEBOUNCE_Sample();
+}
+#endif
+
+status_t DEBOUNCE_Init(const debounce_config_t *config)
+{
+    assert(config);
+    assert(config->base);
+
+    DEBOUNCE_Deinit();
+
+    s_debounce.base = config->base;
+    for (uint32_t i = 0U; i < DEBOUNCE_PORT_COUNT; i++)
+    {
+        s_debounce.port[i].mask = config->pinMask[i];
+        if (0U != config->pinMask[i])
+        {
+            s_debounce.port[i].levels = GPIO_PortRead(config->base, i) & config->pinMask[i];
+        }
+    }
+
+#if (defined(DEBOUNCE_TIMER_MANAGER_ENABLE) && (DEBOUNCE_TIMER_MANAGER_ENABLE > 0U))
+    (void)TM_Open((timer_handle_t)s_debounce.timerHandle);
+    (void)TM_InstallCallback((timer_handle_t)s_debounce.timerHandle, DEBOUNCE_TimerCallback, NULL);
+    if (kStatus_TimerSuccess !=
+        TM_Start((timer_handle_t)s_debounce.timerHandle, (uint8_t)kTimerModeIntervalTimer, config->samplePeriod))
+    {
+        DEBOUNCE_Deinit();
+        return kStatus_OutOfRange;
+    }
+#endif
+
+    return kStatus_Success;
+}
+
+void DEBOUNCE_Deinit(void)
+{
+    uint32_t regPrimask;
+
+#if (defined(DEBOUNCE_TIMER_MANAGER_ENABLE) && (DEBOUNCE_TIMER_MANAGER_ENABLE > 0U))
+    if (NULL != s_debounce.base)
+    {
+        (void)TM_Close((timer_handle_t)s_debounce.timerHandle);
+    }
+#endif
+    regPrimask = DisableGlobalIRQ();
+    (void)memset(&s_debounce, 0, sizeof(s_debounce));
+    EnableGlobalIRQ(regPrimask);
+}
+
+void DEBOUNCE_InstallCallback(debounce_callback_t callback, void *callbackParam)
+{
+    uint32_t regPrimask;
+
+    regPrimask               = DisableGlobalIRQ();
+    s_debounce.callback      = callback;
+    s_debounce.callbackParam = callbackParam;
+    EnableGlobalIRQ(regPrimask);
+}
+
+void DEBOUNCE_Sample(void)
+{
+    debounce_port_t *port;
+    debounce_event_t *event;
+    uint32_t delta;
+    uint32_t changed;
+    bool queued = false;
+
+    if (NULL == s_debounce.base)
+    {
+        return;
+    }
+
+    s_debounce.sample++;
+    for (uint32_t i = 0U; i < DEBOUNCE_PORT_COUNT; i++)
+    {
+        port = &s_debounce.port[i];
+        if (0U == port->mask)
+        {
+            continue;
+        }
+
+        /*
+         * The counter of a pin differing from its stable level counts the samples up, modulo 4, and the counter of a
+         * pin at its stable level is cleared. A pin changes once its counter wraps to 0 while it still differs.
+         */
+        delta        = (GPIO_PortRead(s_debounce.base, i) ^ port->levels) & port->mask;
+        port->count1 = (port->count1 ^ port->count0) & delta;
+        port->count0 = ~port->count0 & delta;
+        changed      = delta & ~(port->count0 | port->count1);
+        if (0U == changed)
+        {
+            continue;
+        }
+        port->levels ^= changed;
+
+        if ((s_debounce.head - s_debounce.tail) >= DEBOUNCE_EVENT_QUEUE_SIZE)
+        {
+            s_debounce.dropped++;
+            continue;
+        }
+        event          = &s_debounce.events[s_debounce.head & DEBOUNCE_EVENT_QUEUE_MASK];
+        event->port    = i;
+        event->changed = changed;
+        event->levels  = port->levels;
+        event->sample  = s_debounce.sample;
+        s_debounce.head++;
+        queued = true;
+    }
+
+    if (queued && (NULL != s_debounce.callback))
+    {
+        s_debounce.callback(s_debounce.callbackParam);
+    }
+}
+
+bool DEBOUNCE_GetEvent(debounce_event_t *event)
+{
+    uint32_t tail = s_debounce.tail;
+
+    assert(event);
+
+    if (tail == s_debounce.head)
+    {
+        return false;
+    }
+    *event = s_debounce.events[tail & DEBOUNCE_EVENT_QUEUE_MASK];
+    /* The slot is released once it is copied, the sampling only reuses it after the tail moves on. */
+    s_debounce.tail = tail + 1U;
+
+    return true;
+}
+
+uint32_t DEBOUNCE_GetLevels(uint32_t port)
+{
+    assert(port < DEBOUNCE_PORT_COUNT);
+
+    return s_debounce.port[port].levels;
+}
+
+uint32_t DEBOUNCE_GetDroppedEvents(void)
+{
+    uint32_t dropped;
+    uint32_t regPrimask;
+
+    regPrimask         = DisableGlobalIRQ();
+    dropped            = s_debounce.dropped;
+    s_debounce.dropped = 0U;
+    EnableGlobalIRQ(regPrimask);
+
+    return dropped;
+}
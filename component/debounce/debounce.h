@@ -0,0 +1,139 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __DEBOUNCE_H__
+#define __DEBOUNCE_H__
+
+#include "fsl_common.h"
+#include "fsl_gpio.h"
+
+/*!
+ * @addtogroup debounce
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief The number of GPIO ports sampled by the debounce service */
+#ifndef DEBOUNCE_PORT_COUNT
+#define DEBOUNCE_PORT_COUNT (2U)
+#endif
+
+/*! @brief The number of events of the event queue, it should be a power of 2. */
+#ifndef DEBOUNCE_EVENT_QUEUE_SIZE
+#define DEBOUNCE_EVENT_QUEUE_SIZE (16U)
+#endif
+
+/*! @brief Whether the sampling is driven by an interval timer of the timer manager (1 - enable, 0 - disable).
+ *
+ * If it is disabled, DEBOUNCE_Sample should be called at a fixed rate from the interrupt of a hardware timer, such
+ * as MRT or UTICK.
+ */
+#ifndef DEBOUNCE_TIMER_MANAGER_ENABLE
+#define DEBOUNCE_TIMER_MANAGER_ENABLE (1U)
+#endif
+
+/*! @brief The number of consecutive samples a pin keeps a new level before the transition is reported, it is set
+ * by the 2-bit vertical counters. */
+#define DEBOUNCE_STABLE_SAMPLES (4U)
+
+/*! @brief The debounce event, the stable transitions of the pins of a port at one sample */
+typedef struct _debounce_event
+{
+    uint32_t port;    /*!< GPIO port of the pins */
+    uint32_t changed; /*!< Pins with a stable transition */
+    uint32_t levels;  /*!< Stable levels of the monitored pins of the port after the transition */
+    uint32_t sample;  /*!< Number of the sample the transition is detected at */
+} debounce_event_t;
+
+/*! @brief The debounce callback function, it is called in the context of the sampling once events are queued */
+typedef void (*debounce_callback_t)(void *param);
+
+/*! @brief The debounce config structure */
+typedef struct _debounce_config
+{
+    GPIO_Type *base;                       /*!< GPIO peripheral base pointer */
+    uint32_t pinMask[DEBOUNCE_PORT_COUNT]; /*!< Pins debounced on each port, 0 if the port is not sampled */
+    uint32_t samplePeriod;                 /*!< Sample period in milliseconds, only used with the timer manager */
+} debounce_config_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* _cplusplus */
+
+/*!
+ * @brief Initializes the debounce service.
+ *
+ * The current levels of the pins are taken as stable, so no event is reported for them. If
+ * #DEBOUNCE_TIMER_MANAGER_ENABLE is set, an interval timer of the timer manager is started to sample the pins, the
+ * timer manager should be initialized first. The pins should be configured as inputs.
+ *
+ * @param config Pointer to user-defined configuration structure.
+ * @retval kStatus_Success The debounce service is initialized.
+ * @retval kStatus_OutOfRange The sample period is not supported by the timer manager.
+ */
+status_t DEBOUNCE_Init(const debounce_config_t *config);
+
+/*!
+ * @brief Deinitializes the debounce service, the sampling is stopped and the queued events are dropped.
+ */
+void DEBOUNCE_Deinit(void);
+
+/*!
+ * @brief Installs the callback called once events are queued.
+ *
+ * @param callback The callback, NULL for no callback.
+ * @param callbackParam The parameter of the callback.
+ */
+void DEBOUNCE_InstallCallback(debounce_callback_t callback, void *callbackParam);
+
+/*!
+ * @brief Samples and debounces all the monitored pins.
+ *
+ * Each port is read once, and all its pins are debounced in parallel by bitwise vertical counters, so the time taken
+ * does not depend on the number of pins or on their bouncing. A pin is reported once it keeps a new level for
+ * #DEBOUNCE_STABLE_SAMPLES samples. It is called by the interval timer if #DEBOUNCE_TIMER_MANAGER_ENABLE is set.
+ */
+void DEBOUNCE_Sample(void);
+
+/*!
+ * @brief Gets the oldest queued event.
+ *
+ * @param event The event.
+ * @retval true An event is returned.
+ * @retval false The event queue is empty.
+ */
+bool DEBOUNCE_GetEvent(debounce_event_t *event);
+
+/*!
+ * @brief Gets the stable levels of the monitored pins of a port.
+ *
+ * The levels stay valid when events are dropped because the event queue is full.
+ *
+ * @param port GPIO port.
+ * @retval The stable levels of the monitored pins.
+ */
+uint32_t DEBOUNCE_GetLevels(uint32_t port);
+
+/*!
+ * @brief Gets and clears the number of events dropped because the event queue was full.
+ *
+ * @retval The number of events dropped.
+ */
+uint32_t DEBOUNCE_GetDroppedEvents(void);
+
+#if defined(__cplusplus)
+}
+#endif
+/*! @}*/
+#endif /* __DEBOUNCE_H__ */
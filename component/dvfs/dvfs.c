@@ -0,0 +1,334 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_common.h"
+#include "fsl_power.h"
+#include <string.h>
+
+#include "dvfs.h"
+#if (defined(DVFS_TIMER_MANAGER_ENABLE) && (DVFS_TIMER_MANAGER_ENABLE > 0U))
+#include "timer_manager.h"
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* The DVFS state structure */
+typedef struct _dvfs_state
+{
+    const dvfs_operating_point_t *points;
+    uint32_t pointCount;
+    volatile uint32_t current;         /*!< the operating point set */
+    volatile uint32_t pending;         /*!< the operating point selected by the governor */
+    const pll_setup_entry_t *pllSetup; /*!< the PLL setup locked, NULL while the PLL is powered down */
+    uint32_t samplePeriod;
+    uint8_t upThreshold;
+    uint8_t downThreshold;
+    volatile bool governor;
+    volatile bool idle;        /*!< the core is between DVFS_IdleEnter and DVFS_IdleExit */
+    bool windowRestarted;      /*!< the sample period was cut by a change of operating point */
+    uint32_t windowStart;      /*!< the cycle count at the start of the sample period */
+    uint32_t idleStart;        /*!< the cycle count at the idle entry */
+    uint32_t idleCycles;       /*!< the idle cycles counted in the sample period */
+    volatile uint32_t load;
+#if (defined(DVFS_TIMER_MANAGER_ENABLE) && (DVFS_TIMER_MANAGER_ENABLE > 0U))
+    uint32_t timerHandle[(TIMER_HANDLE_SIZE + sizeof(uint32_t) - 1U) / sizeof(uint32_t)];
+#endif
+} dvfs_state_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static dvfs_state_t s_dvfs;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+#if (defined(DVFS_TIMER_MANAGER_ENABLE) && (DVFS_TIMER_MANAGER_ENABLE > 0U))
+static void DVFS_TimerCallback(void *param)
+{
+    DVFS_Update();
+}
+#endif
+
+/* Whether the operating point needs the PLL to be set up and to lock, rather than a change of the divider. */
+static bool DVFS_NeedsPllLock(const dvfs_operating_point_t *point)
+{
+    return ((NULL != point->pllSetup) && ((point->pllSetup != s_dvfs.pllSetup) || (!CLOCK_IsSystemPLLLocked())));
+}
+
+static status_t DVFS_Switch(const dvfs_operating_point_t *point)
+{
+    uint32_t oldClock  = CLOCK_GetCoreClkFreq();
+    uint32_t setClock  = oldClock; /* the core clock the voltage and the flash wait states are set for */
+    uint32_t ahbClkDiv = (0U == point->ahbClkDiv) ? 1U : point->ahbClkDiv;
+    uint32_t newClock;
+    status_t status = kStatus_Success;
+
+    /* Up-shift, the voltage and the flash wait states are raised before the clock. */
+    if (point->coreClock_Hz > oldClock)
+    {
+        POWER_SetVoltageForFreq(point->coreClock_Hz);
+        CLOCK_SetFLASHAccessCyclesForFreq(point->coreClock_Hz);
+        setClock = point->coreClock_Hz;
+    }
+
+    if (NULL == point->pllSetup)
+    {
+        CLOCK_AttachClk(kIRC12M_to_MAIN_CLK);
+        CLOCK_SetClkDiv(kCLOCK_DivAhbClk, ahbClkDiv, false);
+        POWER_EnablePD(kPDRUNCFG_PD_SYS_PLL);
+        s_dvfs.pllSetup = NULL;
+    }
+    else if (!DVFS_NeedsPllLock(point))
+    {
+        /* The PLL keeps running, only the divider of the main clock changes. */
+        CLOCK_SetClkDiv(kCLOCK_DivAhbClk, ahbClkDiv, false);
+    }
+    else
+    {
+        /* The PLL is reprogrammed while the core runs from the IRC, which is not faster than any operating point. */
+        CLOCK_AttachClk(kIRC12M_to_MAIN_CLK);
+        CLOCK_AttachClk(kIRC12M_to_SYS_PLL);
+        if (kStatus_PLL_Success == CLOCK_SetPLLFreqFromTable(point->pllSetup))
+        {
+            CLOCK_SetClkDiv(kCLOCK_DivAhbClk, ahbClkDiv, false);
+            CLOCK_AttachClk(kSYS_PLL_OUT_to_MAIN_CLK);
+            s_dvfs.pllSetup = point->pllSetup;
+        }
+        else
+        {
+            POWER_EnablePD(kPDRUNCFG_PD_SYS_PLL);
+            s_dvfs.pllSetup = NULL;
+            status          = kStatus_DVFS_PllError;
+        }
+    }
+
+    /* Down-shift, the flash wait states and the voltage are lowered after the clock. */
+    newClock = CLOCK_GetCoreClkFreq();
+    if (newClock < setClock)
+    {
+        CLOCK_SetFLASHAccessCyclesForFreq(newClock);
+        POWER_SetVoltageForFreq(newClock);
+    }
+
+    return status;
+}
+
+status_t DVFS_Init(const dvfs_config_t *config)
+{
+    status_t status;
+
+    assert(config);
+    assert(config->points);
+    assert(config->initialPoint < config->pointCount);
+    assert(config->downThreshold < config->upThreshold);
+
+    DVFS_Deinit();
+
+    /* The busy time is measured by the DWT cycle counter. */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    s_dvfs.points        = config->points;
+    s_dvfs.pointCount    = config->pointCount;
+    s_dvfs.samplePeriod  = config->samplePeriod;
+    s_dvfs.upThreshold   = config->upThreshold;
+    s_dvfs.downThreshold = config->downThreshold;
+    s_dvfs.governor      = true;
+
+    status = DVFS_SetOperatingPoint(config->initialPoint);
+
+#if (defined(DVFS_TIMER_MANAGER_ENABLE) && (DVFS_TIMER_MANAGER_ENABLE > 0U))
+    (void)TM_Open((timer_handle_t)s_dvfs.timerHandle);
+    (void)TM_InstallCallback((timer_handle_t)s_dvfs.timerHandle, DVFS_TimerCallback, NULL);
+    if (kStatus_TimerSuccess !=
+        TM_Start((timer_handle_t)s_dvfs.timerHandle, (uint8_t)kTimerModeIntervalTimer, config->samplePeriod))
+    {
+        DVFS_Deinit();
+        return kStatus_OutOfRange;
+    }
+#endif
+
+    return status;
+}
+
+void DVFS_Deinit(void)
+{
+    uint32_t regPrimask;
+
+#if (defined(DVFS_TIMER_MANAGER_ENABLE) && (DVFS_TIMER_MANAGER_ENABLE > 0U))
+    if (NULL != s_dvfs.points)
+    {
+        (void)TM_Close((timer_handle_t)s_dvfs.timerHandle);
+    }
+#endif
+    regPrimask = DisableGlobalIRQ();
+    (void)memset(&s_dvfs, 0, sizeof(s_dvfs));
+    EnableGlobalIRQ(regPrimask);
+}
+
+status_t DVFS_SetOperatingPoint(uint32_t point)
+{
+    status_t status;
+    uint32_t regPrimask;
+
+    assert(NULL != s_dvfs.points);
+    assert(point < s_dvfs.pointCount);
+
+    status = DVFS_Switch(&s_dvfs.points[point]);
+
+    regPrimask             = DisableGlobalIRQ();
+    s_dvfs.current         = (kStatus_Success == status) ? point : DVFS_NO_OPERATING_POINT;
+    s_dvfs.pending         = s_dvfs.current;
+    s_dvfs.windowRestarted = true;
+    s_dvfs.windowStart     = DWT->CYCCNT;
+    s_dvfs.idleStart       = s_dvfs.windowStart;
+    s_dvfs.idleCycles      = 0U;
+    EnableGlobalIRQ(regPrimask);
+
+    return status;
+}
+
+uint32_t DVFS_GetOperatingPoint(void)
+{
+    return s_dvfs.current;
+}
+
+void DVFS_EnableGovernor(bool enable)
+{
+    uint32_t regPrimask;
+
+    /* DVFS_Update could run from an interrupt between the two updates. */
+    regPrimask      = DisableGlobalIRQ();
+    s_dvfs.pending  = s_dvfs.current;
+    s_dvfs.governor = enable;
+    EnableGlobalIRQ(regPrimask);
+}
+
+status_t DVFS_ApplyPending(void)
+{
+    uint32_t pending = s_dvfs.pending;
+
+    if ((NULL == s_dvfs.points) || (!s_dvfs.governor) || (pending == s_dvfs.current))
+    {
+        return kStatus_Success;
+    }
+
+    return DVFS_SetOperatingPoint(pending);
+}
+
+void DVFS_IdleEnter(void)
+{
+    uint32_t pending = s_dvfs.pending;
+
+    if (NULL == s_dvfs.points)
+    {
+        return;
+    }
+
+    /* The idle hook does not wait for the PLL lock, such a change is left to DVFS_ApplyPending. */
+    if (s_dvfs.governor && (pending != s_dvfs.current) && (pending < s_dvfs.pointCount) &&
+        (!DVFS_NeedsPllLock(&s_dvfs.points[pending])))
+    {
+        (void)DVFS_SetOperatingPoint(pending);
+    }
+    s_dvfs.idleStart = DWT->CYCCNT;
+    s_dvfs.idle      = true;
+}
+
+void DVFS_IdleExit(void)
+{
+    uint32_t regPrimask;
+
+    regPrimask = DisableGlobalIRQ();
+    if (s_dvfs.idle)
+    {
+        s_dvfs.idleCycles += DWT->CYCCNT - s_dvfs.idleStart;
+        s_dvfs.idle = false;
+    }
+    EnableGlobalIRQ(regPrimask);
+}
+
+void DVFS_Update(void)
+{
+    uint32_t now;
+    uint32_t busy;
+    uint32_t capacity;
+    uint32_t load;
+    uint32_t current;
+    uint32_t regPrimask;
+    bool windowRestarted;
+
+    if (NULL == s_dvfs.points)
+    {
+        return;
+    }
+
+    regPrimask = DisableGlobalIRQ();
+    now        = DWT->CYCCNT;
+    /* The idle span in progress is split at the end of the sample period. */
+    if (s_dvfs.idle)
+    {
+        s_dvfs.idleCycles += now - s_dvfs.idleStart;
+        s_dvfs.idleStart = now;
+    }
+    busy                   = (now - s_dvfs.windowStart) - s_dvfs.idleCycles;
+    windowRestarted        = s_dvfs.windowRestarted;
+    s_dvfs.windowRestarted = false;
+    s_dvfs.windowStart     = now;
+    s_dvfs.idleCycles      = 0U;
+    EnableGlobalIRQ(regPrimask);
+
+    /* A sample period cut by a change of operating point is shorter than the period, it is not evaluated. */
+    if (windowRestarted)
+    {
+        return;
+    }
+
+    capacity = (uint32_t)(((uint64_t)CLOCK_GetCoreClkFreq() * s_dvfs.samplePeriod) / 1000U);
+    load     = (0U == capacity) ? 100U : (uint32_t)(((uint64_t)busy * 100U) / capacity);
+    if (load > 100U)
+    {
+        load = 100U;
+    }
+    s_dvfs.load = load;
+
+    current = s_dvfs.current;
+    if (!s_dvfs.governor)
+    {
+        return;
+    }
+
+    if (load >= s_dvfs.upThreshold)
+    {
+        s_dvfs.pending = s_dvfs.pointCount - 1U;
+    }
+    else if ((load < s_dvfs.downThreshold) && (current < s_dvfs.pointCount) && (current > 0U))
+    {
+        /* The load projected at the slower core clock should not trigger the up-shift right away. */
+        if (((uint64_t)load * s_dvfs.points[current].coreClock_Hz) <
+            ((uint64_t)s_dvfs.upThreshold * s_dvfs.points[current - 1U].coreClock_Hz))
+        {
+            s_dvfs.pending = current - 1U;
+        }
+    }
+    else
+    {
+    }
+}
+
+uint32_t DVFS_GetLoad(void)
+{
+    return s_dvfs.load;
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __DVFS_H__
+#define __DVFS_H__
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup dvfs
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Whether the load is sampled by an interval timer of the timer manager (1 - enable, 0 - disable).
+ *
+ * If it is disabled, DVFS_Update should be called every samplePeriod of #dvfs_config_t from the interrupt of a
+ * hardware timer.
+ */
+#ifndef DVFS_TIMER_MANAGER_ENABLE
+#define DVFS_TIMER_MANAGER_ENABLE (1U)
+#endif
+
+/*! @brief The operating point returned by DVFS_GetOperatingPoint once the PLL of an operating point failed */
+#define DVFS_NO_OPERATING_POINT (0xFFFFFFFFU)
+
+/*! @brief The DVFS status */
+enum _dvfs_status
+{
+    kStatus_DVFS_PllError = MAKE_STATUS(kStatusGroup_DVFS, 1), /*!< The PLL of the operating point failed */
+};
+
+/*! @brief The DVFS operating point.
+ *
+ * The core clock is the main clock divided by AHBCLKDIV. The PLL setups are usually the entries of
+ * g_clockPllSetupTable computed for the 12 MHz IRC. The operating points sharing a PLL setup are switched by the
+ * divider only, the PLL keeps running, for example:
+ * @code
+ *   static const dvfs_operating_point_t s_points[] = {
+ *       {12000000U, NULL, 1U},
+ *       {37500000U, &g_clockPllSetupTable[kCLOCK_PllSetup12MTo150M], 4U},
+ *       {75000000U, &g_clockPllSetupTable[kCLOCK_PllSetup12MTo150M], 2U},
+ *       {150000000U, &g_clockPllSetupTable[kCLOCK_PllSetup12MTo150M], 1U},
+ *   };
+ * @endcode
+ */
+typedef struct _dvfs_operating_point
+{
+    uint32_t coreClock_Hz;             /*!< Core clock of the operating point */
+    const pll_setup_entry_t *pllSetup; /*!< PLL setup fed by the 12 MHz IRC, NULL to run from the IRC directly */
+    uint32_t ahbClkDiv;                /*!< Divider of the main clock to the core clock, 0 is taken as 1 */
+} dvfs_operating_point_t;
+
+/*! @brief The DVFS config structure */
+typedef struct _dvfs_config
+{
+    const dvfs_operating_point_t *points; /*!< Operating points, sorted by increasing core clock */
+    uint32_t pointCount;                  /*!< Number of operating points */
+    uint32_t initialPoint;                /*!< Operating point set by DVFS_Init */
+    uint32_t samplePeriod;                /*!< Load sampling period in milliseconds */
+    uint8_t upThreshold;                  /*!< Load in percent from which the fastest operating point is set */
+    uint8_t downThreshold;                /*!< Load in percent under which a slower operating point is set */
+} dvfs_config_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* _cplusplus */
+
+/*!
+ * @brief Initializes the DVFS governor and sets the initial operating point.
+ *
+ * The DWT cycle counter is enabled to measure the busy time. If #DVFS_TIMER_MANAGER_ENABLE is set, an interval
+ * timer of the timer manager is started to sample the load, the timer manager should be initialized first.
+ *
+ * @param config Pointer to user-defined configuration structure.
+ * @retval kStatus_Success The governor is initialized.
+ * @retval kStatus_OutOfRange The sample period is not supported by the timer manager.
+ * @retval kStatus_DVFS_PllError The PLL of the initial operating point failed, the core runs from the IRC.
+ */
+status_t DVFS_Init(const dvfs_config_t *config);
+
+/*!
+ * @brief Deinitializes the DVFS governor, the current operating point is kept.
+ */
+void DVFS_Deinit(void);
+
+/*!
+ * @brief Sets an operating point.
+ *
+ * On an up-shift the voltage and the flash wait states are raised before the clock, on a down-shift they are
+ * lowered after it. If the PLL setup of the operating point is the one locked, only the divider changes. Otherwise
+ * the PLL is reprogrammed while the core runs from the 12 MHz IRC, and it waits for the PLL lock. The PLL is powered
+ * down at the IRC operating point. The clock driver notifies the subscribers of the clocks that changed, such as the
+ * timer manager and the UART adapter. It should be called from the thread context, and the load based selection is
+ * suspended by DVFS_EnableGovernor.
+ *
+ * @param point Index of the operating point.
+ * @retval kStatus_Success The operating point is set.
+ * @retval kStatus_DVFS_PllError The PLL failed, the core runs from the IRC and the operating point is
+ * #DVFS_NO_OPERATING_POINT.
+ */
+status_t DVFS_SetOperatingPoint(uint32_t point);
+
+/*!
+ * @brief Gets the current operating point.
+ *
+ * @retval Index of the operating point, or #DVFS_NO_OPERATING_POINT.
+ */
+uint32_t DVFS_GetOperatingPoint(void);
+
+/*!
+ * @brief Enables or disables the load based selection of the operating point.
+ *
+ * It is enabled by DVFS_Init.
+ *
+ * @param enable true to enable the governor, false to keep the operating point.
+ */
+void DVFS_EnableGovernor(bool enable);
+
+/*!
+ * @brief Applies the operating point selected by the governor.
+ *
+ * It should be called from the thread context, for example from the main loop, as it waits for the PLL lock if the
+ * operating point needs another PLL setup. It does nothing if the governor is disabled or the operating point is
+ * already set.
+ *
+ * @retval kStatus_Success The operating point is set, or no change is pending.
+ * @retval kStatus_DVFS_PllError The PLL failed, the core runs from the IRC.
+ */
+status_t DVFS_ApplyPending(void);
+
+/*!
+ * @brief Marks the entry of the idle loop, and applies the operating point selected by the governor if it is quick.
+ *
+ * It should be called from the idle loop right before the core sleeps, with the interrupts masked. The time until
+ * DVFS_IdleExit is not counted as busy. The pending operating point is set here, as no work is in progress, if it
+ * does not need the PLL to lock: it uses the PLL setup locked or the IRC. The others are left to DVFS_ApplyPending.
+ */
+void DVFS_IdleEnter(void);
+
+/*!
+ * @brief Marks the exit of the idle loop, it should be called once the core wakes up.
+ */
+void DVFS_IdleExit(void);
+
+/*!
+ * @brief Samples the load and selects the operating point.
+ *
+ * The load is the busy cycles counted by DWT over the sample period, relative to the cycles of the core clock in
+ * the period. The DWT cycle counter stops while the core sleeps, the idle time is subtracted otherwise. From the
+ * up threshold the fastest operating point is selected, so that a burst of work is served at once. Under the down
+ * threshold the next slower operating point is selected, if the load projected at its core clock stays under the
+ * up threshold, so that the governor does not oscillate. The operating point selected is only set at the next
+ * DVFS_IdleEnter or DVFS_ApplyPending. It is called by the interval timer if #DVFS_TIMER_MANAGER_ENABLE is set.
+ */
+void DVFS_Update(void);
+
+/*!
+ * @brief Gets the load measured over the last sample period.
+ *
+ * @retval The load in percent.
+ */
+uint32_t DVFS_GetLoad(void);
+
+#if defined(__cplusplus)
+}
+#endif
+/*! @}*/
+#endif /* __DVFS_H__ */
@@ -0,0 +1,283 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_common.h"
+#include "fsl_power.h"
+#include <string.h>
+
+#include "timer_manager.h"
+#include "idle.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#if !(defined(TM_SYSTICK_ENABLE) && (TM_SYSTICK_ENABLE > 0U))
+#error The idle module suppresses the SysTick of the timer manager, TM_SYSTICK_ENABLE should be set.
+#endif
+
+/* The idle state structure */
+typedef struct _idle_state
+{
+    idle_config_t config;
+    idle_veto_handle_t *vetoList;
+    volatile uint32_t disallowCount; /*!< the calls of IDLE_DisallowDeepSleep not balanced yet */
+    uint32_t tickResidue;            /*!< the part of a tick left over by the last conversion, in ms * tick rate */
+    bool initialized;
+} idle_state_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static idle_state_t s_idle;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* Clear the wake-up flag, the alarm flag is written 0 so that it is not cleared. */
+static void IDLE_ClearWakeFlag(void)
+{
+    RTC->CTRL = (RTC->CTRL & ~(RTC_CTRL_ALARM1HZ_MASK | RTC_CTRL_WAKE1KHZ_MASK)) | RTC_CTRL_WAKE1KHZ_MASK;
+}
+
+/* Notify the vetoes from the head of the list up to the one given, excluded. */
+static void IDLE_NotifyExit(const idle_veto_handle_t *last)
+{
+    idle_veto_handle_t *veto = s_idle.vetoList;
+
+    while (veto != last)
+    {
+        (void)veto->callback(veto, kIDLE_EventDeepSleepExit);
+        veto = veto->next;
+    }
+}
+
+/* Ask every veto for the deep sleep, the ones which allowed it are notified of the exit if a later one vetoes it. */
+static bool IDLE_PrepareDeepSleep(void)
+{
+    idle_veto_handle_t *veto = s_idle.vetoList;
+
+    while (NULL != veto)
+    {
+        if (!veto->callback(veto, kIDLE_EventDeepSleepEnter))
+        {
+            IDLE_NotifyExit(veto);
+            return false;
+        }
+        veto = veto->next;
+    }
+
+    return true;
+}
+
+/* Carry the part of the tick in progress over to the ticks slept, SysTick being stopped. A tick expired before it
+ * stopped would run its interrupt once the interrupts are enabled, so it is cleared and counted here instead. */
+static void IDLE_SaveTickInProgress(void)
+{
+    uint32_t load = SysTick->LOAD;
+    uint32_t val  = SysTick->VAL;
+
+    /* The counter is 0 from the expiry to the reload, the pending tick then covers the whole period. */
+    if (0U != val)
+    {
+        s_idle.tickResidue += (uint32_t)(((uint64_t)(load + 1U - val) * 1000U) / (load + 1U));
+    }
+    if (0U != (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk))
+    {
+        SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+        s_idle.tickResidue += 1000U;
+    }
+}
+
+/* Convert the milliseconds slept into ticks, the remainder is carried over to the next sleep. */
+static uint32_t IDLE_MsToTicks(uint32_t ms)
+{
+    uint32_t scaled = (ms * TM_TICK_RATE_HZ) + s_idle.tickResidue;
+
+    s_idle.tickResidue = scaled % 1000U;
+
+    return scaled / 1000U;
+}
+
+void IDLE_Init(const idle_config_t *config)
+{
+    assert(config);
+    assert(config->minTickless_ms > 0U);
+
+    IDLE_Deinit();
+    s_idle.config = *config;
+
+    /* The RTC oscillator and the 1 kHz wake-up timer keep running in deep sleep. */
+    CLOCK_EnableClock(kCLOCK_Rtc);
+    POWER_DisablePD(kPDRUNCFG_PD_32K_OSC);
+    SYSCON->RTCOSCCTRL |= SYSCON_RTCOSCCTRL_EN_MASK;
+    if (0U != (RTC->CTRL & RTC_CTRL_SWRESET_MASK))
+    {
+        RTC->CTRL = 0U;
+    }
+    RTC->CTRL = (RTC->CTRL & ~(RTC_CTRL_ALARM1HZ_MASK | RTC_CTRL_WAKE1KHZ_MASK)) | RTC_CTRL_RTC_EN_MASK |
+                RTC_CTRL_RTC1KHZ_EN_MASK;
+
+    s_idle.initialized = true;
+}
+
+void IDLE_Deinit(void)
+{
+    idle_veto_handle_t *vetoList;
+    uint32_t regPrimask;
+
+    /* The vetoes are owned by their drivers, which may register them before the idle module is initialized. */
+    regPrimask = DisableGlobalIRQ();
+    vetoList   = s_idle.vetoList;
+    (void)memset(&s_idle, 0, sizeof(s_idle));
+    s_idle.vetoList = vetoList;
+    EnableGlobalIRQ(regPrimask);
+}
+
+void IDLE_RegisterVeto(idle_veto_handle_t *handle)
+{
+    uint32_t regPrimask;
+
+    assert(handle);
+    assert(handle->callback);
+
+    regPrimask      = DisableGlobalIRQ();
+    handle->next    = s_idle.vetoList;
+    s_idle.vetoList = handle;
+    EnableGlobalIRQ(regPrimask);
+}
+
+void IDLE_UnregisterVeto(idle_veto_handle_t *handle)
+{
+    idle_veto_handle_t **link = &s_idle.vetoList;
+    uint32_t regPrimask;
+
+    assert(handle);
+
+    regPrimask = DisableGlobalIRQ();
+    while (NULL != *link)
+    {
+        if (*link == handle)
+        {
+            *link = handle->next;
+            break;
+        }
+        link = &((*link)->next);
+    }
+    EnableGlobalIRQ(regPrimask);
+}
+
+void IDLE_DisallowDeepSleep(void)
+{
+    uint32_t regPrimask;
+
+    regPrimask = DisableGlobalIRQ();
+    s_idle.disallowCount++;
+    EnableGlobalIRQ(regPrimask);
+}
+
+void IDLE_AllowDeepSleep(void)
+{
+    uint32_t regPrimask;
+
+    regPrimask = DisableGlobalIRQ();
+    assert(s_idle.disallowCount > 0U);
+    s_idle.disallowCount--;
+    EnableGlobalIRQ(regPrimask);
+}
+
+idle_mode_t IDLE_Enter(void)
+{
+    idle_mode_t mode = kIDLE_ModeSleep;
+    uint32_t deadline;
+    uint32_t sleepMs;
+    uint32_t latency = 0U;
+    uint32_t wakeMs;
+    uint32_t elapsedMs;
+    uint32_t remaining;
+    uint32_t regPrimask;
+
+    assert(s_idle.initialized);
+
+    /* The deadline is read with the interrupts masked, so that a timer started by an interrupt is not missed. */
+    regPrimask = DisableGlobalIRQ();
+    deadline   = TM_GetNextDeadline();
+    if (0U == deadline)
+    {
+        EnableGlobalIRQ(regPrimask);
+        return kIDLE_ModeNone;
+    }
+    sleepMs = (TM_NO_DEADLINE == deadline) ? IDLE_MAX_SLEEP_MS :
+                                             (uint32_t)(((uint64_t)deadline * 1000U) / TM_TICK_RATE_HZ);
+    if (sleepMs > IDLE_MAX_SLEEP_MS)
+    {
+        sleepMs = IDLE_MAX_SLEEP_MS;
+    }
+
+    /* Short sleeps keep the tick, the next one wakes up the core. */
+    if (sleepMs < s_idle.config.minTickless_ms)
+    {
+        POWER_EnterSleep();
+        EnableGlobalIRQ(regPrimask);
+        return kIDLE_ModeSleep;
+    }
+
+    if ((NULL != s_idle.config.enterDeepSleep) && (0U == s_idle.disallowCount) &&
+        (sleepMs > s_idle.config.deepSleepLatency_ms) && IDLE_PrepareDeepSleep())
+    {
+        mode    = kIDLE_ModeDeepSleep;
+        latency = s_idle.config.deepSleepLatency_ms;
+    }
+
+    /* The core is woken up early by the latency of the mode, so that the deadline is met. */
+    wakeMs = sleepMs - latency;
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+    IDLE_SaveTickInProgress();
+    IDLE_ClearWakeFlag();
+    NVIC_ClearPendingIRQ(RTC_IRQn);
+    RTC->WAKE = RTC_WAKE_VAL(wakeMs);
+    EnableDeepSleepIRQ(RTC_IRQn);
+
+    if (kIDLE_ModeDeepSleep == mode)
+    {
+        s_idle.config.enterDeepSleep();
+    }
+    else
+    {
+        POWER_EnterSleep();
+    }
+
+    /* The wake-up timer keeps counting down until it is read, the time after it expired is the latency. */
+    remaining = RTC->WAKE & RTC_WAKE_VAL_MASK;
+    elapsedMs = wakeMs - remaining;
+    if (0U == remaining)
+    {
+        elapsedMs += latency;
+    }
+    RTC->WAKE = RTC_WAKE_VAL(0U);
+    DisableDeepSleepIRQ(RTC_IRQn);
+    IDLE_ClearWakeFlag();
+    NVIC_ClearPendingIRQ(RTC_IRQn);
+
+    if (kIDLE_ModeDeepSleep == mode)
+    {
+        IDLE_NotifyExit(NULL);
+    }
+    EnableGlobalIRQ(regPrimask);
+
+    /* The SysTick is stopped, so the timer callbacks run here rather than in its interrupt. The part of a tick left
+     * over is carried to the next sleep, SysTick restarts a whole period. */
+    TM_AdvanceTicks(IDLE_MsToTicks(elapsedMs));
+    SysTick->VAL = 0U;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+    return mode;
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __IDLE_H__
+#define __IDLE_H__
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup idle
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief The longest sleep in milliseconds, the RTC wake-up timer is 16 bits wide at 1 kHz. */
+#define IDLE_MAX_SLEEP_MS (0xFFFFU)
+
+/*! @brief The idle modes, sorted by increasing depth. */
+typedef enum _idle_mode
+{
+    kIDLE_ModeNone      = 0U, /*!< The core did not sleep, a timer is due */
+    kIDLE_ModeSleep     = 1U, /*!< Sleep mode, the peripherals keep their clocks */
+    kIDLE_ModeDeepSleep = 2U, /*!< Deep sleep mode, the clocks are stopped but the wake-up sources */
+    kIDLE_ModeCount     = 3U, /*!< Number of modes */
+} idle_mode_t;
+
+/*! @brief The events notified to the deep sleep vetoes. */
+typedef enum _idle_event
+{
+    kIDLE_EventDeepSleepEnter = 0U, /*!< Deep sleep is about to be entered, the callback returns false to veto it */
+    kIDLE_EventDeepSleepExit  = 1U, /*!< Deep sleep is exited, or it is vetoed by a later veto, the return is ignored */
+} idle_event_t;
+
+/*! @brief Deep sleep veto handle, forward declaration. */
+typedef struct _idle_veto_handle idle_veto_handle_t;
+
+/*! @brief Deep sleep veto callback, it is called with the interrupts masked. */
+typedef bool (*idle_veto_callback_t)(idle_veto_handle_t *handle, idle_event_t event);
+
+/*! @brief Deep sleep veto handle, the memory is allocated by the driver registering it. */
+struct _idle_veto_handle
+{
+    idle_veto_handle_t *next;      /*!< Next veto, managed by the idle module */
+    idle_veto_callback_t callback; /*!< Callback called around the deep sleep */
+    void *userData;                /*!< User data of the driver */
+};
+
+/*! @brief The idle config structure */
+typedef struct _idle_config
+{
+    void (*enterDeepSleep)(void); /*!< Enters the deep sleep and restores the clocks once woken up, such as
+                                       BOARD_EnterDeepSleep, NULL if the deep sleep mode is not used */
+    uint32_t deepSleepLatency_ms; /*!< Time from the wake-up to the return of enterDeepSleep, PLL lock included */
+    uint32_t minTickless_ms;      /*!< Shortest sleep for which the tick is suppressed, the core sleeps between the
+                                       ticks below it */
+} idle_config_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* _cplusplus */
+
+/*!
+ * @brief Initializes the idle module.
+ *
+ * The RTC oscillator and the 1 kHz RTC wake-up timer are started, the timer is the wake-up source of both modes.
+ * It is used rather than MRT, which stops in deep sleep, or UTICK, which runs from the watchdog oscillator. The
+ * RTC oscillator should be excluded from the power down of the deep sleep, see BOARD_DEEP_SLEEP_EXCLUDE_FROM_PD.
+ * The timer manager should be initialized first.
+ *
+ * @param config Pointer to user-defined configuration structure.
+ */
+void IDLE_Init(const idle_config_t *config);
+
+/*!
+ * @brief Deinitializes the idle module, the RTC keeps running and the vetoes stay registered.
+ */
+void IDLE_Deinit(void);
+
+/*!
+ * @brief Registers a deep sleep veto.
+ *
+ * The callback is called with #kIDLE_EventDeepSleepEnter before each deep sleep, and it returns false while the
+ * driver needs its clock, for example while a transfer is in flight. The idle module then only enters the sleep
+ * mode. Once the callback allowed the deep sleep, it is called with #kIDLE_EventDeepSleepExit after it. A veto
+ * can be registered before IDLE_Init. With DEBUG_CONSOLE_IDLE_VETO_ENABLE set, the debug console registers one, which
+ * vetoes the deep sleep while its serial manager has pending writes.
+ *
+ * @param handle Veto handle, its callback should be set.
+ */
+void IDLE_RegisterVeto(idle_veto_handle_t *handle);
+
+/*!
+ * @brief Unregisters a deep sleep veto.
+ *
+ * @param handle Veto handle registered with IDLE_RegisterVeto.
+ */
+void IDLE_UnregisterVeto(idle_veto_handle_t *handle);
+
+/*!
+ * @brief Forbids the deep sleep until IDLE_AllowDeepSleep is called, the calls are counted.
+ *
+ * It can be called from an interrupt, for example when a transfer starts, while a veto callback suits a state that
+ * is polled.
+ */
+void IDLE_DisallowDeepSleep(void);
+
+/*!
+ * @brief Allows the deep sleep forbidden by IDLE_DisallowDeepSleep.
+ */
+void IDLE_AllowDeepSleep(void);
+
+/*!
+ * @brief Sleeps until the next timer deadline or an interrupt.
+ *
+ * It should be called from the idle loop with the interrupts enabled. The time to the next deadline of the timer
+ * manager selects the deepest mode whose wake latency fits and which is not vetoed. From #idle_config_t
+ * minTickless_ms on, the SysTick of the timer manager is stopped, the RTC wake-up timer is set to wake up the core
+ * early by the latency of the mode, and the ticks elapsed are added to the timer manager once woken up. The timer
+ * callbacks then run in this function. The part of the tick in progress at the entry, and a tick expired but not
+ * served yet, are counted with the ticks slept. The part of a tick left over is carried to the next sleep, and the
+ * time after the wake-up timer expired is accounted as the configured latency.
+ *
+ * @retval The mode entered.
+ */
+idle_mode_t IDLE_Enter(void);
+
+#if defined(__cplusplus)
+}
+#endif
+/*! @}*/
+#endif /* __IDLE_H__ */
@@ -14,6 +14,7 @@
 #include "fsl_common.h"
 #include "generic_list.h"
 
+#if (defined(GENERIC_LIST_DUPLICATED_CHECKING) && (GENERIC_LIST_DUPLICATED_CHECKING > 0U))
 static list_status_t LIST_Scan(list_handle_t list, list_element_handle_t newElement)
 {
     list_element_handle_t element = list->head;
@@ -28,6 +29,22 @@ static list_status_t LIST_Scan(list_handle_t list, list_element_handle_t newElem
     }
     return kLIST_Ok;
 }
+#endif
+
+static list_status_t LIST_CheckDuplicate(list_handle_t list, list_element_handle_t newElement)
+{
+    /* An element linked into a list always points back to it, so membership is known without walking the list. */
+    list_status_t status = (newElement->list == list) ? kLIST_DuplicateError : kLIST_Ok;
+
+#if (defined(GENERIC_LIST_DUPLICATED_CHECKING) && (GENERIC_LIST_DUPLICATED_CHECKING > 0U))
+    list_status_t scanStatus = LIST_Scan(list, newElement);
+
+    /* A mismatch means the list pointer of the element has been corrupted. */
+    assert(scanStatus == status);
+    status = scanStatus;
+#endif
+    return status;
+}
 
 /*! *********************************************************************************
 *************************************************************************************
@@ -103,7 +120,7 @@ list_status_t LIST_AddTail(list_handle_t list, list_element_handle_t element)
         return kLIST_Full;
     }
 
-    if (kLIST_DuplicateError == LIST_Scan(list, element))
+    if (kLIST_DuplicateError == LIST_CheckDuplicate(list, element))
     {
         EnableGlobalIRQ(regPrimask);
         return kLIST_DuplicateError;
@@ -153,7 +170,7 @@ list_status_t LIST_AddHead(list_handle_t list, list_element_handle_t element)
         return kLIST_Full;
     }
 
-    if (kLIST_DuplicateError == LIST_Scan(list, element))
+    if (kLIST_DuplicateError == LIST_CheckDuplicate(list, element))
     {
         EnableGlobalIRQ(regPrimask);
         return kLIST_DuplicateError;
@@ -360,7 +377,7 @@ list_status_t LIST_AddPrevElement(list_element_handle_t element, list_element_ha
         return kLIST_Full;
     }
 
-    if (kLIST_DuplicateError == LIST_Scan(element->list, newElement))
+    if (kLIST_DuplicateError == LIST_CheckDuplicate(element->list, newElement))
     {
         EnableGlobalIRQ(regPrimask);
         return kLIST_DuplicateError;
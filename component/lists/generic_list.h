@@ -25,6 +25,14 @@
 * Public macro definitions
 *************************************************************************************
 ********************************************************************************** */
+/*! @brief Enable or disable the full duplicate scan on insertion (1 - enable, 0 - disable).
+ *
+ * By default an element is detected as a duplicate through its list pointer in constant time. When enabled, the
+ * whole list is also walked with interrupts masked to verify the list pointer, so it is intended for debug builds.
+ */
+#ifndef GENERIC_LIST_DUPLICATED_CHECKING
+#define GENERIC_LIST_DUPLICATED_CHECKING (0U)
+#endif
 
 /*! *********************************************************************************
 *************************************************************************************
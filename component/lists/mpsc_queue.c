@@ -0,0 +1,211 @@
+/*
+ * Copyright 2018-2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*! *********************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+********************************************************************************** */
+#include "mpsc_queue.h"
+#if !(defined(MPSC_QUEUE_USE_HOST_ATOMICS) && (MPSC_QUEUE_USE_HOST_ATOMICS > 0U))
+#include "fsl_common.h"
+#endif
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private functions
+*************************************************************************************
+********************************************************************************** */
+/* Detach the whole chain of pushed elements, the chain is latest first. */
+static mpsc_queue_element_handle_t MPSC_QUEUE_TakeAll(mpsc_queue_handle_t queue)
+{
+    mpsc_queue_element_handle_t chain;
+
+#if (defined(MPSC_QUEUE_USE_HOST_ATOMICS) && (MPSC_QUEUE_USE_HOST_ATOMICS > 0U))
+    chain = __atomic_exchange_n(&queue->pushHead, NULL, __ATOMIC_ACQUIRE);
+#elif (defined(MPSC_QUEUE_USE_EXCLUSIVE_ACCESS) && (MPSC_QUEUE_USE_EXCLUSIVE_ACCESS > 0U))
+    do
+    {
+        chain = (mpsc_queue_element_handle_t)__LDREXW((volatile uint32_t *)(void *)&queue->pushHead);
+        if (NULL == chain)
+        {
+            __CLREX();
+            break;
+        }
+    } while (0U != __STREXW(0U, (volatile uint32_t *)(void *)&queue->pushHead));
+#else
+    uint32_t regPrimask = DisableGlobalIRQ();
+
+    chain           = queue->pushHead;
+    queue->pushHead = NULL;
+
+    EnableGlobalIRQ(regPrimask);
+#endif
+
+    return chain;
+}
+
+/* Move the pushed elements to the consumer chain once the consumer chain has been drained. */
+static void MPSC_QUEUE_Refill(mpsc_queue_handle_t queue)
+{
+    mpsc_queue_element_handle_t chain;
+    mpsc_queue_element_handle_t next;
+
+    if (NULL != queue->popHead)
+    {
+        return;
+    }
+
+    chain = MPSC_QUEUE_TakeAll(queue);
+    /* Reverse the chain, so that the oldest element is the head. */
+    while (NULL != chain)
+    {
+        next           = chain->next;
+        chain->next    = queue->popHead;
+        queue->popHead = chain;
+        chain          = next;
+    }
+}
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public functions
+*************************************************************************************
+********************************************************************************** */
+/*! *********************************************************************************
+ * \brief     Initialises the queue descriptor.
+ *
+ * \param[in] queue - MPSC_QUEUE_ handle to init.
+ *
+ * \return void.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks
+ *
+ ********************************************************************************** */
+void MPSC_QUEUE_Init(mpsc_queue_handle_t queue)
+{
+    queue->pushHead = NULL;
+    queue->popHead  = NULL;
+}
+
+/*! *********************************************************************************
+ * \brief     Links element to the tail of the queue.
+ *
+ * \param[in] queue - ID of queue to insert into.
+ *            element - element to add
+ *
+ * \return void.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks   Lock free, it is safe to be called from any context by any number of
+ *            producers. A producer pre-empted between LDREX and STREX retries,
+ *            because the exclusive monitor is cleared on exception entry and return.
+ *
+ ********************************************************************************** */
+void MPSC_QUEUE_Push(mpsc_queue_handle_t queue, mpsc_queue_element_handle_t element)
+{
+#if (defined(MPSC_QUEUE_USE_HOST_ATOMICS) && (MPSC_QUEUE_USE_HOST_ATOMICS > 0U))
+    mpsc_queue_element_handle_t head = __atomic_load_n(&queue->pushHead, __ATOMIC_RELAXED);
+
+    do
+    {
+        element->next = head;
+    } while (!__atomic_compare_exchange_n(&queue->pushHead, &head, element, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+#elif (defined(MPSC_QUEUE_USE_EXCLUSIVE_ACCESS) && (MPSC_QUEUE_USE_EXCLUSIVE_ACCESS > 0U))
+    do
+    {
+        element->next = (mpsc_queue_element_handle_t)__LDREXW((volatile uint32_t *)(void *)&queue->pushHead);
+    } while (0U != __STREXW((uint32_t)element, (volatile uint32_t *)(void *)&queue->pushHead));
+#else
+    uint32_t regPrimask = DisableGlobalIRQ();
+
+    element->next   = queue->pushHead;
+    queue->pushHead = element;
+
+    EnableGlobalIRQ(regPrimask);
+#endif
+}
+
+/*! *********************************************************************************
+ * \brief     Unlinks element from the head of the queue.
+ *
+ * \param[in] queue - ID of queue to remove from.
+ *
+ * \return NULL if queue is empty.
+ *         ID of removed element(pointer) if removal was successful.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks   Only the single consumer of the queue is allowed to call it.
+ *
+ ********************************************************************************** */
+mpsc_queue_element_handle_t MPSC_QUEUE_Pop(mpsc_queue_handle_t queue)
+{
+    mpsc_queue_element_handle_t element;
+
+    MPSC_QUEUE_Refill(queue);
+
+    element = queue->popHead;
+    if (NULL != element)
+    {
+        queue->popHead = element->next;
+        element->next  = NULL;
+    }
+    return element;
+}
+
+/*! *********************************************************************************
+ * \brief     Gets head element ID.
+ *
+ * \param[in] queue - ID of queue.
+ *
+ * \return NULL if queue is empty.
+ *         ID of head element if queue is not empty.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks   Only the single consumer of the queue is allowed to call it.
+ *
+ ********************************************************************************** */
+mpsc_queue_element_handle_t MPSC_QUEUE_GetHead(mpsc_queue_handle_t queue)
+{
+    MPSC_QUEUE_Refill(queue);
+
+    return queue->popHead;
+}
+
+/*! *********************************************************************************
+ * \brief     Checks whether the queue is empty.
+ *
+ * \param[in] queue - ID of queue.
+ *
+ * \return true if queue is empty.
+ *         false if queue is not empty.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks
+ *
+ ********************************************************************************** */
+bool MPSC_QUEUE_IsEmpty(mpsc_queue_handle_t queue)
+{
+    return ((NULL == queue->popHead) && (NULL == queue->pushHead));
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright 2018-2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _MPSC_QUEUE_H_
+#define _MPSC_QUEUE_H_
+
+/*!
+ * @addtogroup MpscQueue
+ * @{
+ */
+
+/*!*********************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+********************************************************************************** */
+#include <stdbool.h>
+#include <stddef.h>
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public macro definitions
+*************************************************************************************
+********************************************************************************** */
+/*! @brief Whether the queue is built on the compiler atomic builtins (1 - enable, 0 - disable).
+ *
+ * It is set to build the queue for the host, such as for its stress test. It takes precedence over
+ * #MPSC_QUEUE_USE_EXCLUSIVE_ACCESS, and the queue does not depend on fsl_common.h then.
+ */
+#ifndef MPSC_QUEUE_USE_HOST_ATOMICS
+#define MPSC_QUEUE_USE_HOST_ATOMICS (0U)
+#endif
+
+/*! @brief Whether the queue is built on the exclusive access instructions (LDREX/STREX).
+ *
+ * The cores without exclusive access, such as Cortex-M0+, fall back to masking the interrupts around the
+ * update of the queue.
+ */
+#ifndef MPSC_QUEUE_USE_EXCLUSIVE_ACCESS
+#if (defined(__CORTEX_M) && (__CORTEX_M >= 3U))
+#define MPSC_QUEUE_USE_EXCLUSIVE_ACCESS (1U)
+#else
+#define MPSC_QUEUE_USE_EXCLUSIVE_ACCESS (0U)
+#endif
+#endif
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public type definitions
+*************************************************************************************
+********************************************************************************** */
+/*! @brief The queue structure
+ *
+ * The producers push onto a LIFO chain with the exclusive access instructions, the consumer detaches the whole
+ * chain at once and reverses it into its private FIFO chain, so that the elements are taken in pushing order.
+ */
+typedef struct mpsc_queue_label
+{
+    struct mpsc_queue_element_tag *volatile pushHead; /*!< chain of pushed elements, latest first */
+    struct mpsc_queue_element_tag *popHead;           /*!< chain owned by the consumer, oldest first */
+} mpsc_queue_label_t, *mpsc_queue_handle_t;
+
+/*! @brief The queue element*/
+typedef struct mpsc_queue_element_tag
+{
+    struct mpsc_queue_element_tag *next; /*!< next queue element */
+} mpsc_queue_element_t, *mpsc_queue_element_handle_t;
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public prototypes
+*************************************************************************************
+********************************************************************************** */
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* _cplusplus */
+/*!
+ * @brief Initialize the queue.
+ *
+ * This function initialize the queue. A queue filled with zero is initialized too.
+ *
+ * @param queue - Queue handle to initialize.
+ */
+void MPSC_QUEUE_Init(mpsc_queue_handle_t queue);
+
+/*!
+ * @brief Links element to the tail of the queue.
+ *
+ * This function could be called by any number of producers, from the thread and from the interrupt of any
+ * priority, without masking the interrupts.
+ *
+ * @param queue - Handle of the queue.
+ * @param element - Handle of the element, it should not be in the queue.
+ */
+void MPSC_QUEUE_Push(mpsc_queue_handle_t queue, mpsc_queue_element_handle_t element);
+
+/*!
+ * @brief Unlinks element from the head of the queue.
+ *
+ * This function should only be called by the single consumer of the queue.
+ *
+ * @param queue - Handle of the queue.
+ *
+ * @retval NULL if queue is empty, handle of removed element(pointer) if removal was successful.
+ */
+mpsc_queue_element_handle_t MPSC_QUEUE_Pop(mpsc_queue_handle_t queue);
+
+/*!
+ * @brief Gets head element handle.
+ *
+ * This function should only be called by the single consumer of the queue.
+ *
+ * @param queue - Handle of the queue.
+ *
+ * @retval NULL if queue is empty, handle of head element(pointer) if queue is not empty.
+ */
+mpsc_queue_element_handle_t MPSC_QUEUE_GetHead(mpsc_queue_handle_t queue);
+
+/*!
+ * @brief Checks whether the queue is empty.
+ *
+ * This function does not modify the queue, it could be called from any context. The result is only a snapshot if
+ * the producers are running.
+ *
+ * @param queue - Handle of the queue.
+ *
+ * @retval true if queue is empty, false if there is any element pushed and not removed yet.
+ */
+bool MPSC_QUEUE_IsEmpty(mpsc_queue_handle_t queue);
+
+/* @} */
+
+#if defined(__cplusplus)
+}
+#endif
+/*! @}*/
+#endif /*_MPSC_QUEUE_H_*/
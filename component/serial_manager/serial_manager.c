@@ -7,6 +7,7 @@
  */
 
 #include "fsl_common.h"
+#include <stddef.h>
 #include <string.h>
 
 #include "serial_manager.h"
@@ -14,6 +15,7 @@
 #if (defined(SERIAL_MANAGER_NON_BLOCKING_MODE) && (SERIAL_MANAGER_NON_BLOCKING_MODE > 0U))
 
 #include "generic_list.h"
+#include "mpsc_queue.h"
 
 /*
  * The OSA_USED macro can only be defined when the OSA component is used.
@@ -74,7 +76,8 @@ typedef struct _serial_manager_transfer
 typedef struct _serial_manager_send_handle
 {
 #if (defined(SERIAL_MANAGER_NON_BLOCKING_MODE) && (SERIAL_MANAGER_NON_BLOCKING_MODE > 0U))
-    list_element_t link; /*!< list element of the link */
+    list_element_t link;                /*!< list element of the link */
+    mpsc_queue_element_t completedLink; /*!< queue element of the completed write queue */
     serial_manager_transfer_t transfer;
 #endif
     struct _serial_manager_handle *serialManagerHandle;
@@ -105,8 +108,9 @@ typedef struct _serial_manager_read_ring_buffer
 typedef struct _serial_manager_handle
 {
 #if (defined(SERIAL_MANAGER_NON_BLOCKING_MODE) && (SERIAL_MANAGER_NON_BLOCKING_MODE > 0U))
-    list_label_t runningWriteHandleHead;   /*!< The queue of running write handle */
-    list_label_t completedWriteHandleHead; /*!< The queue of completed write handle */
+    list_label_t runningWriteHandleHead;         /*!< The queue of running write handle */
+    mpsc_queue_label_t completedWriteHandleHead; /*!< The queue of completed write handle */
+    volatile uint8_t completedWriteDraining;     /*!< The completed write queue is being drained */
 #endif
     serial_manager_read_handle_t *volatile openedReadHandleHead;
     volatile uint32_t openedWriteHandleCount;
@@ -191,6 +195,23 @@ static void SerialManager_RemoveHead(list_label_t *queue)
 {
     (void)LIST_RemoveHead(queue);
 }
+
+static void SerialManager_AddCompleted(serial_manager_handle_t *handle, serial_manager_write_handle_t *node)
+{
+    MPSC_QUEUE_Push(&handle->completedWriteHandleHead, &node->completedLink);
+}
+
+static serial_manager_write_handle_t *SerialManager_RemoveCompleted(serial_manager_handle_t *handle)
+{
+    mpsc_queue_element_handle_t element = MPSC_QUEUE_Pop(&handle->completedWriteHandleHead);
+
+    if (NULL == element)
+    {
+        return NULL;
+    }
+    return (serial_manager_write_handle_t *)(void *)((uint8_t *)element -
+                                                     offsetof(serial_manager_write_handle_t, completedLink));
+}
 #endif
 
 #if (defined(SERIAL_MANAGER_NON_BLOCKING_MODE) && (SERIAL_MANAGER_NON_BLOCKING_MODE > 0U))
@@ -262,6 +283,21 @@ static serial_manager_status_t SerialManager_StartReading(serial_manager_handle_
     return status;
 }
 
+static void SerialManager_RxFlowControl(serial_manager_handle_t *handle, uint32_t freeLength)
+{
+    switch (handle->type)
+    {
+#if (defined(SERIAL_PORT_TYPE_UART) && (SERIAL_PORT_TYPE_UART > 0U))
+        case kSerialPort_Uart:
+            (void)Serial_UartRxFlowControl(((serial_handle_t)&handle->lowLevelhandleBuffer[0]), freeLength);
+            break;
+#endif
+        default:
+            /*MISRA rule 16.4*/
+            break;
+    }
+}
+
 #else
 
 static serial_manager_status_t SerialManager_StartWriting(serial_manager_handle_t *handle,
@@ -381,6 +417,7 @@ static void SerialManager_Task(void *param)
     serial_manager_handle_t *handle = (serial_manager_handle_t *)param;
     serial_manager_write_handle_t *serialWriteHandle;
     serial_manager_read_handle_t *serialReadHandle;
+    serial_manager_callback_t callback;
     uint32_t primask;
     serial_manager_callback_message_t msg;
 
@@ -402,21 +439,32 @@ static void SerialManager_Task(void *param)
 
 #endif
         {
-            serialWriteHandle =
-                (serial_manager_write_handle_t *)(void *)LIST_GetHead(&handle->completedWriteHandleHead);
-            while (NULL != serialWriteHandle)
+            /*
+             * Without OSA the task is also run from the interrupt that completes a write. The completed write
+             * queue has a single consumer, so a nested run leaves the queue to the drain it interrupted, which
+             * checks the queue again before returning.
+             */
+            if (0U == handle->completedWriteDraining)
             {
-                SerialManager_RemoveHead(&handle->completedWriteHandleHead);
-                msg.buffer                         = serialWriteHandle->transfer.buffer;
-                msg.length                         = serialWriteHandle->transfer.soFar;
-                serialWriteHandle->transfer.buffer = NULL;
-                if (serialWriteHandle->callback != NULL)
+                do
                 {
-                    serialWriteHandle->callback(serialWriteHandle->callbackParam, &msg,
-                                                serialWriteHandle->transfer.status);
-                }
-                serialWriteHandle =
-                    (serial_manager_write_handle_t *)(void *)LIST_GetHead(&handle->completedWriteHandleHead);
+                    handle->completedWriteDraining = 1U;
+                    serialWriteHandle              = SerialManager_RemoveCompleted(handle);
+                    while (NULL != serialWriteHandle)
+                    {
+                        /* The callback of a handle being closed is cleared, it is read once before the buffer. */
+                        callback                           = serialWriteHandle->callback;
+                        msg.buffer                         = serialWriteHandle->transfer.buffer;
+                        msg.length                         = serialWriteHandle->transfer.soFar;
+                        serialWriteHandle->transfer.buffer = NULL;
+                        if (callback != NULL)
+                        {
+                            callback(serialWriteHandle->callbackParam, &msg, serialWriteHandle->transfer.status);
+                        }
+                        serialWriteHandle = SerialManager_RemoveCompleted(handle);
+                    }
+                    handle->completedWriteDraining = 0U;
+                } while (!MPSC_QUEUE_IsEmpty(&handle->completedWriteHandleHead));
             }
         }
 #if defined(OSA_USED)
@@ -486,7 +534,7 @@ static void SerialManager_TxCallback(void *callbackParam,
         writeHandle->transfer.status = status;
         if (kSerialManager_TransmissionNonBlocking == writeHandle->transfer.mode)
         {
-            SerialManager_AddTail(&handle->completedWriteHandleHead, writeHandle);
+            SerialManager_AddCompleted(handle, writeHandle);
 #if defined(OSA_USED)
 
 #if (defined(SERIAL_MANAGER_USE_COMMON_TASK) && (SERIAL_MANAGER_USE_COMMON_TASK > 0U))
@@ -611,6 +659,7 @@ static void SerialManager_RxCallback(void *callbackParam,
     {
         (void)SerialManager_StartReading(handle, handle->openedReadHandleHead, NULL, ringBufferLength);
     }
+    SerialManager_RxFlowControl(handle, ringBufferLength);
     EnableGlobalIRQ(primask);
 }
 
@@ -732,6 +781,7 @@ static serial_manager_status_t SerialManager_Read(serial_read_handle_t readHandl
     dataLength = handle->ringBuffer.ringBufferSize - 1U - dataLength;
 
     (void)SerialManager_StartReading(handle, readHandle, NULL, dataLength);
+    SerialManager_RxFlowControl(handle, dataLength);
 
     if (receivedLength != NULL)
     {
@@ -861,6 +911,11 @@ serial_manager_status_t SerialManager_Init(serial_handle_t serialHandle, serial_
     {
 #if (defined(SERIAL_PORT_TYPE_UART) && (SERIAL_PORT_TYPE_UART > 0U))
         case kSerialPort_Uart:
+#if (defined(SERIAL_MANAGER_NON_BLOCKING_MODE) && (SERIAL_MANAGER_NON_BLOCKING_MODE > 0U))
+            /* The receiver could never be resumed if the ring buffer cannot reach the RTS high watermark. */
+            assert(!((((serial_port_uart_config_t *)config->portConfig)->enableRxRTS != 0U) &&
+                     (config->ringBufferSize <= SERIAL_PORT_UART_RTS_HIGH_WATERMARK)));
+#endif
             status = Serial_UartInit(((serial_handle_t)&handle->lowLevelhandleBuffer[0]), config->portConfig);
 #if (defined(SERIAL_MANAGER_NON_BLOCKING_MODE) && (SERIAL_MANAGER_NON_BLOCKING_MODE > 0U))
             if ((serial_manager_status_t)kStatus_SerialManager_Success == status)
@@ -1035,6 +1090,22 @@ serial_manager_status_t SerialManager_CloseWriteHandle(serial_write_handle_t wri
 
 #if (defined(SERIAL_MANAGER_NON_BLOCKING_MODE) && (SERIAL_MANAGER_NON_BLOCKING_MODE > 0U))
     (void)SerialManager_CancelWriting(writeHandle);
+#if !defined(OSA_USED)
+    /* A close nested in the drain, from a write callback, leaves the queue to that drain. */
+    SerialManager_Task(handle);
+#endif
+    /*
+     * The handle could still be linked in the completed queue, it can only be cleared once the queue is drained past
+     * it, which clears its buffer. Its callback is cleared so that the drain skips it, and the close is retried.
+     */
+    primask = DisableGlobalIRQ();
+    if (NULL != serialWriteHandle->transfer.buffer)
+    {
+        serialWriteHandle->callback = NULL;
+        EnableGlobalIRQ(primask);
+        return kStatus_SerialManager_Busy;
+    }
+    EnableGlobalIRQ(primask);
 #endif
     primask = DisableGlobalIRQ();
     if (handle->openedWriteHandleCount > 0U)
@@ -1163,7 +1234,15 @@ serial_manager_status_t SerialManager_CancelWriting(serial_write_handle_t writeH
     if (serialWriteHandle != (serial_manager_write_handle_t *)(void *)LIST_GetHead(
                                  &serialWriteHandle->serialManagerHandle->runningWriteHandleHead))
     {
-        (void)LIST_RemoveElement(&serialWriteHandle->link);
+        /*
+         * The handle is only completed here if it was pending. A handle that is not in the running list is idle or
+         * already in the completed queue, and the queue does not reject an element pushed twice.
+         */
+        if (kLIST_Ok != LIST_RemoveElement(&serialWriteHandle->link))
+        {
+            EnableGlobalIRQ(primask);
+            return kStatus_SerialManager_Success;
+        }
         isNotUsed = 1;
     }
     EnableGlobalIRQ(primask);
@@ -1173,7 +1252,7 @@ serial_manager_status_t SerialManager_CancelWriting(serial_write_handle_t writeH
         serialWriteHandle->transfer.soFar  = 0;
         serialWriteHandle->transfer.status = kStatus_SerialManager_Canceled;
 
-        SerialManager_AddTail(&serialWriteHandle->serialManagerHandle->completedWriteHandleHead, serialWriteHandle);
+        SerialManager_AddCompleted(serialWriteHandle->serialManagerHandle, serialWriteHandle);
 #if defined(OSA_USED)
 
 #if (defined(SERIAL_MANAGER_USE_COMMON_TASK) && (SERIAL_MANAGER_USE_COMMON_TASK > 0U))
@@ -1313,14 +1392,57 @@ serial_manager_status_t SerialManager_InstallRxCallback(serial_read_handle_t rea
 
 serial_manager_status_t SerialManager_EnterLowpower(serial_handle_t serialHandle)
 {
+    serial_manager_handle_t *handle;
+    serial_manager_status_t status = kStatus_SerialManager_Error;
+
     assert(serialHandle);
 
-    return kStatus_SerialManager_Success;
+    handle = (serial_manager_handle_t *)serialHandle;
+
+#if (defined(SERIAL_MANAGER_NON_BLOCKING_MODE) && (SERIAL_MANAGER_NON_BLOCKING_MODE > 0U))
+    /* The pending writes and the callbacks of the completed ones keep the core awake. */
+    if ((NULL != LIST_GetHead(&handle->runningWriteHandleHead)) ||
+        (!MPSC_QUEUE_IsEmpty(&handle->completedWriteHandleHead)))
+    {
+        return kStatus_SerialManager_Busy;
+    }
+#endif
+
+    switch (handle->type)
+    {
+#if (defined(SERIAL_PORT_TYPE_UART) && (SERIAL_PORT_TYPE_UART > 0U))
+        case kSerialPort_Uart:
+            status = Serial_UartEnterLowpower(((serial_handle_t)&handle->lowLevelhandleBuffer[0]));
+            break;
+#endif
+        default:
+            /*MISRA rule 16.4*/
+            break;
+    }
+
+    return status;
 }
 
 serial_manager_status_t SerialManager_ExitLowpower(serial_handle_t serialHandle)
 {
+    serial_manager_handle_t *handle;
+    serial_manager_status_t status = kStatus_SerialManager_Success;
+
     assert(serialHandle);
 
-    return kStatus_SerialManager_Success;
+    handle = (serial_manager_handle_t *)serialHandle;
+
+    switch (handle->type)
+    {
+#if (defined(SERIAL_PORT_TYPE_UART) && (SERIAL_PORT_TYPE_UART > 0U))
+        case kSerialPort_Uart:
+            status = Serial_UartExitLowpower(((serial_handle_t)&handle->lowLevelhandleBuffer[0]));
+            break;
+#endif
+        default:
+            /*MISRA rule 16.4*/
+            break;
+    }
+
+    return status;
 }
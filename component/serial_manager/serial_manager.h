@@ -48,8 +48,8 @@
 
 /*! @brief Set serial manager write handle size */
 #if (defined(SERIAL_MANAGER_NON_BLOCKING_MODE) && (SERIAL_MANAGER_NON_BLOCKING_MODE > 0U))
-#define SERIAL_MANAGER_WRITE_HANDLE_SIZE (44U)
-#define SERIAL_MANAGER_READ_HANDLE_SIZE (44U)
+#define SERIAL_MANAGER_WRITE_HANDLE_SIZE (48U)
+#define SERIAL_MANAGER_READ_HANDLE_SIZE (48U)
 #else
 #define SERIAL_MANAGER_WRITE_HANDLE_SIZE (4U)
 #define SERIAL_MANAGER_READ_HANDLE_SIZE (4U)
@@ -303,10 +303,15 @@ serial_manager_status_t SerialManager_OpenWriteHandle(serial_handle_t serialHand
 /*!
  * @brief Closes a writing handle for the serial manager module.
  *
- * This function Closes a writing handle for the serial manager module.
+ * This function Closes a writing handle for the serial manager module. A pending write is canceled. If the write of
+ * the handle is completed but its callback is not called yet, for example when the function is called from the write
+ * callback of another handle or while the serial manager task has not run, the callback of the handle is removed and
+ * kStatus_SerialManager_Busy is returned. The handle is then kept open, and the function should be called again once
+ * the serial manager task has run.
  *
  * @param writeHandle The serial manager module writing handle pointer.
  * @retval kStatus_SerialManager_Success The writing handle is closed.
+ * @retval kStatus_SerialManager_Busy The completion of the write is pending, the handle is still open.
  */
 serial_manager_status_t SerialManager_CloseWriteHandle(serial_write_handle_t writeHandle);
 
@@ -524,10 +529,14 @@ serial_manager_status_t SerialManager_InstallRxCallback(serial_read_handle_t rea
 /*!
  * @brief Prepares to enter low power consumption.
  *
- * This function is used to prepare to enter low power consumption.
+ * This function is used to prepare to enter low power consumption. On success the port wakes the core from the
+ * deep sleep mode when data is received, and the receiving goes on transparently. While a write is pending, the
+ * deep sleep mode would stop it, so it returns busy and the caller should only enter the sleep mode.
  *
  * @param serialHandle The serial manager module handle pointer.
  * @retval kStatus_SerialManager_Success Successful operation.
+ * @retval kStatus_SerialManager_Busy A write is not finished.
+ * @retval kStatus_SerialManager_Error The port does not support the low power mode.
  */
 serial_manager_status_t SerialManager_EnterLowpower(serial_handle_t serialHandle);
 
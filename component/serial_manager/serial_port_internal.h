@@ -24,6 +24,8 @@ extern "C" {
 #if (defined(SERIAL_PORT_TYPE_UART) && (SERIAL_PORT_TYPE_UART > 0U))
 serial_manager_status_t Serial_UartInit(serial_handle_t serialHandle, void *serialConfig);
 serial_manager_status_t Serial_UartDeinit(serial_handle_t serialHandle);
+serial_manager_status_t Serial_UartEnterLowpower(serial_handle_t serialHandle);
+serial_manager_status_t Serial_UartExitLowpower(serial_handle_t serialHandle);
 serial_manager_status_t Serial_UartWrite(serial_handle_t serialHandle, uint8_t *buffer, uint32_t length);
 #if !(defined(SERIAL_MANAGER_NON_BLOCKING_MODE) && (SERIAL_MANAGER_NON_BLOCKING_MODE > 0U))
 serial_manager_status_t Serial_UartRead(serial_handle_t serialHandle, uint8_t *buffer, uint32_t length);
@@ -37,6 +39,7 @@ serial_manager_status_t Serial_UartInstallTxCallback(serial_handle_t serialHandl
 serial_manager_status_t Serial_UartInstallRxCallback(serial_handle_t serialHandle,
                                                      serial_manager_callback_t callback,
                                                      void *callbackParam);
+serial_manager_status_t Serial_UartRxFlowControl(serial_handle_t serialHandle, uint32_t freeLength);
 void Serial_UartIsrFunction(serial_handle_t serialHandle);
 #endif
 
@@ -14,6 +14,11 @@
 #include "uart.h"
 
 #include "serial_port_uart.h"
+#if (defined(SERIAL_MANAGER_NON_BLOCKING_MODE) && (SERIAL_MANAGER_NON_BLOCKING_MODE > 0U))
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+#include "timer_manager.h"
+#endif
+#endif
 
 /*******************************************************************************
  * Definitions
@@ -42,7 +47,17 @@ typedef struct _serial_uart_recv_state
     serial_manager_callback_t callback;
     void *callbackParam;
     volatile uint8_t busy;
+    volatile uint8_t throttled;
+    uint8_t enableRts;
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+    volatile uint8_t draining;
+    volatile uint8_t drainPending;
+    uint32_t readIndex;
+    uint32_t pollTimer[(TIMER_HANDLE_SIZE + sizeof(uint32_t) - 1U) / sizeof(uint32_t)];
+    uint8_t readBuffer[SERIAL_PORT_UART_DMA_RING_SIZE];
+#else
     uint8_t readBuffer[SERIAL_PORT_UART_RECEIVE_DATA_LENGTH];
+#endif
 } serial_uart_recv_state_t;
 #endif
 
@@ -64,15 +79,103 @@ typedef struct _serial_uart_state
  ******************************************************************************/
 
 #if (defined(SERIAL_MANAGER_NON_BLOCKING_MODE) && (SERIAL_MANAGER_NON_BLOCKING_MODE > 0U))
-/* UART user callback */
-static void Serial_UartCallback(hal_uart_handle_t handle, hal_uart_status_t status, void *userData)
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+/*
+ * Deliver the data written by DMA into the receive ring since the last drain. It is called from the DMA and the
+ * poll timer contexts, a drain requested while another one is running is taken over by the running one.
+ */
+static void Serial_UartDmaDrain(serial_uart_state_t *serialUartHandle)
 {
-    serial_uart_state_t *serialUartHandle;
     serial_manager_callback_message_t msg;
+    uint32_t writeIndex;
+    uint32_t primask;
+
+    primask = DisableGlobalIRQ();
+    if (serialUartHandle->rx.draining != 0U)
+    {
+        serialUartHandle->rx.drainPending = 1U;
+        EnableGlobalIRQ(primask);
+        return;
+    }
+    serialUartHandle->rx.draining = 1U;
+    EnableGlobalIRQ(primask);
+
+    do
+    {
+        serialUartHandle->rx.drainPending = 0U;
+        if (kStatus_HAL_UartSuccess ==
+            HAL_UartGetReceiveCount(((hal_uart_handle_t)&serialUartHandle->usartHandleBuffer[0]), &writeIndex))
+        {
+            /* While throttled, the data is left in the ring until Serial_UartRxFlowControl resumes receiving. */
+            while ((writeIndex != serialUartHandle->rx.readIndex) && (0U == serialUartHandle->rx.throttled))
+            {
+                msg.buffer = &serialUartHandle->rx.readBuffer[serialUartHandle->rx.readIndex];
+                msg.length = ((writeIndex > serialUartHandle->rx.readIndex) ? writeIndex :
+                                                                              sizeof(serialUartHandle->rx.readBuffer)) -
+                             serialUartHandle->rx.readIndex;
+                /* Keep the span under the low watermark so that the throttling applies before the ring overflows. */
+                if ((serialUartHandle->rx.enableRts != 0U) && (msg.length > SERIAL_PORT_UART_RTS_LOW_WATERMARK))
+                {
+                    msg.length = SERIAL_PORT_UART_RTS_LOW_WATERMARK;
+                }
+                serialUartHandle->rx.readIndex += msg.length;
+                if (serialUartHandle->rx.readIndex >= sizeof(serialUartHandle->rx.readBuffer))
+                {
+                    serialUartHandle->rx.readIndex = 0U;
+                }
+                if ((NULL != serialUartHandle->rx.callback))
+                {
+                    serialUartHandle->rx.callback(serialUartHandle->rx.callbackParam, &msg,
+                                                  kStatus_SerialManager_Success);
+                }
+            }
+        }
+        primask = DisableGlobalIRQ();
+        if (0U == serialUartHandle->rx.drainPending)
+        {
+            serialUartHandle->rx.draining = 0U;
+        }
+        EnableGlobalIRQ(primask);
+    } while (serialUartHandle->rx.draining != 0U);
+}
+
+/* Poll timer callback, delivers the data not followed by a full half of the ring */
+static void Serial_UartDmaPollCallback(void *param)
+{
+    Serial_UartDmaDrain((serial_uart_state_t *)param);
+}
+#else
+/* Arm the next receive of the UART */
+static void Serial_UartStartReceiving(serial_uart_state_t *serialUartHandle)
+{
 #if (defined(HAL_UART_TRANSFER_MODE) && (HAL_UART_TRANSFER_MODE > 0U))
     hal_uart_transfer_t transfer;
+
+    transfer.data     = &serialUartHandle->rx.readBuffer[0];
+    transfer.dataSize = sizeof(serialUartHandle->rx.readBuffer);
+    if (kStatus_HAL_UartSuccess ==
+        HAL_UartTransferReceiveNonBlocking(((hal_uart_handle_t)&serialUartHandle->usartHandleBuffer[0]), &transfer))
+#else
+    if ((hal_uart_status_t)kStatus_HAL_UartSuccess ==
+        HAL_UartReceiveNonBlocking(((hal_uart_handle_t)&serialUartHandle->usartHandleBuffer[0]),
+                                   &serialUartHandle->rx.readBuffer[0], sizeof(serialUartHandle->rx.readBuffer)))
+#endif
+    {
+        serialUartHandle->rx.busy = 1U;
+    }
+    else
+    {
+        serialUartHandle->rx.busy = 0U;
+    }
+}
 #endif
 
+/* UART user callback */
+static void Serial_UartCallback(hal_uart_handle_t handle, hal_uart_status_t status, void *userData)
+{
+    serial_uart_state_t *serialUartHandle;
+    serial_manager_callback_message_t msg;
+
     if (NULL == userData)
     {
         return;
@@ -82,29 +185,29 @@ static void Serial_UartCallback(hal_uart_handle_t handle, hal_uart_status_t stat
 
     if ((hal_uart_status_t)kStatus_HAL_UartRxIdle == status)
     {
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+        /* A half of the ring is filled, the DMA keeps receiving into the other one. */
+        Serial_UartDmaDrain(serialUartHandle);
+#else
         if ((NULL != serialUartHandle->rx.callback))
         {
             msg.buffer = &serialUartHandle->rx.readBuffer[0];
             msg.length = sizeof(serialUartHandle->rx.readBuffer);
             serialUartHandle->rx.callback(serialUartHandle->rx.callbackParam, &msg, kStatus_SerialManager_Success);
         }
-#if (defined(HAL_UART_TRANSFER_MODE) && (HAL_UART_TRANSFER_MODE > 0U))
-        transfer.data     = &serialUartHandle->rx.readBuffer[0];
-        transfer.dataSize = sizeof(serialUartHandle->rx.readBuffer);
-        if (kStatus_HAL_UartSuccess ==
-            HAL_UartTransferReceiveNonBlocking(((hal_uart_handle_t)&serialUartHandle->usartHandleBuffer[0]), &transfer))
-#else
-        if ((hal_uart_status_t)kStatus_HAL_UartSuccess ==
-            HAL_UartReceiveNonBlocking(((hal_uart_handle_t)&serialUartHandle->usartHandleBuffer[0]),
-                                       &serialUartHandle->rx.readBuffer[0], sizeof(serialUartHandle->rx.readBuffer)))
-#endif
+        /*
+         * When the receiver is throttled, the data is left in the hardware FIFO. Once the FIFO is full, RTS is
+         * deasserted by the USART and the peer stops sending until Serial_UartRxFlowControl resumes receiving.
+         */
+        if (serialUartHandle->rx.throttled != 0U)
         {
-            serialUartHandle->rx.busy = 1U;
+            serialUartHandle->rx.busy = 0U;
         }
         else
         {
-            serialUartHandle->rx.busy = 0U;
+            Serial_UartStartReceiving(serialUartHandle);
         }
+#endif
     }
     else if ((hal_uart_status_t)kStatus_HAL_UartTxIdle == status)
     {
@@ -143,13 +246,21 @@ serial_manager_status_t Serial_UartInit(serial_handle_t serialHandle, void *seri
     uartConfig       = (serial_port_uart_config_t *)serialConfig;
     serialUartHandle = (serial_uart_state_t *)serialHandle;
 
-    config.baudRate_Bps = uartConfig->baudRate;
-    config.parityMode   = (hal_uart_parity_mode_t)uartConfig->parityMode;
-    config.stopBitCount = (hal_uart_stop_bit_count_t)uartConfig->stopBitCount;
-    config.enableRx     = uartConfig->enableRx;
-    config.enableTx     = uartConfig->enableTx;
-    config.srcClock_Hz  = uartConfig->clockRate;
-    config.instance     = uartConfig->instance;
+    config.baudRate_Bps          = uartConfig->baudRate;
+    config.parityMode            = (hal_uart_parity_mode_t)uartConfig->parityMode;
+    config.stopBitCount          = (hal_uart_stop_bit_count_t)uartConfig->stopBitCount;
+    config.enableRx              = uartConfig->enableRx;
+    config.enableTx              = uartConfig->enableTx;
+    config.srcClock_Hz           = uartConfig->clockRate;
+    config.instance              = uartConfig->instance;
+    config.enableRxRTS           = uartConfig->enableRxRTS;
+    config.enableTxCTS           = uartConfig->enableTxCTS;
+    config.syncMode              = (hal_uart_sync_mode_t)uartConfig->syncMode;
+    config.clockPolarity         = (hal_uart_clock_polarity_t)uartConfig->clockPolarity;
+    config.enableContinuousClock = uartConfig->enableContinuousClock;
+    config.driverEnable          = (hal_uart_driver_enable_t)uartConfig->driverEnable;
+    config.enableAddressMatch    = uartConfig->enableAddressMatch;
+    config.matchAddress          = uartConfig->matchAddress;
 
     if (kStatus_HAL_UartSuccess != HAL_UartInit(((hal_uart_handle_t)&serialUartHandle->usartHandleBuffer[0]), &config))
     {
@@ -170,9 +281,25 @@ serial_manager_status_t Serial_UartInit(serial_handle_t serialHandle, void *seri
         return kStatus_SerialManager_Error;
     }
 
+    serialUartHandle->rx.enableRts = uartConfig->enableRxRTS;
+    serialUartHandle->rx.throttled = 0U;
+
     if (uartConfig->enableRx != 0U)
     {
         serialUartHandle->rx.busy = 1U;
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+        serialUartHandle->rx.readIndex    = 0U;
+        serialUartHandle->rx.draining     = 0U;
+        serialUartHandle->rx.drainPending = 0U;
+        /* The poll timer needs the timer manager to be initialized by TM_Init before. */
+        if ((kStatus_TimerSuccess != TM_Open((timer_handle_t)&serialUartHandle->rx.pollTimer[0])) ||
+            (kStatus_TimerSuccess != TM_InstallCallback((timer_handle_t)&serialUartHandle->rx.pollTimer[0],
+                                                        Serial_UartDmaPollCallback, serialUartHandle)))
+        {
+            serialUartHandle->rx.busy = 0U;
+            return kStatus_SerialManager_Error;
+        }
+#endif
 #if (defined(HAL_UART_TRANSFER_MODE) && (HAL_UART_TRANSFER_MODE > 0U))
         transfer.data     = &serialUartHandle->rx.readBuffer[0];
         transfer.dataSize = sizeof(serialUartHandle->rx.readBuffer);
@@ -187,6 +314,13 @@ serial_manager_status_t Serial_UartInit(serial_handle_t serialHandle, void *seri
             serialUartHandle->rx.busy = 0U;
             return kStatus_SerialManager_Error;
         }
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+        if (kStatus_TimerSuccess != TM_Start((timer_handle_t)&serialUartHandle->rx.pollTimer[0],
+                                             (uint8_t)kTimerModeIntervalTimer, SERIAL_PORT_UART_DMA_POLL_PERIOD_MS))
+        {
+            return kStatus_SerialManager_Error;
+        }
+#endif
     }
 #endif
 
@@ -202,6 +336,12 @@ serial_manager_status_t Serial_UartDeinit(serial_handle_t serialHandle)
     serialUartHandle = (serial_uart_state_t *)serialHandle;
 
 #if (defined(SERIAL_MANAGER_NON_BLOCKING_MODE) && (SERIAL_MANAGER_NON_BLOCKING_MODE > 0U))
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+    if (serialUartHandle->rx.busy != 0U)
+    {
+        (void)TM_Close((timer_handle_t)&serialUartHandle->rx.pollTimer[0]);
+    }
+#endif
 #if (defined(HAL_UART_TRANSFER_MODE) && (HAL_UART_TRANSFER_MODE > 0U))
     (void)HAL_UartTransferAbortReceive(((hal_uart_handle_t)&serialUartHandle->usartHandleBuffer[0]));
 #else
@@ -211,13 +351,59 @@ serial_manager_status_t Serial_UartDeinit(serial_handle_t serialHandle)
     (void)HAL_UartDeinit(((hal_uart_handle_t)&serialUartHandle->usartHandleBuffer[0]));
 
 #if (defined(SERIAL_MANAGER_NON_BLOCKING_MODE) && (SERIAL_MANAGER_NON_BLOCKING_MODE > 0U))
-    serialUartHandle->tx.busy = 0U;
-    serialUartHandle->rx.busy = 0U;
+    serialUartHandle->tx.busy      = 0U;
+    serialUartHandle->rx.busy      = 0U;
+    serialUartHandle->rx.throttled = 0U;
 #endif
 
     return kStatus_SerialManager_Success;
 }
 
+serial_manager_status_t Serial_UartEnterLowpower(serial_handle_t serialHandle)
+{
+    serial_uart_state_t *serialUartHandle;
+    hal_uart_status_t status;
+
+    assert(serialHandle);
+
+    serialUartHandle = (serial_uart_state_t *)serialHandle;
+
+#if (defined(SERIAL_MANAGER_NON_BLOCKING_MODE) && (SERIAL_MANAGER_NON_BLOCKING_MODE > 0U))
+    if (serialUartHandle->tx.busy != 0U)
+    {
+        return kStatus_SerialManager_Busy;
+    }
+#endif
+
+    status = HAL_UartEnterLowpower(((hal_uart_handle_t)&serialUartHandle->usartHandleBuffer[0]));
+    if (kStatus_HAL_UartTxBusy == status)
+    {
+        return kStatus_SerialManager_Busy;
+    }
+    else if (kStatus_HAL_UartSuccess != status)
+    {
+        return kStatus_SerialManager_Error;
+    }
+    else
+    {
+    }
+
+    return kStatus_SerialManager_Success;
+}
+
+serial_manager_status_t Serial_UartExitLowpower(serial_handle_t serialHandle)
+{
+    serial_uart_state_t *serialUartHandle;
+
+    assert(serialHandle);
+
+    serialUartHandle = (serial_uart_state_t *)serialHandle;
+
+    (void)HAL_UartExitLowpower(((hal_uart_handle_t)&serialUartHandle->usartHandleBuffer[0]));
+
+    return kStatus_SerialManager_Success;
+}
+
 #if (defined(SERIAL_MANAGER_NON_BLOCKING_MODE) && (SERIAL_MANAGER_NON_BLOCKING_MODE > 0U))
 
 serial_manager_status_t Serial_UartWrite(serial_handle_t serialHandle, uint8_t *buffer, uint32_t length)
@@ -356,6 +542,63 @@ serial_manager_status_t Serial_UartInstallRxCallback(serial_handle_t serialHandl
     return kStatus_SerialManager_Success;
 }
 
+serial_manager_status_t Serial_UartRxFlowControl(serial_handle_t serialHandle, uint32_t freeLength)
+{
+    serial_uart_state_t *serialUartHandle;
+    uint32_t primask;
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+    uint8_t resumed = 0U;
+#endif
+
+    assert(serialHandle);
+
+    serialUartHandle = (serial_uart_state_t *)serialHandle;
+
+    if (0U == serialUartHandle->rx.enableRts)
+    {
+        return kStatus_SerialManager_Success;
+    }
+
+    primask = DisableGlobalIRQ();
+    if (0U == serialUartHandle->rx.throttled)
+    {
+        if (freeLength < SERIAL_PORT_UART_RTS_LOW_WATERMARK)
+        {
+            serialUartHandle->rx.throttled = 1U;
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+            (void)HAL_UartDmaPauseReceive(((hal_uart_handle_t)&serialUartHandle->usartHandleBuffer[0]), true);
+#endif
+        }
+    }
+    else if (freeLength >= SERIAL_PORT_UART_RTS_HIGH_WATERMARK)
+    {
+        serialUartHandle->rx.throttled = 0U;
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+        (void)HAL_UartDmaPauseReceive(((hal_uart_handle_t)&serialUartHandle->usartHandleBuffer[0]), false);
+        resumed = 1U;
+#else
+        if (0U == serialUartHandle->rx.busy)
+        {
+            Serial_UartStartReceiving(serialUartHandle);
+        }
+#endif
+    }
+    else
+    {
+    }
+    EnableGlobalIRQ(primask);
+
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+    /* Deliver the data left in the ring while throttled. */
+    if (resumed != 0U)
+    {
+        Serial_UartDmaDrain(serialUartHandle);
+    }
+#endif
+
+    return kStatus_SerialManager_Success;
+}
+
 void Serial_UartIsrFunction(serial_handle_t serialHandle)
 {
     serial_uart_state_t *serialUartHandle;
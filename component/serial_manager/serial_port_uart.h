@@ -19,11 +19,48 @@
  ******************************************************************************/
 /*! @brief serial port uart handle size*/
 #if (defined(SERIAL_MANAGER_NON_BLOCKING_MODE) && (SERIAL_MANAGER_NON_BLOCKING_MODE > 0U))
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+/*! @brief Size (in bytes) of the receive ring filled by DMA. It should be even and each half should be less than
+ * 1024 bytes. The ring should hold the data received in a poll period. */
+#ifndef SERIAL_PORT_UART_DMA_RING_SIZE
+#define SERIAL_PORT_UART_DMA_RING_SIZE (64U)
+#endif
+
+/*! @brief Period (in milliseconds) of the timer polling the receive ring for the data not followed by a full half.
+ * The timer manager should be initialized by TM_Init before the port, Serial_UartInit fails otherwise. */
+#ifndef SERIAL_PORT_UART_DMA_POLL_PERIOD_MS
+#define SERIAL_PORT_UART_DMA_POLL_PERIOD_MS (10U)
+#endif
+
+#if ((SERIAL_PORT_UART_DMA_RING_SIZE & 1U) || (SERIAL_PORT_UART_DMA_RING_SIZE >= 2048U))
+#error SERIAL_PORT_UART_DMA_RING_SIZE should be even and less than 2048.
+#endif
+
+#define SERIAL_PORT_UART_HANDLE_SIZE (166U + 40U + SERIAL_PORT_UART_DMA_RING_SIZE)
+#else
 #define SERIAL_PORT_UART_HANDLE_SIZE (166U)
+#endif
 #else
 #define SERIAL_PORT_UART_HANDLE_SIZE (4U)
 #endif
 
+#if (defined(SERIAL_MANAGER_NON_BLOCKING_MODE) && (SERIAL_MANAGER_NON_BLOCKING_MODE > 0U))
+/*! @brief Free space (in bytes) of the serial manager receive ring buffer below which the receiver is throttled and
+ * RTS is deasserted, only used when RX RTS is enabled. It should cover the characters in flight before the peer
+ * observes RTS.
+ */
+#ifndef SERIAL_PORT_UART_RTS_LOW_WATERMARK
+#define SERIAL_PORT_UART_RTS_LOW_WATERMARK (8U)
+#endif
+
+/*! @brief Free space (in bytes) of the serial manager receive ring buffer from which the throttled receiver is
+ * resumed and RTS is asserted again, only used when RX RTS is enabled.
+ */
+#ifndef SERIAL_PORT_UART_RTS_HIGH_WATERMARK
+#define SERIAL_PORT_UART_RTS_HIGH_WATERMARK (32U)
+#endif
+#endif
+
 /*! @brief serial port uart parity mode*/
 typedef enum _serial_port_uart_parity_mode
 {
@@ -39,17 +76,48 @@ typedef enum _serial_port_uart_stop_bit_count
     kSerialManager_UartTwoStopBit = 1U, /*!< Two stop bits */
 } serial_port_uart_stop_bit_count_t;
 
+/*! @brief serial port uart synchronous mode*/
+typedef enum _serial_port_uart_sync_mode
+{
+    kSerialManager_UartSyncModeDisabled = 0x0U, /*!< Asynchronous mode (default) */
+    kSerialManager_UartSyncModeSlave    = 0x2U, /*!< Synchronous slave mode, SCLK is an input */
+    kSerialManager_UartSyncModeMaster   = 0x3U, /*!< Synchronous master mode, SCLK is an output */
+} serial_port_uart_sync_mode_t;
+
+/*! @brief serial port uart clock polarity, only used in synchronous mode*/
+typedef enum _serial_port_uart_clock_polarity
+{
+    kSerialManager_UartRxSampleOnFallingEdge = 0x0U, /*!< RXD is sampled on the falling edge of SCLK (default) */
+    kSerialManager_UartRxSampleOnRisingEdge  = 0x1U, /*!< RXD is sampled on the rising edge of SCLK */
+} serial_port_uart_clock_polarity_t;
+
+/*! @brief serial port uart RS-485 driver enable on RTS*/
+typedef enum _serial_port_uart_driver_enable
+{
+    kSerialManager_UartDriverEnableDisabled   = 0x0U, /*!< RTS is not a driver enable (default) */
+    kSerialManager_UartDriverEnableActiveLow  = 0x1U, /*!< RTS is an active low driver enable */
+    kSerialManager_UartDriverEnableActiveHigh = 0x2U, /*!< RTS is an active high driver enable */
+} serial_port_uart_driver_enable_t;
+
 /*! @brief serial port uart config struct*/
 typedef struct _serial_port_uart_config
 {
-    uint32_t clockRate;                             /*!< clock rate  */
-    uint32_t baudRate;                              /*!< baud rate  */
-    serial_port_uart_parity_mode_t parityMode;      /*!< Parity mode, disabled (default), even, odd */
-    serial_port_uart_stop_bit_count_t stopBitCount; /*!< Number of stop bits, 1 stop bit (default) or 2 stop bits  */
-    uint8_t instance;                               /*!< Instance (0 - UART0, 1 - UART1, ...), detail information
-                                                         please refer to the SOC corresponding RM. */
-    uint8_t enableRx;                               /*!< Enable RX */
-    uint8_t enableTx;                               /*!< Enable TX */
+    uint32_t clockRate;                              /*!< clock rate  */
+    uint32_t baudRate;                               /*!< baud rate  */
+    serial_port_uart_parity_mode_t parityMode;       /*!< Parity mode, disabled (default), even, odd */
+    serial_port_uart_stop_bit_count_t stopBitCount;  /*!< Number of stop bits, 1 stop bit (default) or 2 stop bits */
+    uint8_t instance;                                /*!< Instance (0 - UART0, 1 - UART1, ...), detail information
+                                                          please refer to the SOC corresponding RM. */
+    uint8_t enableRx;                                /*!< Enable RX */
+    uint8_t enableTx;                                /*!< Enable TX */
+    uint8_t enableRxRTS;                             /*!< Enable RX RTS, RTS follows the receive ring buffer level */
+    uint8_t enableTxCTS;                             /*!< Enable TX CTS */
+    serial_port_uart_sync_mode_t syncMode;           /*!< Synchronous mode, asynchronous (default), slave or master */
+    serial_port_uart_clock_polarity_t clockPolarity; /*!< Sampling edge of SCLK in synchronous mode */
+    uint8_t enableContinuousClock;                   /*!< Run SCLK continuously in synchronous master mode */
+    serial_port_uart_driver_enable_t driverEnable;   /*!< RS-485 driver enable on RTS, not used with RX RTS */
+    uint8_t enableAddressMatch;                      /*!< Only receive the 9-bit messages sent to matchAddress */
+    uint8_t matchAddress;                            /*!< Address of the node on a multi-drop bus */
 } serial_port_uart_config_t;
 /*! @} */
 #endif /* __SERIAL_PORT_UART_H__ */
@@ -0,0 +1,387 @@
+/*
+ * Copyright 2018-2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_common.h"
+#include <string.h>
+
+#include "generic_list.h"
+#include "timer_manager.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#if ((TM_WHEEL_SLOT_COUNT == 0U) || ((TM_WHEEL_SLOT_COUNT & (TM_WHEEL_SLOT_COUNT - 1U)) != 0U))
+#error TM_WHEEL_SLOT_COUNT should be a power of 2.
+#endif
+
+#define TM_WHEEL_SLOT_MASK (TM_WHEEL_SLOT_COUNT - 1U)
+
+/* The expiry is compared with the current tick as a signed distance, so a timeout is at most half of the range. */
+#define TM_MAX_TIMEOUT_TICKS (0x7FFFFFFFU)
+
+#define TM_MS_TO_TICKS(ms) ((uint32_t)((((uint64_t)(ms)) * TM_TICK_RATE_HZ + 999U) / 1000U))
+#define TM_TICKS_TO_MS(ticks) ((uint32_t)((((uint64_t)(ticks)) * 1000U) / TM_TICK_RATE_HZ))
+
+/* The timer handle structure */
+typedef struct _timer_handle_struct
+{
+    list_element_t link; /*!< list element of the wheel slot, it should be the first member */
+    timer_callback_t callback;
+    void *callbackParam;
+    uint32_t expiry;   /*!< the tick at which the timer expires */
+    uint32_t interval; /*!< the reload in ticks of the interval timer, 0 for the single shot timer */
+} timer_handle_struct_t;
+
+/* The timer manager state structure */
+typedef struct _timer_manager_state
+{
+    list_label_t wheel[TM_WHEEL_SLOT_COUNT]; /*!< the slots of the timing wheel, hashed by expiry tick */
+    volatile uint32_t ticks;                 /*!< the current tick */
+    uint8_t initialized;
+#if (defined(TM_SYSTICK_ENABLE) && (TM_SYSTICK_ENABLE > 0U))
+    clock_notify_handle_t clockNotify; /*!< the subscription to the core clock changes */
+#endif
+} timer_manager_state_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static timer_manager_state_t s_timermanager;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void TM_LinkTimer(timer_handle_struct_t *timer)
+{
+    (void)LIST_AddTail(&s_timermanager.wheel[timer->expiry & TM_WHEEL_SLOT_MASK], &timer->link);
+}
+
+/* Expire the timers of the slot of the current tick. */
+static void TM_ProcessSlot(uint32_t now)
+{
+    list_label_t expired;
+    list_element_handle_t element;
+    list_element_handle_t next;
+    timer_handle_struct_t *timer;
+    uint32_t regPrimask;
+
+    LIST_Init(&expired, 0U);
+
+    /* The timers of the later revolutions share the slot, only the due ones are moved out. */
+    regPrimask = DisableGlobalIRQ();
+    element    = LIST_GetHead(&s_timermanager.wheel[now & TM_WHEEL_SLOT_MASK]);
+    while (NULL != element)
+    {
+        next  = LIST_GetNext(element);
+        timer = (timer_handle_struct_t *)(void *)element;
+        if ((int32_t)(timer->expiry - now) <= 0)
+        {
+            (void)LIST_RemoveElement(element);
+            (void)LIST_AddTail(&expired, element);
+        }
+        element = next;
+    }
+    EnableGlobalIRQ(regPrimask);
+
+    /* The callback could stop or restart any timer, including the ones still in the expired list. */
+    element = LIST_RemoveHead(&expired);
+    while (NULL != element)
+    {
+        timer = (timer_handle_struct_t *)(void *)element;
+        if (0U != timer->interval)
+        {
+            timer->expiry = now + timer->interval;
+            TM_LinkTimer(timer);
+        }
+        if (NULL != timer->callback)
+        {
+            timer->callback(timer->callbackParam);
+        }
+        element = LIST_RemoveHead(&expired);
+    }
+}
+
+#if (defined(TM_SYSTICK_ENABLE) && (TM_SYSTICK_ENABLE > 0U))
+/* Keep the tick rate when the core clock feeding SysTick changes, the tick in progress restarts. */
+static void TM_CoreClockChanged(clock_notify_handle_t *handle, uint32_t changedMask)
+{
+    uint32_t reload = CLOCK_GetCoreClkFreq() / TM_TICK_RATE_HZ;
+    uint32_t remaining;
+    uint32_t regPrimask;
+
+    if ((0U == reload) || (reload > (SysTick_LOAD_RELOAD_Msk + 1U)))
+    {
+        return;
+    }
+
+    /* A stopped SysTick is restarted by its owner, such as the idle module, which keeps the partial tick itself. */
+    if (0U == (SysTick->CTRL & SysTick_CTRL_ENABLE_Msk))
+    {
+        SysTick->LOAD = reload - 1U;
+        SysTick->VAL  = 0U;
+        return;
+    }
+
+    /*
+     * The rest of the tick in progress is rescaled to the new clock rather than dropped. The counter can only be
+     * written to 0, so the rest is loaded as a shorter period, and the tick period is set once the counter runs it.
+     */
+    regPrimask = DisableGlobalIRQ();
+    remaining  = (uint32_t)(((uint64_t)SysTick->VAL * reload) / (SysTick->LOAD + 1U));
+    if (remaining < 2U)
+    {
+        remaining = 2U;
+    }
+    SysTick->LOAD = remaining - 1U;
+    SysTick->VAL  = 0U;
+    while (0U == SysTick->VAL)
+    {
+    }
+    SysTick->LOAD = reload - 1U;
+    EnableGlobalIRQ(regPrimask);
+}
+#endif
+
+timer_status_t TM_Init(timer_config_t *config)
+{
+    assert(config);
+
+    if (0U != s_timermanager.initialized)
+    {
+        return kStatus_TimerSuccess;
+    }
+
+    for (uint32_t i = 0U; i < TM_WHEEL_SLOT_COUNT; i++)
+    {
+        LIST_Init(&s_timermanager.wheel[i], 0U);
+    }
+    s_timermanager.ticks = 0U;
+
+#if (defined(TM_SYSTICK_ENABLE) && (TM_SYSTICK_ENABLE > 0U))
+    if (0U != SysTick_Config(config->srcClock_Hz / TM_TICK_RATE_HZ))
+    {
+        return kStatus_TimerOutOfRange;
+    }
+    s_timermanager.clockNotify.clockMask = CLOCK_NOTIFY_MASK(kCLOCK_CoreSysClk);
+    s_timermanager.clockNotify.callback  = TM_CoreClockChanged;
+    s_timermanager.clockNotify.userData  = NULL;
+    CLOCK_RegisterNotify(&s_timermanager.clockNotify);
+#endif
+    s_timermanager.initialized = 1U;
+
+    return kStatus_TimerSuccess;
+}
+
+void TM_Deinit(void)
+{
+    list_element_handle_t element;
+
+#if (defined(TM_SYSTICK_ENABLE) && (TM_SYSTICK_ENABLE > 0U))
+    SysTick->CTRL = 0U;
+    CLOCK_UnregisterNotify(&s_timermanager.clockNotify);
+#endif
+    for (uint32_t i = 0U; i < TM_WHEEL_SLOT_COUNT; i++)
+    {
+        element = LIST_RemoveHead(&s_timermanager.wheel[i]);
+        while (NULL != element)
+        {
+            element = LIST_RemoveHead(&s_timermanager.wheel[i]);
+        }
+    }
+    s_timermanager.initialized = 0U;
+}
+
+timer_status_t TM_Open(timer_handle_t timerHandle)
+{
+    assert(timerHandle);
+    assert(TIMER_HANDLE_SIZE >= sizeof(timer_handle_struct_t));
+
+    (void)memset(timerHandle, 0, TIMER_HANDLE_SIZE);
+
+    return kStatus_TimerSuccess;
+}
+
+timer_status_t TM_Close(timer_handle_t timerHandle)
+{
+    assert(timerHandle);
+
+    (void)TM_Stop(timerHandle);
+    (void)memset(timerHandle, 0, TIMER_HANDLE_SIZE);
+
+    return kStatus_TimerSuccess;
+}
+
+timer_status_t TM_InstallCallback(timer_handle_t timerHandle, timer_callback_t callback, void *callbackParam)
+{
+    timer_handle_struct_t *timer;
+
+    assert(timerHandle);
+
+    timer = (timer_handle_struct_t *)timerHandle;
+
+    timer->callback      = callback;
+    timer->callbackParam = callbackParam;
+
+    return kStatus_TimerSuccess;
+}
+
+timer_status_t TM_Start(timer_handle_t timerHandle, uint8_t timerType, uint32_t timerTimeout)
+{
+    timer_handle_struct_t *timer;
+    uint32_t timeoutTicks;
+    uint32_t regPrimask;
+
+    assert(timerHandle);
+    assert(s_timermanager.initialized);
+    if (0U == s_timermanager.initialized)
+    {
+        return kStatus_TimerError;
+    }
+
+    timer        = (timer_handle_struct_t *)timerHandle;
+    timeoutTicks = TM_MS_TO_TICKS(timerTimeout);
+
+    if ((0U == timeoutTicks) || (timeoutTicks > TM_MAX_TIMEOUT_TICKS))
+    {
+        return kStatus_TimerOutOfRange;
+    }
+
+    regPrimask = DisableGlobalIRQ();
+    (void)LIST_RemoveElement(&timer->link);
+    timer->interval = (kTimerModeIntervalTimer == (timer_mode_t)timerType) ? timeoutTicks : 0U;
+    timer->expiry   = s_timermanager.ticks + timeoutTicks;
+    TM_LinkTimer(timer);
+    EnableGlobalIRQ(regPrimask);
+
+    return kStatus_TimerSuccess;
+}
+
+timer_status_t TM_Stop(timer_handle_t timerHandle)
+{
+    timer_handle_struct_t *timer;
+
+    assert(timerHandle);
+
+    timer = (timer_handle_struct_t *)timerHandle;
+
+    (void)LIST_RemoveElement(&timer->link);
+
+    return kStatus_TimerSuccess;
+}
+
+uint8_t TM_IsTimerActive(timer_handle_t timerHandle)
+{
+    timer_handle_struct_t *timer;
+
+    assert(timerHandle);
+
+    timer = (timer_handle_struct_t *)timerHandle;
+
+    return (NULL != LIST_GetList(&timer->link)) ? 1U : 0U;
+}
+
+uint32_t TM_GetRemainingTime(timer_handle_t timerHandle)
+{
+    timer_handle_struct_t *timer;
+    int32_t remaining;
+    uint32_t regPrimask;
+
+    assert(timerHandle);
+
+    timer = (timer_handle_struct_t *)timerHandle;
+
+    regPrimask = DisableGlobalIRQ();
+    if (NULL == LIST_GetList(&timer->link))
+    {
+        EnableGlobalIRQ(regPrimask);
+        return 0U;
+    }
+    remaining = (int32_t)(timer->expiry - s_timermanager.ticks);
+    EnableGlobalIRQ(regPrimask);
+
+    return (remaining > 0) ? TM_TICKS_TO_MS(remaining) : 0U;
+}
+
+uint32_t TM_GetTimestamp(void)
+{
+    return TM_TICKS_TO_MS(s_timermanager.ticks);
+}
+
+uint32_t TM_GetNextDeadline(void)
+{
+    list_element_handle_t element;
+    timer_handle_struct_t *timer;
+    uint32_t now;
+    uint32_t deadline = TM_NO_DEADLINE;
+    int32_t distance;
+    uint32_t regPrimask;
+
+    regPrimask = DisableGlobalIRQ();
+    now        = s_timermanager.ticks;
+    /*
+     * Walk the slots forward from the next tick. A timer due in d ticks is in the d-th slot, so the first one found
+     * is the earliest. The timers of the later revolutions met on the way give the deadline if none is due within
+     * one revolution.
+     */
+    for (uint32_t d = 1U; d <= TM_WHEEL_SLOT_COUNT; d++)
+    {
+        element = LIST_GetHead(&s_timermanager.wheel[(now + d) & TM_WHEEL_SLOT_MASK]);
+        while (NULL != element)
+        {
+            timer    = (timer_handle_struct_t *)(void *)element;
+            distance = (int32_t)(timer->expiry - now);
+            if (distance <= (int32_t)d)
+            {
+                EnableGlobalIRQ(regPrimask);
+                return (distance > 0) ? (uint32_t)distance : 0U;
+            }
+            if ((uint32_t)distance < deadline)
+            {
+                deadline = (uint32_t)distance;
+            }
+            element = LIST_GetNext(element);
+        }
+    }
+    EnableGlobalIRQ(regPrimask);
+
+    return deadline;
+}
+
+void TM_AdvanceTicks(uint32_t ticks)
+{
+    /* Every slot is visited once at most, the timers due in the skipped revolutions are found by their expiry. */
+    if (ticks > TM_WHEEL_SLOT_COUNT)
+    {
+        s_timermanager.ticks += ticks - TM_WHEEL_SLOT_COUNT;
+        ticks = TM_WHEEL_SLOT_COUNT;
+    }
+
+    while (0U != ticks)
+    {
+        s_timermanager.ticks++;
+        TM_ProcessSlot(s_timermanager.ticks);
+        ticks--;
+    }
+}
+
+#if (defined(TM_SYSTICK_ENABLE) && (TM_SYSTICK_ENABLE > 0U))
+void SysTick_Handler(void)
+{
+    TM_AdvanceTicks(1U);
+/* Add for ARM errata 838869, affects Cortex-M4, Cortex-M4F Store immediate
+  overlapping
+  exception return operation might vector to incorrect interrupt */
+#if defined __CORTEX_M && (__CORTEX_M == 4U)
+    __DSB();
+#endif
+}
+#endif
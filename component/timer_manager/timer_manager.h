@@ -0,0 +1,203 @@
+/*
+ * Copyright 2018-2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __TIMERS_MANAGER_H__
+#define __TIMERS_MANAGER_H__
+
+/*!
+ * @addtogroup timermanager
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief The timer handle size */
+#define TIMER_HANDLE_SIZE (32U)
+
+/*! @brief The number of slots of the timing wheel, it should be a power of 2.
+ *
+ * The timers are hashed into the slots by the expiry tick. More slots shorten the slot walked on every tick when
+ * many timers are armed, at the cost of 12 bytes of RAM per slot.
+ */
+#ifndef TM_WHEEL_SLOT_COUNT
+#define TM_WHEEL_SLOT_COUNT (32U)
+#endif
+
+/*! @brief The rate of the tick driving the timing wheel, in Hz. */
+#ifndef TM_TICK_RATE_HZ
+#define TM_TICK_RATE_HZ (1000U)
+#endif
+
+/*! @brief Whether the timer manager owns SysTick_Handler as the tick source (1 - enable, 0 - disable).
+ *
+ * If it is disabled, TM_Init does not configure SysTick and TM_AdvanceTicks should be called from the interrupt of
+ * the selected tick source, such as MRT.
+ */
+#ifndef TM_SYSTICK_ENABLE
+#define TM_SYSTICK_ENABLE (1U)
+#endif
+
+/*! @brief The value returned by TM_GetNextDeadline when there is no active timer */
+#define TM_NO_DEADLINE (0xFFFFFFFFU)
+
+/*! @brief The timer manager status */
+typedef enum _timer_status
+{
+    kStatus_TimerSuccess    = kStatus_Success,                           /*!< Success */
+    kStatus_TimerInvalidId  = MAKE_STATUS(kStatusGroup_TIMERMANAGER, 1), /*!< Invalid Id */
+    kStatus_TimerNotSupport = MAKE_STATUS(kStatusGroup_TIMERMANAGER, 2), /*!< Not Support */
+    kStatus_TimerOutOfRange = MAKE_STATUS(kStatusGroup_TIMERMANAGER, 3), /*!< Out Of Range */
+    kStatus_TimerError      = MAKE_STATUS(kStatusGroup_TIMERMANAGER, 4), /*!< Fail */
+} timer_status_t;
+
+/*! @brief The timer mode */
+typedef enum _timer_mode
+{
+    kTimerModeSingleShot    = 0x01U, /*!< The timer will expire only once. */
+    kTimerModeIntervalTimer = 0x02U, /*!< The timer will expire repeatedly. */
+} timer_mode_t;
+
+/*! @brief The timer handle */
+typedef void *timer_handle_t;
+
+/*! @brief The timer callback function, it is called in the context of the tick interrupt */
+typedef void (*timer_callback_t)(void *param);
+
+/*! @brief The timer manager config structure */
+typedef struct _timer_config
+{
+    uint32_t srcClock_Hz; /*!< Source clock of the tick timer, the core clock for SysTick */
+} timer_config_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* _cplusplus */
+
+/*!
+ * @brief Initializes the timer manager module.
+ *
+ * This function initializes the timing wheel and, if #TM_SYSTICK_ENABLE is set, starts SysTick at #TM_TICK_RATE_HZ.
+ * SysTick is then reloaded from the new core clock whenever the clock driver changes it, so that the tick rate is
+ * kept across the frequency scaling.
+ *
+ * @param config Pointer to user-defined configuration structure.
+ * @retval kStatus_TimerSuccess The timer manager is initialized.
+ * @retval kStatus_TimerOutOfRange The tick rate cannot be generated from the source clock.
+ */
+timer_status_t TM_Init(timer_config_t *config);
+
+/*!
+ * @brief Deinitializes the timer manager module.
+ *
+ * All the timers are stopped and the tick source is stopped.
+ */
+void TM_Deinit(void);
+
+/*!
+ * @brief Opens a timer with the timer handle.
+ *
+ * @param timerHandle Pointer to point to a memory space of size #TIMER_HANDLE_SIZE allocated by the caller.
+ * @retval kStatus_TimerSuccess The timer is opened.
+ */
+timer_status_t TM_Open(timer_handle_t timerHandle);
+
+/*!
+ * @brief Closes a timer with the timer handle, the timer is stopped if it is active.
+ *
+ * @param timerHandle The timer handle.
+ * @retval kStatus_TimerSuccess The timer is closed.
+ */
+timer_status_t TM_Close(timer_handle_t timerHandle);
+
+/*!
+ * @brief Installs the callback of the timer.
+ *
+ * @param timerHandle The timer handle.
+ * @param callback The callback called when the timer expires.
+ * @param callbackParam The parameter of the callback.
+ * @retval kStatus_TimerSuccess The callback is installed.
+ */
+timer_status_t TM_InstallCallback(timer_handle_t timerHandle, timer_callback_t callback, void *callbackParam);
+
+/*!
+ * @brief Starts a timer.
+ *
+ * The timer is linked into the slot of its expiry tick, it takes a constant time whatever the number of the
+ * active timers. An active timer is restarted.
+ *
+ * @param timerHandle The timer handle.
+ * @param timerType The timer mode, #timer_mode_t.
+ * @param timerTimeout The timeout in milliseconds, rounded up to the tick.
+ * @retval kStatus_TimerSuccess The timer is started.
+ * @retval kStatus_TimerOutOfRange The timeout is zero or too long.
+ * @retval kStatus_TimerError The timer manager is not initialized by TM_Init.
+ */
+timer_status_t TM_Start(timer_handle_t timerHandle, uint8_t timerType, uint32_t timerTimeout);
+
+/*!
+ * @brief Stops a timer, it takes a constant time.
+ *
+ * @param timerHandle The timer handle.
+ * @retval kStatus_TimerSuccess The timer is stopped.
+ */
+timer_status_t TM_Stop(timer_handle_t timerHandle);
+
+/*!
+ * @brief Checks whether a timer is active.
+ *
+ * @param timerHandle The timer handle.
+ * @retval 1 if the timer is active, 0 if not.
+ */
+uint8_t TM_IsTimerActive(timer_handle_t timerHandle);
+
+/*!
+ * @brief Gets the remaining time of a timer.
+ *
+ * @param timerHandle The timer handle.
+ * @retval The remaining time in milliseconds, 0 if the timer is not active.
+ */
+uint32_t TM_GetRemainingTime(timer_handle_t timerHandle);
+
+/*!
+ * @brief Gets the time since the timer manager is initialized.
+ *
+ * @retval The timestamp in milliseconds.
+ */
+uint32_t TM_GetTimestamp(void);
+
+/*!
+ * @brief Gets the number of ticks until the earliest timer expires.
+ *
+ * It is used to program the wakeup timer before the tick is suppressed in low power mode. The timers expiring
+ * within one revolution of the wheel are found by walking the slots forward, the others need a walk of all
+ * the timers.
+ *
+ * @retval The number of ticks, or #TM_NO_DEADLINE if there is no active timer.
+ */
+uint32_t TM_GetNextDeadline(void);
+
+/*!
+ * @brief Advances the timing wheel.
+ *
+ * It is called with 1 from the tick interrupt, and with the number of ticks elapsed when the tick was suppressed
+ * in low power mode. The callbacks of the expired timers are called in it.
+ *
+ * @param ticks The number of ticks elapsed.
+ */
+void TM_AdvanceTicks(uint32_t ticks);
+
+#if defined(__cplusplus)
+}
+#endif
+/*! @}*/
+#endif /* __TIMERS_MANAGER_H__ */
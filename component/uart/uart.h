@@ -48,7 +48,7 @@
 #endif
 
 #if (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U))
-#define HAL_UART_HANDLE_SIZE (90U)
+#define HAL_UART_HANDLE_SIZE (98U)
 #else
 #define HAL_UART_HANDLE_SIZE (4U)
 #endif
@@ -56,6 +56,122 @@
 /*! @brief Whether enable transactional function of the UART. (0 - disable, 1 - enable) */
 #define HAL_UART_TRANSFER_MODE (0U)
 
+/*! @brief Whether the non-transactional non-blocking mode moves the data by DMA. (0 - disable, 1 - enable)
+ *
+ * The USARTn RX and TX requests are bound to the DMA channels 2n and 2n+1. The send is moved from the buffer
+ * by DMA, and the receive runs continuously into the buffer as a ring, see #HAL_UartReceiveNonBlocking. The USART
+ * interrupt only reports the receive errors, with #kStatus_HAL_UartProtocolError. The serial manager polls the ring
+ * with a timer, so the timer manager should be initialized by TM_Init before the serial manager.
+ */
+#ifndef HAL_UART_DMA_ENABLE
+#define HAL_UART_DMA_ENABLE (0U)
+#endif
+
+/*! @brief Whether the interrupt handler is bound to each USART at compile time. (0 - disable, 1 - enable)
+ *
+ * The non-transactional handler is forced inline into each USARTn_IRQHandler, so the instance, the peripheral
+ * base and the FIFO mode are folded into constants and each port gets a straight-line handler, at the cost of a
+ * copy of the handler per port. The binding is partial: the state is still found through the handle registered by
+ * HAL_UartInit, one load from a fixed address, since its memory is allocated by the caller at run time. The callback
+ * installed at run time is only called once a buffer is completed, not for each byte. BENCHMARK_UartIsr measures
+ * the handler with and without the binding.
+ */
+#ifndef HAL_UART_ISR_STATIC_BINDING
+#define HAL_UART_ISR_STATIC_BINDING (0U)
+#endif
+
+/*! @brief Whether the baud rate is set through the FRG. (0 - disable, 1 - enable)
+ *
+ * The FRG multiplier, oversampling and BRG are searched jointly, which reaches the high and odd baud rates such as
+ * 921600 or 3000000. The FRG is shared by all the USART instances, so it should only be enabled when they run at
+ * the same baud rate. The srcClock_Hz of #hal_uart_config_t is the clock feeding the FRG.
+ */
+#ifndef HAL_UART_FRACTIONAL_BAUDRATE
+#define HAL_UART_FRACTIONAL_BAUDRATE (0U)
+#endif
+
+/*! @brief Whether the baud rate is set again once the USART clock changes. (0 - disable, 1 - enable)
+ *
+ * The adapter subscribes to the changes of the asynchronous APB clock through CLOCK_RegisterNotify, and sets the
+ * baud rate of #hal_uart_config_t again from CLOCK_GetUsartClkFreq, or from CLOCK_GetAsyncApbClkFreq with
+ * #HAL_UART_FRACTIONAL_BAUDRATE. A character in flight during the change is lost, so the clock should be changed
+ * while the port is idle.
+ */
+#ifndef HAL_UART_CLOCK_NOTIFY
+#define HAL_UART_CLOCK_NOTIFY (0U)
+#endif
+
+/*! @brief Whether the multi-drop address matching is supported. (0 - disable, 1 - enable)
+ *
+ * The non-transactional non-blocking receive filters the characters by the 9-bit address of the node, see the
+ * enableAddressMatch of #hal_uart_config_t. It is not supported with #HAL_UART_DMA_ENABLE or
+ * #HAL_UART_TRANSFER_MODE, which do not look at each received character.
+ */
+#ifndef HAL_UART_ADDRESS_MATCH
+#define HAL_UART_ADDRESS_MATCH (0U)
+#endif
+
+/*! @brief Whether the adapter moves the data through the system FIFO of the USART. (0 - disable, 1 - enable)
+ *
+ * In the non-transactional non-blocking mode, each interrupt drains the RX FIFO and fills the TX FIFO in a burst,
+ * instead of moving one byte per interrupt. It is not used with #HAL_UART_DMA_ENABLE, since the DMA is
+ * requested by the USART itself.
+ */
+#ifndef HAL_UART_ADAPTER_FIFO
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+#define HAL_UART_ADAPTER_FIFO (0U)
+#else
+#define HAL_UART_ADAPTER_FIFO (1U)
+#endif
+#endif
+
+/*! @brief The size of the TX and RX system FIFO of each USART instance, in bytes.
+ *
+ * The USART RX and TX entries of the system FIFO are pools shared by all the instances, so the entries of one
+ * instance are taken from the others. The default splits the pools evenly, the instances not used by the adapter
+ * could be given 0 to leave their entries to the others. The sum should not exceed the pool, 16 entries on LPC5410x.
+ * The RX FIFO is used in all the modes but #HAL_UART_DMA_ENABLE, and the TX FIFO with #HAL_UART_ADAPTER_FIFO.
+ * An instance given entries by VFIFO_ApplyPartition before it is initialized keeps them instead.
+ */
+#ifndef HAL_UART_ADAPTER_FIFO_SIZE
+#define HAL_UART_ADAPTER_FIFO_SIZE \
+    {                              \
+        4U, 4U, 4U, 4U             \
+    }
+#endif
+
+#if (defined(HAL_UART_ADAPTER_FIFO) && (HAL_UART_ADAPTER_FIFO > 0U))
+/*! @brief The RX FIFO interrupt is raised once more than this number of bytes are received, it is lowered below
+ * the FIFO size of the instance. */
+#ifndef HAL_UART_ADAPTER_RX_FIFO_THRESHOLD
+#define HAL_UART_ADAPTER_RX_FIFO_THRESHOLD (7U)
+#endif
+
+/*! @brief The TX FIFO interrupt is raised once at least this number of entries are free, it is lowered below the
+ * FIFO size of the instance. */
+#ifndef HAL_UART_ADAPTER_TX_FIFO_THRESHOLD
+#define HAL_UART_ADAPTER_TX_FIFO_THRESHOLD (8U)
+#endif
+
+/*! @brief The RX FIFO timeout, which flushes the bytes below the threshold to the receiver.
+ *
+ * It is counted in units of 2^HAL_UART_ADAPTER_RX_FIFO_TIMEOUT_BASE clocks of the system FIFO, the default is about
+ * 400us with the 150MHz main clock. It should be longer than a character at the used baud rate.
+ */
+#ifndef HAL_UART_ADAPTER_RX_FIFO_TIMEOUT_BASE
+#define HAL_UART_ADAPTER_RX_FIFO_TIMEOUT_BASE (12U)
+#endif
+#ifndef HAL_UART_ADAPTER_RX_FIFO_TIMEOUT_VALUE
+#define HAL_UART_ADAPTER_RX_FIFO_TIMEOUT_VALUE (15U)
+#endif
+
+/*! @brief Whether the interrupt handler samples the fill level of the FIFOs into the VFIFO peak fill counters, see
+ * VFIFO_GetPeakFill. (0 - disable, 1 - enable) */
+#ifndef HAL_UART_ADAPTER_FIFO_TELEMETRY
+#define HAL_UART_ADAPTER_FIFO_TELEMETRY (0U)
+#endif
+#endif
+
 typedef void *hal_uart_handle_t;
 
 /*! @brief UART status */
@@ -90,15 +206,52 @@ typedef enum _hal_uart_stop_bit_count
     kHAL_UartTwoStopBit = 1U, /*!< Two stop bits */
 } hal_uart_stop_bit_count_t;
 
+/*! @brief UART synchronous mode. */
+typedef enum _hal_uart_sync_mode
+{
+    kHAL_UartSyncModeDisabled = 0x0U, /*!< Asynchronous mode (default) */
+    kHAL_UartSyncModeSlave    = 0x2U, /*!< Synchronous slave mode, SCLK is an input */
+    kHAL_UartSyncModeMaster   = 0x3U, /*!< Synchronous master mode, SCLK is an output at the baud rate */
+} hal_uart_sync_mode_t;
+
+/*! @brief UART clock polarity, only used in synchronous mode. */
+typedef enum _hal_uart_clock_polarity
+{
+    kHAL_UartRxSampleOnFallingEdge = 0x0U, /*!< RXD is sampled on the falling edge of SCLK (default) */
+    kHAL_UartRxSampleOnRisingEdge  = 0x1U, /*!< RXD is sampled on the rising edge of SCLK */
+} hal_uart_clock_polarity_t;
+
+/*! @brief UART RS-485 driver enable, output on the RTS pin. */
+typedef enum _hal_uart_driver_enable
+{
+    kHAL_UartDriverEnableDisabled   = 0x0U, /*!< RTS is not a driver enable (default) */
+    kHAL_UartDriverEnableActiveLow  = 0x1U, /*!< RTS is an active low driver enable */
+    kHAL_UartDriverEnableActiveHigh = 0x2U, /*!< RTS is an active high driver enable */
+} hal_uart_driver_enable_t;
+
 /*! @brief UART configuration structure. */
 typedef struct _hal_uart_config
 {
-    uint32_t srcClock_Hz;                   /*!< Source clock */
-    uint32_t baudRate_Bps;                  /*!< Baud rate  */
-    hal_uart_parity_mode_t parityMode;      /*!< Parity mode, disabled (default), even, odd */
-    hal_uart_stop_bit_count_t stopBitCount; /*!< Number of stop bits, 1 stop bit (default) or 2 stop bits  */
-    uint8_t enableRx;                       /*!< Enable RX */
-    uint8_t enableTx;                       /*!< Enable TX */
+    uint32_t srcClock_Hz;                    /*!< Source clock */
+    uint32_t baudRate_Bps;                   /*!< Baud rate  */
+    hal_uart_parity_mode_t parityMode;       /*!< Parity mode, disabled (default), even, odd */
+    hal_uart_stop_bit_count_t stopBitCount;  /*!< Number of stop bits, 1 stop bit (default) or 2 stop bits  */
+    uint8_t enableRx;                        /*!< Enable RX */
+    uint8_t enableTx;                        /*!< Enable TX */
+    uint8_t enableRxRTS;                     /*!< Enable RX RTS, received data is kept in the hardware FIFO while
+                                                  no receive is pending so that RTS is deasserted */
+    uint8_t enableTxCTS;                     /*!< Enable TX CTS, the transmitter waits for CTS asserted */
+    hal_uart_sync_mode_t syncMode;           /*!< Synchronous mode, asynchronous (default), slave or master. In
+                                                  master mode the baud rate is the SCLK rate, which is not limited
+                                                  by the oversampling; in slave mode the baud rate is ignored */
+    hal_uart_clock_polarity_t clockPolarity; /*!< Sampling edge of SCLK in synchronous mode */
+    uint8_t enableContinuousClock;           /*!< Run SCLK continuously in synchronous master mode, so that the
+                                                  slave could transmit while the master has nothing to send */
+    hal_uart_driver_enable_t driverEnable;   /*!< RS-485 driver enable on RTS, asserted by the hardware while
+                                                  transmitting, it cannot be used with enableRxRTS */
+    uint8_t enableAddressMatch;              /*!< Enable the 9-bit multi-drop mode, only the messages following
+                                                  matchAddress are received, see #HAL_UART_ADDRESS_MATCH */
+    uint8_t matchAddress;                    /*!< Address of the node in the multi-drop mode */
     uint8_t instance; /*!< Instance (0 - UART0, 1 - UART1, ...), detail information please refer to the
                            SOC corresponding RM.
                            Invalid instance value will cause initialization failure. */
@@ -207,6 +360,21 @@ hal_uart_status_t HAL_UartReceiveBlocking(hal_uart_handle_t handle, uint8_t *dat
  */
 hal_uart_status_t HAL_UartSendBlocking(hal_uart_handle_t handle, const uint8_t *data, size_t length);
 
+/*!
+ * @brief Writes an address character to the TX register using a blocking method.
+ *
+ * This function selects the destination node of the next message on a multi-drop bus, the message is then sent
+ * as usual. It returns once the address is written, so that the message follows it without a gap. It is only
+ * used when the enableAddressMatch of #hal_uart_config_t is set.
+ *
+ * @param handle UART handle pointer.
+ * @param address Address of the destination node.
+ * @retval kStatus_HAL_UartSuccess Successfully written the address.
+ * @retval kStatus_HAL_UartTxBusy Previous transmission still not finished.
+ * @retval kStatus_HAL_UartError The multi-drop mode is not enabled.
+ */
+hal_uart_status_t HAL_UartSendAddress(hal_uart_handle_t handle, uint8_t address);
+
 /*! @}*/
 
 #if (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U))
@@ -279,7 +447,8 @@ hal_uart_status_t HAL_UartTransferSendNonBlocking(hal_uart_handle_t handle, hal_
 /*!
  * @brief Gets the number of bytes that have been received.
  *
- * This function gets the number of bytes that have been received.
+ * This function gets the number of bytes that have been received. If #HAL_UART_DMA_ENABLE is set, it is the offset
+ * in the receive ring the data has been written up to.
  *
  * @param handle UART handle pointer.
  * @param count Receive bytes count.
@@ -370,6 +539,10 @@ hal_uart_status_t HAL_UartInstallCallback(hal_uart_handle_t handle,
  * @note The function #HAL_UartReceiveBlocking and the function #HAL_UartReceiveNonBlocking
  * cannot be used at the same time.
  *
+ * @note If #HAL_UART_DMA_ENABLE is set, the buffer is a ring filled continuously by DMA until the receiving is
+ * aborted. The length should be even, the callback passes @ref kStatus_UART_RxIdle each time a half of the ring
+ * is filled, and #HAL_UartGetReceiveCount gives the offset in the ring the data has been written up to.
+ *
  * @param handle UART handle pointer.
  * @param data Start address of the data to write.
  * @param length Size of the data to write.
@@ -402,7 +575,8 @@ hal_uart_status_t HAL_UartSendNonBlocking(hal_uart_handle_t handle, uint8_t *dat
 /*!
  * @brief Gets the number of bytes that have been received.
  *
- * This function gets the number of bytes that have been received.
+ * This function gets the number of bytes that have been received. If #HAL_UART_DMA_ENABLE is set, it is the offset
+ * in the receive ring the data has been written up to.
  *
  * @param handle UART handle pointer.
  * @param count Receive bytes count.
@@ -452,11 +626,54 @@ hal_uart_status_t HAL_UartAbortReceive(hal_uart_handle_t handle);
  */
 hal_uart_status_t HAL_UartAbortSend(hal_uart_handle_t handle);
 
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+/*!
+ * @brief Pauses or resumes the DMA-driven receiving.
+ *
+ * While paused, the RX DMA channel is disabled, the received data stays in the USART and RTS is deasserted once it
+ * is full. The position in the receive ring is kept.
+ *
+ * @param handle UART handle pointer.
+ * @param pause true to pause the receiving, false to resume it.
+ * @retval kStatus_HAL_UartSuccess Successfully paused or resumed the receiving.
+ */
+hal_uart_status_t HAL_UartDmaPauseReceive(hal_uart_handle_t handle, bool pause);
+#endif
+
 /*! @}*/
 
 #endif
 #endif
 
+/*!
+ * @brief Prepares to enter the deep sleep mode.
+ *
+ * The start bit of the next character wakes the core from the deep sleep mode. The USART clock should be kept
+ * running in the deep sleep mode, for example the 12 MHz IRC attached to the USART and excluded from the power
+ * down, so that the character waking the core is received as usual and not lost. The interrupt-driven
+ * receive is kept running, the data is delivered once the core is awake.
+ *
+ * It should be called with the global interrupt disabled, and HAL_UartExitLowpower should be called after waking up
+ * before the global interrupt is enabled again. It is only supported by the non-transactional interrupt mode, the
+ * DMA is not running in the deep sleep mode.
+ *
+ * @param handle UART handle pointer.
+ * @retval kStatus_HAL_UartSuccess The USART is ready for the deep sleep mode.
+ * @retval kStatus_HAL_UartTxBusy The transmission is not finished, the deep sleep mode should not be entered.
+ * @retval kStatus_HAL_UartError The low power mode is not supported in the current configuration.
+ */
+hal_uart_status_t HAL_UartEnterLowpower(hal_uart_handle_t handle);
+
+/*!
+ * @brief Restores from the deep sleep mode.
+ *
+ * The start bit no longer wakes the core, the receiving is not affected.
+ *
+ * @param handle UART handle pointer.
+ * @retval kStatus_HAL_UartSuccess Successfully restored.
+ */
+hal_uart_status_t HAL_UartExitLowpower(hal_uart_handle_t handle);
+
 #if (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U))
 /*!
  * @brief UART IRQ handle function.
@@ -10,10 +10,41 @@
 #include "fsl_usart.h"
 
 #include "uart.h"
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+#include "fsl_dma.h"
+#endif
+#if (defined(HAL_UART_ADAPTER_FIFO_TELEMETRY) && (HAL_UART_ADAPTER_FIFO_TELEMETRY > 0U))
+#include "fsl_vfifo.h"
+#endif
 
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+#if (defined(HAL_UART_TRANSFER_MODE) && (HAL_UART_TRANSFER_MODE > 0U))
+#error HAL_UART_DMA_ENABLE is only supported by the non-transactional API.
+#endif
+#if (defined(HAL_UART_ADAPTER_FIFO) && (HAL_UART_ADAPTER_FIFO > 0U))
+#error HAL_UART_ADAPTER_FIFO should be 0 with HAL_UART_DMA_ENABLE.
+#endif
+
+/* The USARTn RX and TX requests are bound to the DMA channels 2n and 2n+1. */
+#define HAL_UART_DMA_RX_CHANNEL(instance) ((uint32_t)(instance)*2U)
+#define HAL_UART_DMA_TX_CHANNEL(instance) ((uint32_t)(instance)*2U + 1U)
+
+/* The receive errors reported by the interrupt, the data itself is moved by DMA. */
+#define HAL_UART_DMA_ERROR_FLAGS                                                                  \
+    (USART_STAT_OVERRUNINT_MASK | USART_STAT_FRAMERRINT_MASK | USART_STAT_PARITYERRINT_MASK | \
+     USART_STAT_RXNOISEINT_MASK)
+#endif
+
+#if (defined(HAL_UART_ADDRESS_MATCH) && (HAL_UART_ADDRESS_MATCH > 0U))
+#if ((defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U)) || \
+     (defined(HAL_UART_TRANSFER_MODE) && (HAL_UART_TRANSFER_MODE > 0U)))
+#error HAL_UART_ADDRESS_MATCH is only supported by the non-transactional interrupt API.
+#endif
+#endif
+
 #ifndef NDEBUG
 #if (defined(DEBUG_CONSOLE_ASSERT_DISABLE) && (DEBUG_CONSOLE_ASSERT_DISABLE > 0U))
 #undef assert
@@ -21,6 +52,12 @@
 #endif
 #endif
 
+#if (defined(HAL_UART_ISR_STATIC_BINDING) && (HAL_UART_ISR_STATIC_BINDING > 0U))
+#define HAL_UART_ISR_INLINE __STATIC_FORCEINLINE
+#else
+#define HAL_UART_ISR_INLINE static
+#endif
+
 #if (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U))
 /*! @brief uart RX state structure. */
 typedef struct _hal_uart_receive_state
@@ -46,6 +83,10 @@ typedef struct _hal_uart_state
     void *callbackParam;
 #if (defined(HAL_UART_TRANSFER_MODE) && (HAL_UART_TRANSFER_MODE > 0U))
     usart_handle_t hardwareHandle;
+#endif
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+    dma_handle_t rxDmaHandle;
+    dma_handle_t txDmaHandle;
 #endif
     hal_uart_receive_state_t rx;
     hal_uart_send_state_t tx;
@@ -62,6 +103,17 @@ typedef struct _hal_uart_state
  ******************************************************************************/
 static USART_Type *const s_UsartAdapterBase[] = USART_BASE_PTRS;
 
+#if !(defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+/* The system FIFO entries of each instance, the pools are shared by all the instances. */
+static const uint8_t s_UartFifoSize[sizeof(s_UsartAdapterBase) / sizeof(USART_Type *)] = HAL_UART_ADAPTER_FIFO_SIZE;
+#endif
+
+#if (defined(HAL_UART_CLOCK_NOTIFY) && (HAL_UART_CLOCK_NOTIFY > 0U))
+/* The subscriptions to the clock changes, and the baud rates set again on a change. */
+static clock_notify_handle_t s_UartClockNotify[sizeof(s_UsartAdapterBase) / sizeof(USART_Type *)];
+static uint32_t s_UartBaudRate[sizeof(s_UsartAdapterBase) / sizeof(USART_Type *)];
+#endif
+
 #if (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U))
 
 #if !(defined(HAL_UART_TRANSFER_MODE) && (HAL_UART_TRANSFER_MODE > 0U))
@@ -71,12 +123,53 @@ static const IRQn_Type s_UsartIRQ[] = USART_IRQS;
 static hal_uart_state_t *s_UartState[sizeof(s_UsartAdapterBase) / sizeof(USART_Type *)];
 #endif
 
+#if (defined(HAL_UART_ADDRESS_MATCH) && (HAL_UART_ADDRESS_MATCH > 0U))
+/* Whether the multi-drop mode is enabled, and whether the node is addressed by the current message. */
+static bool s_UartAddressMatchEnabled[sizeof(s_UsartAdapterBase) / sizeof(USART_Type *)];
+static bool s_UartAddressMatched[sizeof(s_UsartAdapterBase) / sizeof(USART_Type *)];
+#endif
+
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+/* The ping-pong descriptors of the receive ring. */
+SDK_ALIGN(static dma_descriptor_t s_UartRxDmaDescriptor[sizeof(s_UsartAdapterBase) / sizeof(USART_Type *)][2],
+          FSL_FEATURE_DMA_LINK_DESCRIPTOR_ALIGN_SIZE);
+#endif
+
 #endif
 
 /*******************************************************************************
  * Code
  ******************************************************************************/
 
+#if !(defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+/* Get the system FIFO entries of the instance, the ones given by VFIFO_ApplyPartition are kept. */
+static void HAL_UartGetFifoSize(uint8_t instance, uint8_t *rxSize, uint8_t *txSize)
+{
+    uint32_t fifoConfig = 0U;
+
+    /* The system FIFO is partitioned already if it is clocked and the instance has entries. */
+    if (0U != (SYSCON->AHBCLKCTRL[1] & SYSCON_AHBCLKCTRL_FIFO_MASK))
+    {
+        fifoConfig = VFIFO->FIFOCFGUSART[instance];
+    }
+    if (0U == fifoConfig)
+    {
+        fifoConfig = VFIFO_FIFOCFGUSART_RXSIZE(s_UartFifoSize[instance]) |
+                     VFIFO_FIFOCFGUSART_TXSIZE(s_UartFifoSize[instance]);
+    }
+    *rxSize = (uint8_t)((fifoConfig & VFIFO_FIFOCFGUSART_RXSIZE_MASK) >> VFIFO_FIFOCFGUSART_RXSIZE_SHIFT);
+    *txSize = (uint8_t)((fifoConfig & VFIFO_FIFOCFGUSART_TXSIZE_MASK) >> VFIFO_FIFOCFGUSART_TXSIZE_SHIFT);
+}
+#endif
+
+#if (defined(HAL_UART_ADAPTER_FIFO) && (HAL_UART_ADAPTER_FIFO > 0U))
+/* Lower a FIFO threshold below the FIFO size. */
+static uint8_t HAL_UartGetFifoThreshold(uint32_t size, uint32_t threshold)
+{
+    return (uint8_t)((threshold < size) ? threshold : (size - 1U));
+}
+#endif
+
 #if (defined(HAL_UART_TRANSFER_MODE) && (HAL_UART_TRANSFER_MODE > 0U))
 static hal_uart_status_t HAL_UartGetStatus(status_t status)
 {
@@ -152,10 +245,242 @@ static void HAL_UartCallback(USART_Type *base, usart_handle_t *handle, status_t
 
 #else
 
-static void HAL_UartInterruptHandle(uint8_t instance)
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+static void HAL_UartDmaRxCallback(dma_handle_t *handle, void *param, bool transferDone, uint32_t intmode)
+{
+    hal_uart_state_t *uartHandle = (hal_uart_state_t *)param;
+
+    /* A half of the ring is filled, the receiving carries on with the other half. */
+    if ((transferDone) && (NULL != uartHandle->rx.buffer) && (uartHandle->callback))
+    {
+        uartHandle->callback(uartHandle, kStatus_HAL_UartRxIdle, uartHandle->callbackParam);
+    }
+}
+
+/* Submit the next chunk of the send, a descriptor moves up to DMA_MAX_TRANSFER_COUNT bytes. */
+static void HAL_UartDmaSendChunk(hal_uart_state_t *uartHandle)
+{
+    uint32_t length = uartHandle->tx.bufferLength - uartHandle->tx.bufferSofar;
+
+    if (length > DMA_MAX_TRANSFER_COUNT)
+    {
+        length = DMA_MAX_TRANSFER_COUNT;
+    }
+    DMA_SubmitChannelTransferParameter(&uartHandle->txDmaHandle, DMA_CHANNEL_XFER(0U, 1U, 1U, 0U, 1U, 1U, 0U, length),
+                                       (void *)&uartHandle->tx.buffer[uartHandle->tx.bufferSofar],
+                                       (void *)&s_UsartAdapterBase[uartHandle->instance]->TXDAT, NULL);
+    uartHandle->tx.bufferSofar += length;
+    DMA_StartTransfer(&uartHandle->txDmaHandle);
+}
+
+static void HAL_UartDmaTxCallback(dma_handle_t *handle, void *param, bool transferDone, uint32_t intmode)
+{
+    hal_uart_state_t *uartHandle = (hal_uart_state_t *)param;
+
+    if ((!transferDone) || (NULL == uartHandle->tx.buffer))
+    {
+        return;
+    }
+
+    if (uartHandle->tx.bufferSofar < uartHandle->tx.bufferLength)
+    {
+        HAL_UartDmaSendChunk(uartHandle);
+        return;
+    }
+
+    uartHandle->tx.buffer = NULL;
+    if (uartHandle->callback)
+    {
+        uartHandle->callback(uartHandle, kStatus_HAL_UartTxIdle, uartHandle->callbackParam);
+    }
+}
+
+HAL_UART_ISR_INLINE void HAL_UartInterruptHandle(uint8_t instance)
+{
+    hal_uart_state_t *uartHandle = s_UartState[instance];
+    uint32_t status;
+
+    /* The data is moved by DMA, only the receive errors are left to the interrupt. */
+    status = USART_GetStatusFlags(s_UsartAdapterBase[instance]) & HAL_UART_DMA_ERROR_FLAGS;
+    USART_ClearStatusFlags(s_UsartAdapterBase[instance], status);
+    if ((0U != status) && (NULL != uartHandle) && (uartHandle->callback))
+    {
+        uartHandle->callback(uartHandle, kStatus_HAL_UartProtocolError, uartHandle->callbackParam);
+    }
+}
+#elif (defined(HAL_UART_ADAPTER_FIFO) && (HAL_UART_ADAPTER_FIFO > 0U))
+#if (defined(HAL_UART_ADDRESS_MATCH) && (HAL_UART_ADDRESS_MATCH > 0U))
+static void HAL_UartSetRxFifoThreshold(uint8_t instance, uint32_t threshold)
+{
+    VFIFO->USART[instance].CFGUSART = (VFIFO->USART[instance].CFGUSART & ~VFIFO_USART_CFGUSART_RXTHRESHOLD_MASK) |
+                                      VFIFO_USART_CFGUSART_RXTHRESHOLD(threshold);
+}
+
+HAL_UART_ISR_INLINE bool HAL_UartFilterAddress(uint8_t instance, uint32_t data)
+{
+    bool matched = s_UartAddressMatched[instance];
+    uint32_t threshold;
+    bool keep;
+
+    if (!s_UartAddressMatchEnabled[instance])
+    {
+        return true;
+    }
+
+    keep = USART_FilterMatchAddress(s_UsartAdapterBase[instance], data, &s_UartAddressMatched[instance]);
+    if (matched != s_UartAddressMatched[instance])
+    {
+        /* While muted, the address is taken at once, the detection would drop the data following it otherwise. */
+        threshold = 0U;
+        if (s_UartAddressMatched[instance])
+        {
+            threshold = (VFIFO->FIFOCFGUSART[instance] & VFIFO_FIFOCFGUSART_RXSIZE_MASK) >>
+                        VFIFO_FIFOCFGUSART_RXSIZE_SHIFT;
+            threshold = HAL_UartGetFifoThreshold(threshold, HAL_UART_ADAPTER_RX_FIFO_THRESHOLD);
+        }
+        HAL_UartSetRxFifoThreshold(instance, threshold);
+    }
+
+    return keep;
+}
+#endif
+
+static void HAL_UartEnableRxInterrupts(uint8_t instance)
+{
+    VFIFO->USART[instance].CTLSETUSART = kUSART_RxFifoThresholdInterruptEnable | kUSART_RxFifoTimeOutInterruptEnable;
+    USART_EnableInterrupts(s_UsartAdapterBase[instance], kUSART_HardwareOverRunInterruptEnable);
+}
+
+HAL_UART_ISR_INLINE void HAL_UartDisableRxInterrupts(uint8_t instance)
+{
+    VFIFO->USART[instance].CTLCLRUSART = kUSART_RxFifoThresholdInterruptEnable | kUSART_RxFifoTimeOutInterruptEnable;
+    USART_DisableInterrupts(s_UsartAdapterBase[instance], kUSART_HardwareOverRunInterruptEnable);
+}
+
+static void HAL_UartEnableTxInterrupts(uint8_t instance)
+{
+    VFIFO->USART[instance].CTLSETUSART = kUSART_TxFifoThresholdInterruptEnable;
+}
+
+HAL_UART_ISR_INLINE void HAL_UartDisableTxInterrupts(uint8_t instance)
+{
+    VFIFO->USART[instance].CTLCLRUSART = kUSART_TxFifoThresholdInterruptEnable;
+}
+
+HAL_UART_ISR_INLINE void HAL_UartInterruptHandle(uint8_t instance)
+{
+    hal_uart_state_t *uartHandle = s_UartState[instance];
+    uint32_t fifoStatus;
+    uint32_t enabled;
+    uint32_t count;
+    uint32_t data;
+
+    if (NULL == uartHandle)
+    {
+        return;
+    }
+
+#if (defined(HAL_UART_ADAPTER_FIFO_TELEMETRY) && (HAL_UART_ADAPTER_FIFO_TELEMETRY > 0U))
+    /* The RX FIFO is at its fullest before the burst is drained. */
+    VFIFO_SamplePeripheralFill((vfifo_instance_t)(kVFIFO_Usart0 + instance));
+#endif
+
+    /* The counts are sampled once, the data registers are accessed directly to keep the burst short. */
+    fifoStatus = VFIFO->USART[instance].STATUSART;
+    enabled    = VFIFO->USART[instance].CTLSETUSART;
+
+    if (0U != (enabled & kUSART_RxFifoThresholdInterruptEnable))
+    {
+        count = (fifoStatus & VFIFO_USART_STATUSART_RXCOUNT_MASK) >> VFIFO_USART_STATUSART_RXCOUNT_SHIFT;
+        /* The callback could start the next receiving, then the rest of the burst goes to the new buffer. */
+        while ((0U != count) && (NULL != uartHandle->rx.buffer))
+        {
+            data = VFIFO->USART[instance].RXDATUSART;
+            count--;
+#if (defined(HAL_UART_ADDRESS_MATCH) && (HAL_UART_ADDRESS_MATCH > 0U))
+            if (!HAL_UartFilterAddress(instance, data))
+            {
+                continue;
+            }
+#endif
+            uartHandle->rx.buffer[uartHandle->rx.bufferSofar++] = (uint8_t)data;
+            if (uartHandle->rx.bufferSofar >= uartHandle->rx.bufferLength)
+            {
+                HAL_UartDisableRxInterrupts(instance);
+                uartHandle->rx.buffer = NULL;
+                if (uartHandle->callback)
+                {
+                    uartHandle->callback(uartHandle, kStatus_HAL_UartRxIdle, uartHandle->callbackParam);
+                }
+            }
+        }
+    }
+    if (0U != (fifoStatus & kUSART_RxFifoTimeOutFlag))
+    {
+        VFIFO->USART[instance].STATUSART = kUSART_RxFifoTimeOutFlag;
+    }
+
+    if (0U != (enabled & kUSART_TxFifoThresholdInterruptEnable))
+    {
+        count = (fifoStatus & VFIFO_USART_STATUSART_TXCOUNT_MASK) >> VFIFO_USART_STATUSART_TXCOUNT_SHIFT;
+        while ((0U != count) && (NULL != uartHandle->tx.buffer))
+        {
+            VFIFO->USART[instance].TXDATUSART = uartHandle->tx.buffer[uartHandle->tx.bufferSofar++];
+            count--;
+            if (uartHandle->tx.bufferSofar >= uartHandle->tx.bufferLength)
+            {
+                HAL_UartDisableTxInterrupts(instance);
+                uartHandle->tx.buffer = NULL;
+                if (uartHandle->callback)
+                {
+                    uartHandle->callback(uartHandle, kStatus_HAL_UartTxIdle, uartHandle->callbackParam);
+                }
+            }
+        }
+    }
+
+    USART_ClearStatusFlags(s_UsartAdapterBase[instance], USART_GetStatusFlags(s_UsartAdapterBase[instance]));
+}
+#else
+#if (defined(HAL_UART_ADDRESS_MATCH) && (HAL_UART_ADDRESS_MATCH > 0U))
+HAL_UART_ISR_INLINE bool HAL_UartFilterAddress(uint8_t instance, uint32_t data)
+{
+    if (!s_UartAddressMatchEnabled[instance])
+    {
+        return true;
+    }
+
+    return USART_FilterMatchAddress(s_UsartAdapterBase[instance], data, &s_UartAddressMatched[instance]);
+}
+#endif
+
+static void HAL_UartEnableRxInterrupts(uint8_t instance)
+{
+    USART_EnableInterrupts(s_UsartAdapterBase[instance],
+                           kUSART_RxReadyInterruptEnable | kUSART_HardwareOverRunInterruptEnable);
+}
+
+HAL_UART_ISR_INLINE void HAL_UartDisableRxInterrupts(uint8_t instance)
+{
+    USART_DisableInterrupts(s_UsartAdapterBase[instance],
+                            kUSART_RxReadyInterruptEnable | kUSART_HardwareOverRunInterruptEnable);
+}
+
+static void HAL_UartEnableTxInterrupts(uint8_t instance)
+{
+    USART_EnableInterrupts(s_UsartAdapterBase[instance], kUSART_TxReadyInterruptEnable);
+}
+
+HAL_UART_ISR_INLINE void HAL_UartDisableTxInterrupts(uint8_t instance)
+{
+    USART_DisableInterrupts(s_UsartAdapterBase[instance], kUSART_TxReadyInterruptEnable);
+}
+
+HAL_UART_ISR_INLINE void HAL_UartInterruptHandle(uint8_t instance)
 {
     hal_uart_state_t *uartHandle = s_UartState[instance];
     uint32_t status;
+    uint32_t data;
 
     if (NULL == uartHandle)
     {
@@ -170,11 +495,17 @@ static void HAL_UartInterruptHandle(uint8_t instance)
     {
         if (uartHandle->rx.buffer)
         {
-            uartHandle->rx.buffer[uartHandle->rx.bufferSofar++] = USART_ReadByte(s_UsartAdapterBase[instance]);
+            /* The RX goes through the system FIFO and the TX through TXDAT, see HAL_UartInit. */
+            data = VFIFO->USART[instance].RXDATUSART;
+#if (defined(HAL_UART_ADDRESS_MATCH) && (HAL_UART_ADDRESS_MATCH > 0U))
+            if (HAL_UartFilterAddress(instance, data))
+#endif
+            {
+                uartHandle->rx.buffer[uartHandle->rx.bufferSofar++] = (uint8_t)data;
+            }
             if (uartHandle->rx.bufferSofar >= uartHandle->rx.bufferLength)
             {
-                USART_DisableInterrupts(s_UsartAdapterBase[instance],
-                                        kUSART_RxReadyInterruptEnable | kUSART_HardwareOverRunInterruptEnable);
+                HAL_UartDisableRxInterrupts(instance);
                 uartHandle->rx.buffer = NULL;
                 if (uartHandle->callback)
                 {
@@ -190,10 +521,10 @@ static void HAL_UartInterruptHandle(uint8_t instance)
     {
         if (uartHandle->tx.buffer)
         {
-            USART_WriteByte(s_UsartAdapterBase[instance], uartHandle->tx.buffer[uartHandle->tx.bufferSofar++]);
+            s_UsartAdapterBase[instance]->TXDAT = uartHandle->tx.buffer[uartHandle->tx.bufferSofar++];
             if (uartHandle->tx.bufferSofar >= uartHandle->tx.bufferLength)
             {
-                USART_DisableInterrupts(s_UsartAdapterBase[uartHandle->instance], kUSART_TxReadyInterruptEnable);
+                HAL_UartDisableTxInterrupts(instance);
                 uartHandle->tx.buffer = NULL;
                 if (uartHandle->callback)
                 {
@@ -207,10 +538,39 @@ static void HAL_UartInterruptHandle(uint8_t instance)
     USART_ClearStatusFlags(s_UsartAdapterBase[instance], status);
 #endif
 }
+#endif /* HAL_UART_DMA_ENABLE */
 #endif
 
 #endif
 
+#if (defined(HAL_UART_CLOCK_NOTIFY) && (HAL_UART_CLOCK_NOTIFY > 0U))
+static void HAL_UartClockChanged(clock_notify_handle_t *handle, uint32_t changedMask)
+{
+    uint32_t instance = (uint32_t)(handle - &s_UartClockNotify[0]);
+    USART_Type *base  = s_UsartAdapterBase[instance];
+    uint32_t srcClock_Hz;
+
+#if (defined(HAL_UART_FRACTIONAL_BAUDRATE) && (HAL_UART_FRACTIONAL_BAUDRATE > 0U))
+    if (0U == (base->CFG & USART_CFG_SYNCEN_MASK))
+    {
+        srcClock_Hz = CLOCK_GetAsyncApbClkFreq();
+        if (0U != srcClock_Hz)
+        {
+            (void)USART_SetFractionalBaudRate(base, s_UartBaudRate[instance], srcClock_Hz, NULL);
+        }
+        return;
+    }
+#endif
+
+    /* The clock could be stopped, the baud rate is then set once it runs again. */
+    srcClock_Hz = CLOCK_GetUsartClkFreq();
+    if (0U != srcClock_Hz)
+    {
+        (void)USART_SetBaudRate(base, s_UartBaudRate[instance], srcClock_Hz);
+    }
+}
+#endif
+
 hal_uart_status_t HAL_UartInit(hal_uart_handle_t handle, hal_uart_config_t *config)
 {
     hal_uart_state_t *uartHandle;
@@ -228,6 +588,10 @@ hal_uart_status_t HAL_UartInit(hal_uart_handle_t handle, hal_uart_config_t *conf
 
     USART_GetDefaultConfig(&usartConfig);
     usartConfig.baudRate_Bps = config->baudRate_Bps;
+#if (defined(HAL_UART_FRACTIONAL_BAUDRATE) && (HAL_UART_FRACTIONAL_BAUDRATE > 0U))
+    /* The FRG is searched with the dividers, the rates out of reach of the integer divider are not rejected. */
+    usartConfig.enableFractionalBaudRate = true;
+#endif
 
     if (kHAL_UartParityEven == config->parityMode)
     {
@@ -250,10 +614,71 @@ hal_uart_status_t HAL_UartInit(hal_uart_handle_t handle, hal_uart_config_t *conf
     {
         usartConfig.stopBitCount = kUSART_OneStopBit;
     }
-    usartConfig.enableRx                = config->enableRx;
-    usartConfig.enableTx                = config->enableTx;
+    usartConfig.enableRx                  = config->enableRx;
+    usartConfig.enableTx                  = config->enableTx;
+    usartConfig.enableHardwareFlowControl = (bool)config->enableTxCTS;
+
+    if (kHAL_UartSyncModeMaster == config->syncMode)
+    {
+        usartConfig.syncMode = kUSART_SyncModeMaster;
+    }
+    else if (kHAL_UartSyncModeSlave == config->syncMode)
+    {
+        usartConfig.syncMode = kUSART_SyncModeSlave;
+    }
+    else
+    {
+        usartConfig.syncMode = kUSART_SyncModeDisabled;
+    }
+    usartConfig.clockPolarity = (kHAL_UartRxSampleOnRisingEdge == config->clockPolarity) ?
+                                    kUSART_RxSampleOnRisingEdge :
+                                    kUSART_RxSampleOnFallingEdge;
+    usartConfig.enableContinuousSCLK = (bool)config->enableContinuousClock;
+
+    if (kHAL_UartDriverEnableDisabled != config->driverEnable)
+    {
+        /* RTS is either the flow control or the driver enable. */
+        assert(0U == config->enableRxRTS);
+        if (0U != config->enableRxRTS)
+        {
+            return kStatus_HAL_UartError;
+        }
+        usartConfig.outputEnable = (kHAL_UartDriverEnableActiveHigh == config->driverEnable) ?
+                                       kUSART_OutputEnableActiveHigh :
+                                       kUSART_OutputEnableActiveLow;
+    }
+
+    if (0U != config->enableAddressMatch)
+    {
+#if (defined(HAL_UART_ADDRESS_MATCH) && (HAL_UART_ADDRESS_MATCH > 0U)) && \
+    (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U))
+        usartConfig.bitCountPerChar = kUSART_9BitsPerChar;
+#else
+        /* The receiver is only opened again after a matching address by the interrupt handler. */
+        return kStatus_HAL_UartError;
+#endif
+    }
+#if (defined(HAL_UART_ADAPTER_FIFO) && (HAL_UART_ADAPTER_FIFO > 0U))
+    /* Only the entries of this instance are resized, the other instances keep theirs. */
+    HAL_UartGetFifoSize(config->instance, &usartConfig.fifoConfig.rxFifoSize, &usartConfig.fifoConfig.txFifoSize);
+    assert((usartConfig.fifoConfig.rxFifoSize > 0U) && (usartConfig.fifoConfig.txFifoSize > 0U));
+    usartConfig.fifoConfig.enableTxFifo = true;
+    usartConfig.fifoConfig.enableRxFifo = true;
+    usartConfig.fifoConfig.txFifoThreshold =
+        HAL_UartGetFifoThreshold(usartConfig.fifoConfig.txFifoSize, HAL_UART_ADAPTER_TX_FIFO_THRESHOLD);
+    usartConfig.fifoConfig.rxFifoThreshold =
+        HAL_UartGetFifoThreshold(usartConfig.fifoConfig.rxFifoSize, HAL_UART_ADAPTER_RX_FIFO_THRESHOLD);
+#elif (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+    usartConfig.fifoConfig.enableTxFifo = false;
+    usartConfig.fifoConfig.enableRxFifo = false;
+#else
+    /* The receiver reads the system FIFO, only the entries of this instance are resized. */
+    HAL_UartGetFifoSize(config->instance, &usartConfig.fifoConfig.rxFifoSize, &usartConfig.fifoConfig.txFifoSize);
+    assert(usartConfig.fifoConfig.rxFifoSize > 0U);
     usartConfig.fifoConfig.enableTxFifo = false;
     usartConfig.fifoConfig.enableRxFifo = true;
+    usartConfig.fifoConfig.txFifoSize   = 0U;
+#endif
 
     status = USART_Init(s_UsartAdapterBase[config->instance], &usartConfig, config->srcClock_Hz);
 
@@ -262,6 +687,30 @@ hal_uart_status_t HAL_UartInit(hal_uart_handle_t handle, hal_uart_config_t *conf
         return HAL_UartGetStatus(status);
     }
 
+#if (defined(HAL_UART_ADAPTER_FIFO) && (HAL_UART_ADAPTER_FIFO > 0U))
+    /* The timeout passes the tail of a burst, which does not reach the RX threshold, to the receiver. */
+    VFIFO->USART[config->instance].CFGUSART =
+        (VFIFO->USART[config->instance].CFGUSART &
+         ~(VFIFO_USART_CFGUSART_TIMEOUTBASE_MASK | VFIFO_USART_CFGUSART_TIMEOUTVALUE_MASK)) |
+        VFIFO_USART_CFGUSART_TIMEOUTBASE(HAL_UART_ADAPTER_RX_FIFO_TIMEOUT_BASE) |
+        VFIFO_USART_CFGUSART_TIMEOUTVALUE(HAL_UART_ADAPTER_RX_FIFO_TIMEOUT_VALUE);
+#endif
+
+#if (defined(HAL_UART_ADDRESS_MATCH) && (HAL_UART_ADDRESS_MATCH > 0U)) && \
+    (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U))
+    s_UartAddressMatchEnabled[config->instance] = (0U != config->enableAddressMatch);
+    s_UartAddressMatched[config->instance]      = false;
+    if (0U != config->enableAddressMatch)
+    {
+        /* The receiver is muted by the hardware until the address of the node is received. */
+        USART_SetMatchAddress(s_UsartAdapterBase[config->instance], config->matchAddress);
+        USART_EnableMatchAddress(s_UsartAdapterBase[config->instance], true);
+#if (defined(HAL_UART_ADAPTER_FIFO) && (HAL_UART_ADAPTER_FIFO > 0U))
+        HAL_UartSetRxFifoThreshold(config->instance, 0U);
+#endif
+    }
+#endif
+
     uartHandle           = (hal_uart_state_t *)handle;
     uartHandle->instance = config->instance;
 
@@ -272,11 +721,50 @@ hal_uart_status_t HAL_UartInit(hal_uart_handle_t handle, hal_uart_config_t *conf
                                (usart_transfer_callback_t)HAL_UartCallback, handle);
 #else
     s_UartState[uartHandle->instance] = uartHandle;
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+    /* The DMA could be shared with other modules, it is only initialized by the first user. */
+    if (!DMA_IsInitialized(DMA0))
+    {
+        DMA_Init(DMA0);
+    }
+    if (kStatus_Success != DMA_RequestChannel(DMA0, HAL_UART_DMA_RX_CHANNEL(config->instance)))
+    {
+        return kStatus_HAL_UartError;
+    }
+    if (kStatus_Success != DMA_RequestChannel(DMA0, HAL_UART_DMA_TX_CHANNEL(config->instance)))
+    {
+        DMA_ReleaseChannel(DMA0, HAL_UART_DMA_RX_CHANNEL(config->instance));
+        return kStatus_HAL_UartError;
+    }
+    uartHandle->rx.buffer = NULL;
+    uartHandle->tx.buffer = NULL;
+    DMA_CreateHandle(&uartHandle->rxDmaHandle, DMA0, HAL_UART_DMA_RX_CHANNEL(config->instance));
+    DMA_SetCallback(&uartHandle->rxDmaHandle, HAL_UartDmaRxCallback, uartHandle);
+    DMA_EnableChannelPeriphRq(DMA0, HAL_UART_DMA_RX_CHANNEL(config->instance));
+    DMA_CreateHandle(&uartHandle->txDmaHandle, DMA0, HAL_UART_DMA_TX_CHANNEL(config->instance));
+    DMA_SetCallback(&uartHandle->txDmaHandle, HAL_UartDmaTxCallback, uartHandle);
+    DMA_EnableChannelPeriphRq(DMA0, HAL_UART_DMA_TX_CHANNEL(config->instance));
+    /* The receive errors are not seen by the DMA, they are reported by the interrupt. */
+    USART_EnableInterrupts(s_UsartAdapterBase[config->instance],
+                           kUSART_HardwareOverRunInterruptEnable | kUSART_FramErrorInterruptEnable |
+                               kUSART_ParityErrorInterruptEnable | kUSART_RxNoiseInterruptEnable);
+    NVIC_SetPriority((IRQn_Type)s_UsartIRQ[config->instance], HAL_UART_ISR_PRIORITY);
+    EnableIRQ(s_UsartIRQ[config->instance]);
+#else
     /* Enable interrupt in NVIC. */
     NVIC_SetPriority((IRQn_Type)s_UsartIRQ[config->instance], HAL_UART_ISR_PRIORITY);
     EnableIRQ(s_UsartIRQ[config->instance]);
 #endif
+#endif
 
+#endif
+
+#if (defined(HAL_UART_CLOCK_NOTIFY) && (HAL_UART_CLOCK_NOTIFY > 0U))
+    s_UartBaudRate[config->instance]              = config->baudRate_Bps;
+    s_UartClockNotify[config->instance].clockMask = CLOCK_NOTIFY_MASK(kCLOCK_AsyncApbClk);
+    s_UartClockNotify[config->instance].callback  = HAL_UartClockChanged;
+    s_UartClockNotify[config->instance].userData  = NULL;
+    CLOCK_RegisterNotify(&s_UartClockNotify[config->instance]);
 #endif
 
     return kStatus_HAL_UartSuccess;
@@ -290,6 +778,25 @@ hal_uart_status_t HAL_UartDeinit(hal_uart_handle_t handle)
 
     uartHandle = (hal_uart_state_t *)handle;
 
+#if (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U))
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+    DisableIRQ(s_UsartIRQ[uartHandle->instance]);
+    DMA_AbortTransfer(&uartHandle->rxDmaHandle);
+    DMA_AbortTransfer(&uartHandle->txDmaHandle);
+    DMA_DisableChannel(DMA0, HAL_UART_DMA_RX_CHANNEL(uartHandle->instance));
+    DMA_DisableChannel(DMA0, HAL_UART_DMA_TX_CHANNEL(uartHandle->instance));
+    DMA_ReleaseChannel(DMA0, HAL_UART_DMA_RX_CHANNEL(uartHandle->instance));
+    /* The release forgets the DMA handles, so that a late channel interrupt does not reach the freed state. */
+    DMA_ReleaseChannel(DMA0, HAL_UART_DMA_TX_CHANNEL(uartHandle->instance));
+    uartHandle->rx.buffer = NULL;
+    uartHandle->tx.buffer = NULL;
+#endif
+#endif
+
+#if (defined(HAL_UART_CLOCK_NOTIFY) && (HAL_UART_CLOCK_NOTIFY > 0U))
+    CLOCK_UnregisterNotify(&s_UartClockNotify[uartHandle->instance]);
+#endif
+
     USART_Deinit(s_UsartAdapterBase[uartHandle->instance]);
 
 #if (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U))
@@ -346,6 +853,84 @@ hal_uart_status_t HAL_UartSendBlocking(hal_uart_handle_t handle, const uint8_t *
     return kStatus_HAL_UartSuccess;
 }
 
+hal_uart_status_t HAL_UartEnterLowpower(hal_uart_handle_t handle)
+{
+    hal_uart_state_t *uartHandle;
+    assert(handle);
+
+    uartHandle = (hal_uart_state_t *)handle;
+
+#if (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U)) && \
+    !(defined(HAL_UART_TRANSFER_MODE) && (HAL_UART_TRANSFER_MODE > 0U)) &&                 \
+    !(defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+    if ((NULL != uartHandle->tx.buffer) ||
+#if (defined(HAL_UART_ADAPTER_FIFO) && (HAL_UART_ADAPTER_FIFO > 0U))
+        (0U == (VFIFO->USART[uartHandle->instance].STATUSART & VFIFO_USART_STATUSART_TXEMPTY_MASK)) ||
+#endif
+        (0U == (s_UsartAdapterBase[uartHandle->instance]->STAT & USART_STAT_TXIDLE_MASK)))
+    {
+        return kStatus_HAL_UartTxBusy;
+    }
+
+    /* The start interrupt is a wake-up source of the deep sleep mode, it is disabled again by the exit. */
+    USART_ClearStatusFlags(s_UsartAdapterBase[uartHandle->instance], kUSART_RxStartFlag);
+    USART_EnableInterrupts(s_UsartAdapterBase[uartHandle->instance], kUSART_RxStartInterruptEnable);
+    EnableDeepSleepIRQ(s_UsartIRQ[uartHandle->instance]);
+
+    return kStatus_HAL_UartSuccess;
+#else
+    (void)uartHandle;
+    return kStatus_HAL_UartError;
+#endif
+}
+
+hal_uart_status_t HAL_UartExitLowpower(hal_uart_handle_t handle)
+{
+    hal_uart_state_t *uartHandle;
+    assert(handle);
+
+    uartHandle = (hal_uart_state_t *)handle;
+
+#if (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U)) && \
+    !(defined(HAL_UART_TRANSFER_MODE) && (HAL_UART_TRANSFER_MODE > 0U)) &&                 \
+    !(defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+    USART_DisableInterrupts(s_UsartAdapterBase[uartHandle->instance], kUSART_RxStartInterruptEnable);
+    USART_ClearStatusFlags(s_UsartAdapterBase[uartHandle->instance], kUSART_RxStartFlag);
+    /* Only the wake-up is disabled, the interrupt is still used by the receiving. */
+    DisableDeepSleepIRQ(s_UsartIRQ[uartHandle->instance]);
+    EnableIRQ(s_UsartIRQ[uartHandle->instance]);
+#else
+    (void)uartHandle;
+#endif
+
+    return kStatus_HAL_UartSuccess;
+}
+
+hal_uart_status_t HAL_UartSendAddress(hal_uart_handle_t handle, uint8_t address)
+{
+    hal_uart_state_t *uartHandle;
+    assert(handle);
+
+    uartHandle = (hal_uart_state_t *)handle;
+
+    if (USART_CFG_DATALEN(kUSART_9BitsPerChar) !=
+        (s_UsartAdapterBase[uartHandle->instance]->CFG & USART_CFG_DATALEN_MASK))
+    {
+        return kStatus_HAL_UartError;
+    }
+
+#if (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U))
+    if (uartHandle->tx.buffer)
+    {
+        return kStatus_HAL_UartTxBusy;
+    }
+#endif
+
+    USART_WriteAddressBlocking(s_UsartAdapterBase[uartHandle->instance], address);
+
+    return kStatus_HAL_UartSuccess;
+}
+
 #if (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U))
 
 #if (defined(HAL_UART_TRANSFER_MODE) && (HAL_UART_TRANSFER_MODE > 0U))
@@ -491,11 +1076,25 @@ hal_uart_status_t HAL_UartReceiveNonBlocking(hal_uart_handle_t handle, uint8_t *
         return kStatus_HAL_UartRxBusy;
     }
 
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+    /* Each half of the ring is moved by one of the ping-pong descriptors. */
+    assert(0U == (length & 1U));
+    assert((length / 2U) < DMA_MAX_TRANSFER_COUNT);
+
     uartHandle->rx.bufferLength = length;
     uartHandle->rx.bufferSofar  = 0;
     uartHandle->rx.buffer       = data;
-    USART_EnableInterrupts(s_UsartAdapterBase[uartHandle->instance],
-                           kUSART_RxReadyInterruptEnable | kUSART_HardwareOverRunInterruptEnable);
+    DMA_SetupPingPongDescriptors(&s_UartRxDmaDescriptor[uartHandle->instance][0],
+                                 DMA_CHANNEL_XFER(0U, 0U, 0U, 0U, 1U, 0U, 1U, length / 2U),
+                                 (void *)&s_UsartAdapterBase[uartHandle->instance]->RXDAT, data);
+    DMA_SubmitChannelDescriptor(&uartHandle->rxDmaHandle, &s_UartRxDmaDescriptor[uartHandle->instance][0]);
+    DMA_StartTransfer(&uartHandle->rxDmaHandle);
+#else
+    uartHandle->rx.bufferLength = length;
+    uartHandle->rx.bufferSofar  = 0;
+    uartHandle->rx.buffer       = data;
+    HAL_UartEnableRxInterrupts(uartHandle->instance);
+#endif
     return kStatus_HAL_UartSuccess;
 }
 
@@ -516,7 +1115,11 @@ hal_uart_status_t HAL_UartSendNonBlocking(hal_uart_handle_t handle, uint8_t *dat
     uartHandle->tx.bufferLength = length;
     uartHandle->tx.bufferSofar  = 0;
     uartHandle->tx.buffer       = (volatile uint8_t *)data;
-    USART_EnableInterrupts(s_UsartAdapterBase[uartHandle->instance], kUSART_TxReadyInterruptEnable);
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+    HAL_UartDmaSendChunk(uartHandle);
+#else
+    HAL_UartEnableTxInterrupts(uartHandle->instance);
+#endif
     return kStatus_HAL_UartSuccess;
 }
 
@@ -531,7 +1134,16 @@ hal_uart_status_t HAL_UartGetReceiveCount(hal_uart_handle_t handle, uint32_t *re
 
     if (uartHandle->rx.buffer)
     {
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+        *reCount = DMA_GetPingPongOffset(&uartHandle->rxDmaHandle);
+        /* The end of the second half is the start of the ring. */
+        if (*reCount >= uartHandle->rx.bufferLength)
+        {
+            *reCount = 0U;
+        }
+#else
         *reCount = uartHandle->rx.bufferSofar;
+#endif
         return kStatus_HAL_UartSuccess;
     }
     return kStatus_HAL_UartError;
@@ -548,7 +1160,12 @@ hal_uart_status_t HAL_UartGetSendCount(hal_uart_handle_t handle, uint32_t *seCou
 
     if (uartHandle->tx.buffer)
     {
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+        *seCount = uartHandle->tx.bufferSofar -
+                   DMA_GetRemainingBytes(DMA0, HAL_UART_DMA_TX_CHANNEL(uartHandle->instance));
+#else
         *seCount = uartHandle->tx.bufferSofar;
+#endif
         return kStatus_HAL_UartSuccess;
     }
     return kStatus_HAL_UartError;
@@ -564,8 +1181,11 @@ hal_uart_status_t HAL_UartAbortReceive(hal_uart_handle_t handle)
 
     if (uartHandle->rx.buffer)
     {
-        USART_DisableInterrupts(s_UsartAdapterBase[uartHandle->instance],
-                                kUSART_RxReadyInterruptEnable | kUSART_HardwareOverRunInterruptEnable);
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+        DMA_AbortTransfer(&uartHandle->rxDmaHandle);
+#else
+        HAL_UartDisableRxInterrupts(uartHandle->instance);
+#endif
         uartHandle->rx.buffer = NULL;
     }
 
@@ -582,13 +1202,43 @@ hal_uart_status_t HAL_UartAbortSend(hal_uart_handle_t handle)
 
     if (uartHandle->tx.buffer)
     {
-        USART_DisableInterrupts(s_UsartAdapterBase[uartHandle->instance], kUSART_TxReadyInterruptEnable);
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+        DMA_AbortTransfer(&uartHandle->txDmaHandle);
+#else
+        HAL_UartDisableTxInterrupts(uartHandle->instance);
+#endif
         uartHandle->tx.buffer = NULL;
     }
 
     return kStatus_HAL_UartSuccess;
 }
 
+#if (defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+hal_uart_status_t HAL_UartDmaPauseReceive(hal_uart_handle_t handle, bool pause)
+{
+    hal_uart_state_t *uartHandle;
+    assert(handle);
+
+    uartHandle = (hal_uart_state_t *)handle;
+
+    /* The channel is stopped rather than its peripheral request cleared, without the request it would run on the
+     * software trigger and read RXDAT without waiting for the data. */
+    if (pause)
+    {
+        DMA_DisableChannel(DMA0, HAL_UART_DMA_RX_CHANNEL(uartHandle->instance));
+        while (DMA_ChannelIsBusy(DMA0, HAL_UART_DMA_RX_CHANNEL(uartHandle->instance)))
+        {
+        }
+    }
+    else
+    {
+        DMA_EnableChannel(DMA0, HAL_UART_DMA_RX_CHANNEL(uartHandle->instance));
+    }
+
+    return kStatus_HAL_UartSuccess;
+}
+#endif
+
 #endif
 
 #if (defined(HAL_UART_TRANSFER_MODE) && (HAL_UART_TRANSFER_MODE > 0U))
@@ -84,9 +84,134 @@ void SystemInit (void) {
    -- SystemCoreClockUpdate()
    ---------------------------------------------------------------------------- */
 
-void SystemCoreClockUpdate (void) {
+/* Decode the PLL pre divider N from its NDEC encoding */
+static uint32_t pllDecodeN (uint32_t ndec) {
+  uint32_t x = 0x080U;
+  uint32_t i;
+
+  switch (ndec) {
+    case 0x3FFU: return 1U;
+    case 0x302U: return 1U;
+    case 0x202U: return 2U;
+    default:     break;
+  }
+  for (i = 0x100U; i >= 3U; i--) {
+    x = (((x ^ (x >> 2U) ^ (x >> 3U) ^ (x >> 4U)) & 1U) << 7U) | ((x >> 1U) & 0x7FU);
+    if (x == ndec) {
+      return i;
+    }
+  }
+  return 1U;
+}
+
+/* Decode the PLL post divider P from its PDEC encoding, the output is divided by 2 * P */
+static uint32_t pllDecodeP (uint32_t pdec) {
+  uint32_t x = 0x10U;
+  uint32_t i;
+
+  switch (pdec) {
+    case 0x7FU: return 1U;
+    case 0x62U: return 1U;
+    case 0x42U: return 2U;
+    default:    break;
+  }
+  for (i = 0x20U; i >= 3U; i--) {
+    x = (((x ^ (x >> 2U)) & 1U) << 4U) | ((x >> 1U) & 0xFU);
+    if (x == pdec) {
+      return i;
+    }
+  }
+  return 1U;
+}
+
+/* Decode the PLL multiplier M from its MDEC encoding */
+static uint32_t pllDecodeM (uint32_t mdec) {
+  uint32_t x = 0x04000U;
+  uint32_t i;
+
+  switch (mdec) {
+    case 0x1FFFFU: return 0U;
+    case 0x18003U: return 1U;
+    case 0x10003U: return 2U;
+    default:       break;
+  }
+  for (i = 0x8000U; i >= 3U; i--) {
+    x = (((x ^ (x >> 1U)) & 1U) << 14U) | ((x >> 1U) & 0x3FFFU);
+    if (x == mdec) {
+      return i;
+    }
+  }
+  return 1U;
+}
 
+/* Get the input clock rate of the PLL */
+static uint32_t getPllInClockRate (void) {
+  switch (SYSCON->SYSPLLCLKSEL & SYSCON_SYSPLLCLKSEL_SEL_MASK) {
+    case 0x00U: return CLK_IRC_12MHZ;
+    case 0x01U: return CLK_CLK_IN;
+    case 0x02U: return CLK_WDT_OSC;
+    case 0x03U: return CLK_RTC_32K_CLK;
+    default:    return 0U;
+  }
+}
 
+/* Get the output clock rate of the PLL from its registers */
+static uint32_t getPllOutClockRate (void) {
+  uint32_t ctrl = SYSCON->SYSPLLCTRL;
+  uint32_t ssctrl1 = SYSCON->SYSPLLSSCTRL1;
+  uint32_t inRate = getPllInClockRate();
+  uint64_t workRate;
+  uint32_t mMult;
+
+  if ((SYSCON->PDRUNCFG & SYSCON_PDRUNCFG_PDEN_SYS_PLL_MASK) != 0U) {
+    return 0U;
+  }
+  if ((ctrl & SYSCON_SYSPLLCTRL_BYPASS_MASK) != 0U) {
+    return inRate;
+  }
+  if ((ctrl & SYSCON_SYSPLLCTRL_DIRECTI_MASK) == 0U) {
+    inRate /= pllDecodeN(SYSCON->SYSPLLNDEC & 0x3FFU);
+  }
+  if ((ssctrl1 & SYSCON_SYSPLLSSCTRL1_PD_MASK) != 0U) {
+    /* MDEC multiplier, doubled unless the CCO divider by 2 is bypassed */
+    mMult = pllDecodeM(SYSCON->SYSPLLSSCTRL0 & 0x1FFFFU);
+    if ((ctrl & SYSCON_SYSPLLCTRL_BYPASSCCODIV2_MASK) == 0U) {
+      mMult <<= 1U;
+    }
+    if (mMult == 0U) {
+      mMult = 1U;
+    }
+    workRate = (uint64_t)inRate * mMult;
+  } else {
+    /* Spread spectrum multiplier, 8 integer bits and 11 fractional bits */
+    workRate = ((uint64_t)inRate * (ssctrl1 & SYSCON_SYSPLLSSCTRL1_MD_MASK)) >> 11U;
+  }
+  if ((ctrl & SYSCON_SYSPLLCTRL_DIRECTO_MASK) == 0U) {
+    workRate /= 2U * pllDecodeP(SYSCON->SYSPLLPDEC & 0x7FU);
+  }
+  return (uint32_t)workRate;
+}
+
+void SystemCoreClockUpdate (void) {
+  uint32_t clkRate = 0U;
+  uint32_t div = SYSCON->AHBCLKDIV & SYSCON_AHBCLKDIV_DIV_MASK;
+
+  switch (SYSCON->MAINCLKSELB & SYSCON_MAINCLKSELB_SEL_MASK) {
+    case 0x00U:                                         /* MAINCLKSELA */
+      switch (SYSCON->MAINCLKSELA & SYSCON_MAINCLKSELA_SEL_MASK) {
+        case 0x00U: clkRate = CLK_IRC_12MHZ; break;
+        case 0x01U: clkRate = CLK_CLK_IN;    break;
+        case 0x02U: clkRate = CLK_WDT_OSC;   break;
+        default:    break;
+      }
+      break;
+    case 0x01U: clkRate = getPllInClockRate();  break;  /* PLL input */
+    case 0x02U: clkRate = getPllOutClockRate(); break;  /* PLL output */
+    case 0x03U: clkRate = CLK_RTC_32K_CLK;      break;  /* RTC oscillator 32 kHz output */
+    default:    break;
+  }
+
+  SystemCoreClock = (div != 0U) ? (clkRate / div) : 0U;
 }
 
 /* ----------------------------------------------------------------------------
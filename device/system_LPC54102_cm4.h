@@ -57,6 +57,10 @@ extern "C" {
 #define DEFAULT_SYSTEM_CLOCK           12000000u           /* Default System clock value */
 #define CLK_RTC_32K_CLK                   32768u           /* RTC oscillator 32 kHz output (32k_clk) */
 #define CLK_IRC_12MHZ                  12000000u           /* IRC 12 MHz (irc_12m) */
+#define CLK_WDT_OSC                      500000u           /* Watchdog oscillator (wdt_osc) */
+#ifndef CLK_CLK_IN
+#define CLK_CLK_IN                            0u           /* CLKIN pin, 0 if it is not used */
+#endif
 
 
 /**
@@ -31,7 +31,7 @@
 #define PLL_MIN_CCO_FREQ_MHZ (75000000U)
 #define PLL_MAX_CCO_FREQ_MHZ (150000000U)
 
-#define PLL_LOWER_IN_LIMIT (4000U) /*!< Min PLL input rate */
+#define PLL_LOWER_IN_LIMIT CLOCK_PLL_MIN_INPUT_FREQ /*!< Min PLL input rate */
 
 #define PLL_MIN_IN_SSMODE (2000000U) /*!< Min PLL input rate in Spread spectrum mode */
 #define PLL_MAX_IN_SSMODE (4000000U) /*!< Max PLL input rate in Spread spectrum mode */
@@ -72,6 +72,16 @@ static uint32_t s_Pll_Freq;
     being driven at. */
 static const uint32_t s_Ext_Freq = 0U;
 
+/* Cached frequencies of the clock tree indexed by clock_name_t, and the clock registers they
+   were computed from. The getters only compare the registers, the tree is recomputed when one
+   changed, whether by the driver, a direct write or a power down. */
+static uint32_t s_Clock_Tree_Freq[CLOCK_NAME_COUNT];
+static clock_tree_regs_t s_Clock_Tree_Regs;
+static bool s_Clock_Tree_Valid;
+
+/* Subscribers to the changes of the clock tree. */
+static clock_notify_handle_t *s_Clock_Notify_List;
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -102,6 +112,10 @@ static pll_error_t CLOCK_GetPllConfig(
     uint32_t finHz, uint32_t foutHz, pll_setup_t *pSetup, bool useFeedbackDiv2, bool useSS);
 /* Update local PLL rate variable */
 static void CLOCK_GetSystemPLLOutFromSetupUpdate(pll_setup_t *pSetup);
+/* Recompute the cached clock tree from a snapshot of the clock registers */
+static void CLOCK_UpdateClockTreeFromRegs(const clock_tree_regs_t *regs);
+/* Get a rate of the cached clock tree */
+static uint32_t CLOCK_GetClockTreeFreq(clock_name_t clockName);
 
 /*******************************************************************************
  * Code
@@ -120,6 +134,7 @@ void CLOCK_AttachClk(clock_attach_id_t connection)
     uint32_t tmp32 = (uint32_t)connection;
     uint32_t i;
     volatile uint32_t *pClkSel;
+    bool changed = false;
 
     pClkSel = &(SYSCON->MAINCLKSELA);
 
@@ -136,24 +151,37 @@ void CLOCK_AttachClk(clock_attach_id_t connection)
             {
                 mux = GET_ID_ITEM_MUX(item);
                 sel = GET_ID_ITEM_SEL(item);
+                if ((mux == CM_ASYNCAPA) || (mux == CM_ASYNCAPB))
+                {
+                    /* The asynchronous APB registers are only readable once the bridge is enabled. */
+                    changed = changed || ((SYSCON->ASYNCAPBCTRL & SYSCON_ASYNCAPBCTRL_ENABLE_MASK) == 0U);
+                    SYSCON->ASYNCAPBCTRL = SYSCON_ASYNCAPBCTRL_ENABLE_MASK;
+                }
                 if (mux == CM_ASYNCAPA)
                 {
-                    SYSCON->ASYNCAPBCTRL          = SYSCON_ASYNCAPBCTRL_ENABLE_MASK;
+                    changed                       = changed || (ASYNC_SYSCON->ASYNCAPBCLKSELA != sel);
                     ASYNC_SYSCON->ASYNCAPBCLKSELA = sel;
                 }
                 else if (mux == CM_ASYNCAPB)
                 {
+                    changed                       = changed || (ASYNC_SYSCON->ASYNCAPBCLKSELB != sel);
                     ASYNC_SYSCON->ASYNCAPBCLKSELB = sel;
                     break;
                 }
                 else
                 {
+                    changed      = changed || (pClkSel[mux] != sel);
                     pClkSel[mux] = sel;
                 }
             }
             tmp32 = GET_ID_NEXT_ITEM(tmp32); /* pick up next descriptor */
         }
     }
+
+    if (changed)
+    {
+        CLOCK_UpdateClockTree();
+    }
 }
 
 /* Return the actual clock attach id */
@@ -221,9 +249,16 @@ void CLOCK_SetClkDiv(clock_div_name_t div_name, uint32_t divided_by_value, bool
 {
     /* param reset is not used, to align with other LPC series*/
     volatile uint32_t *pClkDiv;
+    bool changed;
     pClkDiv = &(SYSCON->SYSTICKCLKDIV);
+    changed = (pClkDiv[div_name] != divided_by_value);
     /* if divided_by_value is 0, clock will be disable */
     pClkDiv[div_name] = divided_by_value;
+
+    if (changed)
+    {
+        CLOCK_UpdateClockTree();
+    }
 }
 
 /*! brief	Return Frequency of External Clock
@@ -278,34 +313,7 @@ uint32_t CLOCK_GetOsc32KFreq(void)
  */
 uint32_t CLOCK_GetAdcClkFreq(void)
 {
-    uint32_t freq = 0U;
-
-    if ((SYSCON->ADCCLKDIV & SYSCON_ADCCLKDIV_DIV_MASK) == 0U)
-    {
-        return 0U;
-    }
-    else
-    {
-        switch (SYSCON->ADCCLKSEL & SYSCON_ADCCLKSEL_SEL_MASK)
-        {
-            case 0U:
-                freq = CLOCK_GetMainClkFreq();
-                break;
-
-            case 1U:
-                freq = CLOCK_GetPllOutFreq();
-                break;
-
-            case 2U:
-                freq = CLOCK_GetIrc12MFreq();
-                break;
-
-            default:
-                break;
-        }
-    }
-
-    return freq / (SYSCON->ADCCLKDIV & SYSCON_ADCCLKDIV_DIV_MASK);
+    return CLOCK_GetClockTreeFreq(kCLOCK_Adc);
 }
 
 /* Get CLOCK OUT Clk */
@@ -314,45 +322,7 @@ uint32_t CLOCK_GetAdcClkFreq(void)
  */
 uint32_t CLOCK_GetClockOutClkFreq(void)
 {
-    uint32_t freq = 0U;
-    if ((SYSCON->CLKOUTDIV & SYSCON_CLKOUTDIV_DIV_MASK) == 0U)
-    {
-        return 0U;
-    }
-    else
-    {
-        if ((SYSCON->CLKOUTSELB & SYSCON_CLKOUTSELB_SEL_MASK) == 0U)
-        {
-            if ((SYSCON->CLKOUTSELA & SYSCON_CLKOUTSELA_SEL_MASK) == 0U)
-            {
-                freq = CLOCK_GetMainClkFreq();
-            }
-            else if ((SYSCON->CLKOUTSELA & SYSCON_CLKOUTSELA_SEL_MASK) == 1U)
-            {
-                freq = CLOCK_GetExtClkFreq();
-            }
-            else if ((SYSCON->CLKOUTSELA & SYSCON_CLKOUTSELA_SEL_MASK) == 2U)
-            {
-                freq = CLOCK_GetWdtOscFreq();
-            }
-            else if ((SYSCON->CLKOUTSELA & SYSCON_CLKOUTSELA_SEL_MASK) == 3U)
-            {
-                freq = CLOCK_GetIrc12MFreq();
-            }
-            else
-            {
-            }
-        }
-        else if ((SYSCON->CLKOUTSELB & SYSCON_CLKOUTSELB_SEL_MASK) == 3U)
-        {
-            freq = CLOCK_GetOsc32KFreq();
-        }
-        else
-        {
-        }
-
-        return freq / (SYSCON->CLKOUTDIV & SYSCON_CLKOUTDIV_DIV_MASK);
-    }
+    return CLOCK_GetClockTreeFreq(kCLOCK_ClockOut);
 }
 
 /*! brief  Return Frequency of IRC
@@ -401,46 +371,7 @@ uint32_t CLOCK_GetPllInFreq(void)
  */
 uint32_t CLOCK_GetMainClkFreq(void)
 {
-    uint32_t freq = 0U;
-
-    switch (SYSCON->MAINCLKSELB & SYSCON_MAINCLKSELB_SEL_MASK)
-    {
-        case 0U:
-            if ((SYSCON->MAINCLKSELA & SYSCON_MAINCLKSELA_SEL_MASK) == 0U)
-            {
-                freq = CLOCK_GetIrc12MFreq();
-            }
-            else if ((SYSCON->MAINCLKSELA & SYSCON_MAINCLKSELA_SEL_MASK) == 1U)
-            {
-                freq = CLOCK_GetExtClkFreq();
-            }
-            else if ((SYSCON->MAINCLKSELA & SYSCON_MAINCLKSELA_SEL_MASK) == 2U)
-            {
-                freq = CLOCK_GetWdtOscFreq();
-            }
-            else
-            {
-            }
-
-            break;
-
-        case 1U:
-            freq = CLOCK_GetPllInFreq();
-            break;
-
-        case 2U:
-            freq = CLOCK_GetPllOutFreq();
-            break;
-
-        case 3U:
-            freq = CLOCK_GetOsc32KFreq();
-            break;
-
-        default:
-            break;
-    }
-
-    return freq;
+    return CLOCK_GetClockTreeFreq(kCLOCK_MainClk);
 }
 
 /*! brief	Return Frequency of Asynchronous APB Clock
@@ -448,49 +379,7 @@ uint32_t CLOCK_GetMainClkFreq(void)
  */
 uint32_t CLOCK_GetAsyncApbClkFreq(void)
 {
-    uint32_t freq = 0U;
-
-    if ((ASYNC_SYSCON->ASYNCCLKDIV & ASYNC_SYSCON_FRGCTRL_DIV_MASK) == 0U)
-    {
-        return 0U;
-    }
-    else
-    {
-        switch (ASYNC_SYSCON->ASYNCAPBCLKSELB & ASYNC_SYSCON_ASYNCAPBCLKSELB_SEL_MASK)
-        {
-            case 3U:
-                if ((ASYNC_SYSCON->ASYNCAPBCLKSELA & ASYNC_SYSCON_ASYNCAPBCLKSELA_SEL_MASK) == 0U)
-                {
-                    freq = CLOCK_GetIrc12MFreq();
-                }
-                else if ((ASYNC_SYSCON->ASYNCAPBCLKSELA & ASYNC_SYSCON_ASYNCAPBCLKSELA_SEL_MASK) == 1U)
-                {
-                    freq = CLOCK_GetWdtOscFreq();
-                }
-                else
-                {
-                }
-
-                break;
-
-            case 0U:
-                freq = CLOCK_GetMainClkFreq();
-                break;
-
-            case 1U:
-                freq = CLOCK_GetExtClkFreq();
-                break;
-
-            case 2U:
-                freq = CLOCK_GetPllOutFreq();
-                break;
-
-            default:
-                break;
-        }
-    }
-
-    return freq / (ASYNC_SYSCON->ASYNCCLKDIV);
+    return CLOCK_GetClockTreeFreq(kCLOCK_AsyncApbClk);
 }
 
 /*! brief  Set Frequency of FRG
@@ -499,7 +388,6 @@ uint32_t CLOCK_GetAsyncApbClkFreq(void)
 bool CLOCK_SetFRGClock(uint32_t freq)
 {
     uint32_t input = CLOCK_GetAsyncApbClkFreq();
-    uint32_t mul;
     assert(freq);
     if (freq > input)
     {
@@ -507,25 +395,34 @@ bool CLOCK_SetFRGClock(uint32_t freq)
     }
     else
     {
-        mul                   = (uint32_t)(((uint64_t)(input - freq) * 256) / ((uint64_t)freq));
-        ASYNC_SYSCON->FRGCTRL = (mul << ASYNC_SYSCON_FRGCTRL_MULT_SHIFT) | ASYNC_SYSCON_FRGCTRL_DIV_MASK;
+        CLOCK_SetFRGMult((uint32_t)(((uint64_t)(input - freq) * 256) / ((uint64_t)freq)));
         return true;
     }
 }
 
+/*! brief  Set the multiplier of the FRG, the FRG output is the input * 256 / (256 + mult)
+ *  param  mult : FRG multiplier, from 0 to 255
+ */
+void CLOCK_SetFRGMult(uint32_t mult)
+{
+    uint32_t frgCtrl;
+
+    assert(mult <= (ASYNC_SYSCON_FRGCTRL_MULT_MASK >> ASYNC_SYSCON_FRGCTRL_MULT_SHIFT));
+
+    frgCtrl = ASYNC_SYSCON_FRGCTRL_MULT(mult) | ASYNC_SYSCON_FRGCTRL_DIV_MASK;
+    if (ASYNC_SYSCON->FRGCTRL != frgCtrl)
+    {
+        ASYNC_SYSCON->FRGCTRL = frgCtrl;
+        CLOCK_UpdateClockTree();
+    }
+}
+
 /*! brief  Return Frequency of Core clock
  *  return Frequency of Core clock
  */
 uint32_t CLOCK_GetCoreClkFreq(void)
 {
-    if ((SYSCON->AHBCLKDIV & SYSCON_AHBCLKDIV_DIV_MASK) == 0U)
-    {
-        return 0U;
-    }
-    else
-    {
-        return (CLOCK_GetMainClkFreq() / (SYSCON->AHBCLKDIV & SYSCON_AHBCLKDIV_DIV_MASK));
-    }
+    return CLOCK_GetClockTreeFreq(kCLOCK_CoreSysClk);
 }
 
 /*! brief  Return Frequency of BUS
@@ -533,62 +430,31 @@ uint32_t CLOCK_GetCoreClkFreq(void)
  */
 uint32_t CLOCK_GetBusClkFreq(void)
 {
-    if ((SYSCON->AHBCLKDIV & SYSCON_AHBCLKDIV_DIV_MASK) == 0U)
-    {
-        return 0U;
-    }
-    else
-    {
-        return (CLOCK_GetMainClkFreq() / (SYSCON->AHBCLKDIV & SYSCON_AHBCLKDIV_DIV_MASK));
-    }
+    return CLOCK_GetClockTreeFreq(kCLOCK_BusClk);
 }
 
-/*! brief  Return Frequency of USART
+/*! brief  Return Frequency of USART, the FRG output
  *  return Frequency of USART
  */
 uint32_t CLOCK_GetUsartClkFreq(void)
 {
-    if ((ASYNC_SYSCON->ASYNCCLKDIV & ASYNC_SYSCON_FRGCTRL_DIV_MASK) == 0U)
-    {
-        return 0U;
-    }
-    else
-    {
-        return CLOCK_GetAsyncApbClkFreq() /
-               (1U + ((((ASYNC_SYSCON->FRGCTRL & ASYNC_SYSCON_FRGCTRL_MULT_MASK) >> 8U)) / 256U));
-    }
+    return CLOCK_GetClockTreeFreq(kCLOCK_FRG);
 }
 
-/*! brief  Return Frequency of SPI
+/*! brief  Return Frequency of SPI, the asynchronous APB clock
  *  return Frequency of SPI
  */
 uint32_t CLOCK_GetSpiClkFreq(void)
 {
-    if ((ASYNC_SYSCON->ASYNCCLKDIV & ASYNC_SYSCON_FRGCTRL_DIV_MASK) == 0U)
-    {
-        return 0U;
-    }
-    else
-    {
-        return CLOCK_GetAsyncApbClkFreq() /
-               (1U + ((((ASYNC_SYSCON->FRGCTRL & ASYNC_SYSCON_FRGCTRL_MULT_MASK) >> 8U)) / 256U));
-    }
+    return CLOCK_GetClockTreeFreq(kCLOCK_AsyncApbClk);
 }
 
-/*! brief  Return Frequency of I2C
+/*! brief  Return Frequency of I2C, the asynchronous APB clock
  *  return Frequency of I2C
  */
 uint32_t CLOCK_GetI2cClkFreq(void)
 {
-    if ((ASYNC_SYSCON->ASYNCCLKDIV & ASYNC_SYSCON_FRGCTRL_DIV_MASK) == 0U)
-    {
-        return 0U;
-    }
-    else
-    {
-        return CLOCK_GetAsyncApbClkFreq() /
-               (1U + ((((ASYNC_SYSCON->FRGCTRL & ASYNC_SYSCON_FRGCTRL_MULT_MASK) >> 8U)) / 256U));
-    }
+    return CLOCK_GetClockTreeFreq(kCLOCK_AsyncApbClk);
 }
 
 /*! brief	Return Frequency of selected clock
@@ -596,88 +462,202 @@ uint32_t CLOCK_GetI2cClkFreq(void)
  */
 uint32_t CLOCK_GetFreq(clock_name_t clockName)
 {
-    uint32_t freq;
-    switch (clockName)
+    if ((uint32_t)clockName >= CLOCK_NAME_COUNT)
     {
-        case kCLOCK_MainClk:
-            freq = CLOCK_GetMainClkFreq();
-            break;
-        case kCLOCK_CoreSysClk:
-            freq = CLOCK_GetCoreClkFreq();
-            break;
-        case kCLOCK_BusClk:
-            freq = CLOCK_GetBusClkFreq();
-            break;
-        case kCLOCK_PllOut:
-            freq = CLOCK_GetPllOutFreq();
-            break;
-        case kCLOCK_WdtOsc:
-            freq = CLOCK_GetWdtOscFreq();
-            break;
-        case kCLOCK_FRG:
-            freq = ((ASYNC_SYSCON->FRGCTRL & ASYNC_SYSCON_FRGCTRL_DIV_MASK) == ASYNC_SYSCON_FRGCTRL_DIV_MASK) ?
-                       ((uint64_t)CLOCK_GetAsyncApbClkFreq() * (ASYNC_SYSCON_FRGCTRL_DIV_MASK + 1)) /
-                           ((ASYNC_SYSCON_FRGCTRL_DIV_MASK + 1) +
-                            ((ASYNC_SYSCON->FRGCTRL & ASYNC_SYSCON_FRGCTRL_MULT_MASK) >>
-                             ASYNC_SYSCON_FRGCTRL_MULT_SHIFT)) :
-                       0U;
-            break;
-        case kCLOCK_AsyncApbClk:
-            freq = CLOCK_GetAsyncApbClkFreq();
-            break;
-        case kCLOCK_Irc:
-            freq = CLOCK_GetIrc12MFreq();
-            break;
-        case kCLOCK_Adc:
-            freq = CLOCK_GetAdcClkFreq();
-            break;
-        case kCLOCK_ClockOut:
-            freq = CLOCK_GetClockOutClkFreq();
-            break;
-        default:
-            freq = 0U;
-            break;
+        return 0U;
     }
 
-    return freq;
+    return CLOCK_GetClockTreeFreq(clockName);
 }
 
-/* Set the FLASH wait states for the passed frequency */
-/**
- * brief	Set the flash wait states for the input freuqency.
- * param	iFreq	: Input frequency
- * return	Nothing
+/*! brief	Read the clock tree registers
+ *  param	regs	: Clock tree registers read, the input of CLOCK_EvaluateClockTree()
+ *  return	Nothing
+ *  note	The ASYNC_SYSCON registers are only read if the asynchronous APB
+ *  bridge is enabled, they are 0 otherwise.
  */
-void CLOCK_SetFLASHAccessCyclesForFreq(uint32_t iFreq)
+void CLOCK_GetClockTreeRegs(clock_tree_regs_t *regs)
 {
-    if (iFreq <= 12000000U)
-    {
-        CLOCK_SetFLASHAccessCycles(kCLOCK_Flash1Cycle);
+    assert(regs != NULL);
+
+    regs->pdruncfg     = SYSCON->PDRUNCFG;
+    regs->rtcoscctrl   = SYSCON->RTCOSCCTRL;
+    regs->mainclksela  = SYSCON->MAINCLKSELA;
+    regs->mainclkselb  = SYSCON->MAINCLKSELB;
+    regs->syspllclksel = SYSCON->SYSPLLCLKSEL;
+    regs->syspllstat   = SYSCON->SYSPLLSTAT;
+    regs->ahbclkdiv    = SYSCON->AHBCLKDIV;
+    regs->adcclksel    = SYSCON->ADCCLKSEL;
+    regs->adcclkdiv    = SYSCON->ADCCLKDIV;
+    regs->clkoutsela   = SYSCON->CLKOUTSELA;
+    regs->clkoutselb   = SYSCON->CLKOUTSELB;
+    regs->clkoutdiv    = SYSCON->CLKOUTDIV;
+    regs->flashcfg     = SYSCON->FLASHCFG;
+    regs->asyncapbctrl = SYSCON->ASYNCAPBCTRL;
+    if ((regs->asyncapbctrl & SYSCON_ASYNCAPBCTRL_ENABLE_MASK) != 0U)
+    {
+        regs->asyncapbclksela = ASYNC_SYSCON->ASYNCAPBCLKSELA;
+        regs->asyncapbclkselb = ASYNC_SYSCON->ASYNCAPBCLKSELB;
+        regs->asyncclkdiv     = ASYNC_SYSCON->ASYNCCLKDIV;
+        regs->frgctrl         = ASYNC_SYSCON->FRGCTRL;
+        regs->asyncapbclkctrl = ASYNC_SYSCON->ASYNCAPBCLKCTRL;
     }
-    else if (iFreq <= 24000000U)
+    else
     {
-        CLOCK_SetFLASHAccessCycles(kCLOCK_Flash2Cycle);
+        regs->asyncapbclksela = 0U;
+        regs->asyncapbclkselb = 0U;
+        regs->asyncclkdiv     = 0U;
+        regs->frgctrl         = 0U;
+        regs->asyncapbclkctrl = 0U;
     }
-    else if (iFreq <= 48000000U)
+    regs->pllRate    = s_Pll_Freq;
+    regs->extClkRate = s_Ext_Freq;
+}
+
+/*! brief	Describe the active clock tree and check it against the device limits
+ *  param	info	: Description of the clock tree
+ *  return	Out of spec combinations found, OR'ed #_clock_tree_violation,
+ *  0 if the clock tree is valid
+ */
+uint32_t CLOCK_GetClockTreeInfo(clock_tree_info_t *info)
+{
+    clock_tree_regs_t regs;
+
+    CLOCK_GetClockTreeRegs(&regs);
+
+    return CLOCK_EvaluateClockTree(&regs, info);
+}
+
+/* Recompute the cached clock tree from a snapshot of the clock registers */
+static void CLOCK_UpdateClockTreeFromRegs(const clock_tree_regs_t *regs)
+{
+    clock_tree_info_t info;
+    uint32_t changedMask = 0U;
+    uint32_t i;
+    clock_notify_handle_t *handle;
+    clock_notify_handle_t *next;
+
+    /* The rates come from the clock tree model, the one used to validate the configurations. */
+    (void)CLOCK_EvaluateClockTree(regs, &info);
+
+    for (i = 0U; i < CLOCK_NAME_COUNT; i++)
     {
-        CLOCK_SetFLASHAccessCycles(kCLOCK_Flash3Cycle);
+        if (info.clock[i].freq != s_Clock_Tree_Freq[i])
+        {
+            changedMask |= CLOCK_NOTIFY_MASK(i);
+            s_Clock_Tree_Freq[i] = info.clock[i].freq;
+        }
     }
-    else if (iFreq <= 72000000U)
+    s_Clock_Tree_Regs  = *regs;
+    s_Clock_Tree_Valid = true;
+    SystemCoreClock    = info.clock[kCLOCK_CoreSysClk].freq;
+
+    /* The next subscriber is read first, so that a callback can unsubscribe itself. */
+    for (handle = s_Clock_Notify_List; handle != NULL; handle = next)
     {
-        CLOCK_SetFLASHAccessCycles(kCLOCK_Flash4Cycle);
+        next = handle->next;
+        if ((handle->clockMask & changedMask) != 0U)
+        {
+            handle->callback(handle, handle->clockMask & changedMask);
+        }
     }
-    else if (iFreq <= 84000000U)
+}
+
+static uint32_t CLOCK_GetClockTreeFreq(clock_name_t clockName)
+{
+    clock_tree_regs_t regs;
+
+    /* The registers are compared rather than decoded, the tree is only recomputed when one changed. */
+    CLOCK_GetClockTreeRegs(&regs);
+    if ((!s_Clock_Tree_Valid) || (0 != memcmp(&regs, &s_Clock_Tree_Regs, sizeof(regs))))
     {
-        CLOCK_SetFLASHAccessCycles(kCLOCK_Flash5Cycle);
+        CLOCK_UpdateClockTreeFromRegs(&regs);
     }
-    else if (iFreq <= 100000000U)
+
+    return s_Clock_Tree_Freq[clockName];
+}
+
+/*! brief	Recompute the cached clock tree from the clock registers
+ *  return	Nothing
+ *  note	The frequencies returned by CLOCK_GetFreq() and the clock getters are
+ *  cached, they are recomputed when CLOCK_AttachClk(), CLOCK_SetClkDiv(),
+ *  CLOCK_SetFRGClock() or the PLL setup functions change a clock, and
+ *  SystemCoreClock is updated along. The getters also recompute them when a
+ *  clock register or the power of an oscillator changed since, so this
+ *  function is only needed to update SystemCoreClock and notify the
+ *  subscribers at once after a direct register write. The subscribers of the
+ *  clocks that changed are notified.
+ */
+void CLOCK_UpdateClockTree(void)
+{
+    clock_tree_regs_t regs;
+
+    CLOCK_GetClockTreeRegs(&regs);
+    CLOCK_UpdateClockTreeFromRegs(&regs);
+}
+
+/*! brief	Subscribe to the changes of clocks of the clock tree
+ *  param	handle	: Notification handle, its clockMask, callback and userData
+ *  should be set, it should stay allocated until it is unsubscribed
+ *  return	Nothing
+ *  note	The callback is called in the context of the function changing
+ *  the clock, or of the getter which finds a clock register changed, once
+ *  the clock tree is recomputed, so it can read the new frequencies. It
+ *  could be used by a driver to recompute its dividers, a USART could set
+ *  its baud rate again for example.
+ */
+void CLOCK_RegisterNotify(clock_notify_handle_t *handle)
+{
+    uint32_t regPrimask;
+
+    assert(handle != NULL);
+    assert(handle->callback != NULL);
+
+    /* The changes are detected against the cached clock tree, so it should be computed first. */
+    if (!s_Clock_Tree_Valid)
     {
-        CLOCK_SetFLASHAccessCycles(kCLOCK_Flash6Cycle);
+        CLOCK_UpdateClockTree();
     }
-    else
+
+    regPrimask          = DisableGlobalIRQ();
+    handle->next        = s_Clock_Notify_List;
+    s_Clock_Notify_List = handle;
+    EnableGlobalIRQ(regPrimask);
+}
+
+/*! brief	Unsubscribe from the changes of clocks of the clock tree
+ *  param	handle	: Notification handle registered with CLOCK_RegisterNotify()
+ *  return	Nothing
+ */
+void CLOCK_UnregisterNotify(clock_notify_handle_t *handle)
+{
+    clock_notify_handle_t **link = &s_Clock_Notify_List;
+    uint32_t regPrimask;
+
+    assert(handle != NULL);
+
+    regPrimask = DisableGlobalIRQ();
+    while (*link != NULL)
     {
-        CLOCK_SetFLASHAccessCycles(kCLOCK_Flash7Cycle);
+        if (*link == handle)
+        {
+            *link = handle->next;
+            break;
+        }
+        link = &((*link)->next);
     }
+    EnableGlobalIRQ(regPrimask);
+}
+
+/* Set the FLASH wait states for the passed frequency */
+/**
+ * brief	Set the flash wait states for the input freuqency.
+ * param	iFreq	: Input frequency
+ * return	Nothing
+ */
+void CLOCK_SetFLASHAccessCyclesForFreq(uint32_t iFreq)
+{
+    CLOCK_SetFLASHAccessCycles(CLOCK_GetFLASHAccessCyclesForFreq(iFreq));
 }
 
 /* Find encoded NDEC value for raw N value, max N = NVALMAX */
@@ -1258,7 +1238,7 @@ static pll_error_t CLOCK_GetPllConfig(
 /* Update local PLL rate variable */
 static void CLOCK_GetSystemPLLOutFromSetupUpdate(pll_setup_t *pSetup)
 {
-    s_Pll_Freq = CLOCK_GetSystemPLLOutFromSetup(pSetup);
+    CLOCK_SetStoredPLLClockRate(CLOCK_GetSystemPLLOutFromSetup(pSetup));
 }
 
 /* Return System PLL input clock rate */
@@ -1382,7 +1362,11 @@ uint32_t CLOCK_GetSystemPLLOutFromSetup(pll_setup_t *pSetup)
  **/
 void CLOCK_SetStoredPLLClockRate(uint32_t rate)
 {
-    s_Pll_Freq = rate;
+    if (s_Pll_Freq != rate)
+    {
+        s_Pll_Freq = rate;
+        CLOCK_UpdateClockTree();
+    }
 }
 
 /* Return System PLL output clock rate */
@@ -1598,11 +1582,41 @@ pll_error_t CLOCK_SetPLLFreq(const pll_setup_t *pSetup)
     }
 
     /* Update current programmed PLL rate var */
-    s_Pll_Freq = pSetup->pllRate;
+    CLOCK_SetStoredPLLClockRate(pSetup->pllRate);
 
     return kStatus_PLL_Success;
 }
 
+/* Setup PLL Frequency from a precomputed table entry */
+/*! brief	Set PLL output from a precomputed PLL setup entry
+ *  param	pEntry	: Pointer to a precomputed PLL setup entry
+ *  return	kStatus_PLL_Success on success, kStatus_PLL_InputTooLow or
+ *  kStatus_PLL_InputTooHigh if the current PLL input clock rate is not the
+ *  one the entry is computed for
+ *  note	The setup is applied with CLOCK_SetPLLFreq(), the time taken does
+ *  not depend on the rates. The PLL input clock source should be selected
+ *  prior to calling this function.
+ */
+pll_error_t CLOCK_SetPLLFreqFromTable(const pll_setup_entry_t *pEntry)
+{
+    uint32_t inRate;
+
+    assert(pEntry != NULL);
+
+    /* The dividers of the entry only give its rate from the input rate it is computed for */
+    inRate = CLOCK_GetSystemPLLInClockRate();
+    if (inRate < pEntry->inputRate)
+    {
+        return kStatus_PLL_InputTooLow;
+    }
+    if (inRate > pEntry->inputRate)
+    {
+        return kStatus_PLL_InputTooHigh;
+    }
+
+    return CLOCK_SetPLLFreq(&pEntry->setup);
+}
+
 /* Set System PLL clock based on the input frequency and multiplier */
 /*! brief	Set PLL output based on the multiplier and input frequency
  *  param	multiply_by	: multiplier
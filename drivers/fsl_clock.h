@@ -9,6 +9,7 @@
 #define _FSL_CLOCK_H_
 
 #include "fsl_common.h"
+#include "fsl_clock_tree.h"
 
 /*! @addtogroup clock */
 /*! @{ */
@@ -25,11 +26,6 @@
 #define FSL_CLOCK_DRIVER_VERSION (MAKE_VERSION(2, 3, 0))
 /*@}*/
 
-/* Definition for delay API in clock driver, users can redefine it to the real application. */
-#ifndef SDK_DEVICE_MAXIMUM_CPU_CLOCK_FREQUENCY
-#define SDK_DEVICE_MAXIMUM_CPU_CLOCK_FREQUENCY (150000000UL)
-#endif
-
 /*!
  * @brief User-defined the size of cache for CLOCK_PllGetConfig() function.
  *
@@ -255,21 +251,23 @@ typedef enum _clock_ip_name
     kCLOCK_Frg    = CLK_GATE_DEFINE(ASYNC_CLK_CTRL0, 15),
 } clock_ip_name_t;
 
-/*! @brief Clock name used to get clock frequency. */
-typedef enum _clock_name
+/*! @brief Bit of a clock of #clock_name_t in the masks of the clock change notification. */
+#define CLOCK_NOTIFY_MASK(clockName) (1UL << (uint32_t)(clockName))
+
+/*! @brief Clock change notification handle, see CLOCK_RegisterNotify(). */
+typedef struct _clock_notify_handle clock_notify_handle_t;
+
+/*! @brief Clock change notification callback, changedMask holds the #CLOCK_NOTIFY_MASK bits of the clocks changed. */
+typedef void (*clock_notify_callback_t)(clock_notify_handle_t *handle, uint32_t changedMask);
+
+/*! @brief Clock change notification handle, the memory is allocated by the subscriber. */
+struct _clock_notify_handle
 {
-    kCLOCK_MainClk,     /*!< Main clock                                              */
-    kCLOCK_CoreSysClk,  /*!< Core/system clock                                       */
-    kCLOCK_BusClk,      /*!< Bus clock (AHB clock)                                   */
-    kCLOCK_Irc,         /*!< Internal IRC                                            */
-    kCLOCK_ExtClk,      /*!< External Clock                                          */
-    kCLOCK_PllOut,      /*!< PLL Output                                              */
-    kCLOCK_WdtOsc,      /*!< Watchdog Oscillator                                     */
-    kCLOCK_FRG,         /*!< Frg Clock                                               */
-    kCLOCK_AsyncApbClk, /*!< Async APB clock                                         */
-    kCLOCK_Adc,         /*!< ADC clock                                               */
-    kCLOCK_ClockOut,    /*!< Clockout clock                                          */
-} clock_name_t;
+    clock_notify_handle_t *next;      /*!< Next subscriber, managed by the driver */
+    uint32_t clockMask;               /*!< Clocks notified, OR'ed #CLOCK_NOTIFY_MASK bits */
+    clock_notify_callback_t callback; /*!< Callback called once a notified clock changed */
+    void *userData;                   /*!< User data of the subscriber */
+};
 
 /*! @brief Clock Mux Switches
  *  The encoding is as follows each connection identified is 32bits wide while 24bits are valuable
@@ -358,20 +356,6 @@ typedef enum _clock_div_name
     kCLOCK_DivClkOut     = 11,
 } clock_div_name_t;
 
-/**
- * @brief FLASH Access time definitions
- */
-typedef enum _clock_flashtim
-{
-    kCLOCK_Flash1Cycle = 0, /*!< Flash accesses use 1 CPU clock */
-    kCLOCK_Flash2Cycle,     /*!< Flash accesses use 2 CPU clocks */
-    kCLOCK_Flash3Cycle,     /*!< Flash accesses use 3 CPU clocks */
-    kCLOCK_Flash4Cycle,     /*!< Flash accesses use 4 CPU clocks */
-    kCLOCK_Flash5Cycle,     /*!< Flash accesses use 5 CPU clocks */
-    kCLOCK_Flash6Cycle,     /*!< Flash accesses use 6 CPU clocks */
-    kCLOCK_Flash7Cycle,     /*!< Flash accesses use 7 CPU clocks */
-} clock_flashtim_t;
-
 /*******************************************************************************
  * API
  ******************************************************************************/
@@ -504,6 +488,52 @@ uint32_t CLOCK_GetBusClkFreq(void);
  */
 uint32_t CLOCK_GetFreq(clock_name_t clockName);
 
+/*! @brief	Recompute the cached clock tree from the clock registers
+ *  @return	Nothing
+ *  @note	The frequencies returned by CLOCK_GetFreq() and the clock getters are
+ *  cached, they are recomputed when CLOCK_AttachClk(), CLOCK_SetClkDiv(),
+ *  CLOCK_SetFRGClock() or the PLL setup functions change a clock, and
+ *  SystemCoreClock is updated along. The getters also recompute them when a
+ *  clock register or the power of an oscillator changed since, so this
+ *  function is only needed to update SystemCoreClock and notify the
+ *  subscribers at once after a direct register write. The subscribers of the
+ *  clocks that changed are notified.
+ */
+void CLOCK_UpdateClockTree(void);
+
+/*! @brief	Subscribe to the changes of clocks of the clock tree
+ *  @param	handle	: Notification handle, its clockMask, callback and userData
+ *  should be set, it should stay allocated until it is unsubscribed
+ *  @return	Nothing
+ *  @note	The callback is called in the context of the function changing
+ *  the clock, or of the getter which finds a clock register changed, once
+ *  the clock tree is recomputed, so it can read the new frequencies. It
+ *  could be used by a driver to recompute its dividers, a USART could set
+ *  its baud rate again for example.
+ */
+void CLOCK_RegisterNotify(clock_notify_handle_t *handle);
+
+/*! @brief	Unsubscribe from the changes of clocks of the clock tree
+ *  @param	handle	: Notification handle registered with CLOCK_RegisterNotify()
+ *  @return	Nothing
+ */
+void CLOCK_UnregisterNotify(clock_notify_handle_t *handle);
+
+/*! @brief	Read the clock tree registers
+ *  @param	regs	: Clock tree registers read, the input of CLOCK_EvaluateClockTree()
+ *  @return	Nothing
+ *  @note	The ASYNC_SYSCON registers are only read if the asynchronous APB
+ *  bridge is enabled, they are 0 otherwise.
+ */
+void CLOCK_GetClockTreeRegs(clock_tree_regs_t *regs);
+
+/*! @brief	Describe the active clock tree and check it against the device limits
+ *  @param	info	: Description of the clock tree
+ *  @return	Out of spec combinations found, OR'ed #_clock_tree_violation,
+ *  0 if the clock tree is valid
+ */
+uint32_t CLOCK_GetClockTreeInfo(clock_tree_info_t *info);
+
 /*! @brief	Return Frequency of External Clock
  *  @return	Frequency of External Clock. If no external clock is used returns 0.
  */
@@ -544,17 +574,17 @@ uint32_t CLOCK_GetIrc12MFreq(void);
  */
 uint32_t CLOCK_GetPllInFreq(void);
 
-/*! @brief  Return Frequency of USART
+/*! @brief  Return Frequency of USART, the FRG output
  *  @return Frequency of USART
  */
 uint32_t CLOCK_GetUsartClkFreq(void);
 
-/*! @brief  Return Frequency of I2C
+/*! @brief  Return Frequency of I2C, the asynchronous APB clock
  *  @return Frequency of I2C
  */
 uint32_t CLOCK_GetI2cClkFreq(void);
 
-/*! @brief  Return Frequency of SPI
+/*! @brief  Return Frequency of SPI, the asynchronous APB clock
  *  @return Frequency of SPI
  */
 uint32_t CLOCK_GetSpiClkFreq(void);
@@ -574,6 +604,11 @@ uint32_t CLOCK_GetAsyncApbClkFreq(void);
  */
 bool CLOCK_SetFRGClock(uint32_t freq);
 
+/*! @brief  Set the multiplier of the FRG, the FRG output is the input * 256 / (256 + mult)
+ *  @param  mult : FRG multiplier, from 0 to 255
+ */
+void CLOCK_SetFRGMult(uint32_t mult);
+
 /*! @brief	Return System PLL input clock rate
  *  @return	System PLL input clock rate
  */
@@ -706,6 +741,17 @@ typedef struct _pll_setup
     uint32_t flags;           /*!< PLL setup flags, Or'ed value of PLL_SETUPFLAG_* definitions */
 } pll_setup_t;
 
+/*! @brief Precomputed PLL setup entry
+ * This structure holds a PLL setup computed ahead of time for a PLL input
+ * clock rate, such as the entries generated by tools/pll_table_gen.py. It
+ * is applied with CLOCK_SetPLLFreqFromTable() without any search.
+ */
+typedef struct _pll_setup_entry
+{
+    uint32_t inputRate; /*!< PLL input clock rate in Hz the setup is computed for */
+    pll_setup_t setup;  /*!< PLL setup, pllRate is the actual PLL rate */
+} pll_setup_entry_t;
+
 /*! @brief PLL status definitions
  */
 typedef enum _pll_error
@@ -756,6 +802,17 @@ pll_error_t CLOCK_SetupSystemPLLPrec(pll_setup_t *pSetup, uint32_t flagcfg);
  */
 pll_error_t CLOCK_SetPLLFreq(const pll_setup_t *pSetup);
 
+/*! @brief	Set PLL output from a precomputed PLL setup entry
+ *  @param	pEntry	: Pointer to a precomputed PLL setup entry
+ *  @return	kStatus_PLL_Success on success, kStatus_PLL_InputTooLow or
+ *  kStatus_PLL_InputTooHigh if the current PLL input clock rate is not the
+ *  one the entry is computed for
+ *  @note	The setup is applied with CLOCK_SetPLLFreq(), the time taken does
+ *  not depend on the rates. The PLL input clock source should be selected
+ *  prior to calling this function.
+ */
+pll_error_t CLOCK_SetPLLFreqFromTable(const pll_setup_entry_t *pEntry);
+
 /*! @brief	Set PLL output based on the multiplier and input frequency
  *  @param	multiply_by	: multiplier
  *  @param	input_freq	: Clock input frequency of the PLL
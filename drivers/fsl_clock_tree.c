@@ -0,0 +1,281 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_common.h"
+#include "fsl_clock_tree.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.clock"
+#endif
+
+#if !defined(SYSCON)
+/* Host build, the fsl_common.h stand-in has no device header: the oscillator rates and register fields used here */
+#define CLK_RTC_32K_CLK 32768u
+#define CLK_IRC_12MHZ 12000000u
+#define CLK_WDT_OSC 500000u
+
+#define SYSCON_PDRUNCFG_PDEN_IRC_OSC_MASK (0x8U)
+#define SYSCON_PDRUNCFG_PDEN_IRC_MASK (0x10U)
+#define SYSCON_PDRUNCFG_PDEN_WDT_OSC_MASK (0x100000U)
+#define SYSCON_PDRUNCFG_PDEN_SYS_PLL_MASK (0x400000U)
+#define SYSCON_RTCOSCCTRL_EN_MASK (0x1U)
+#define SYSCON_MAINCLKSELA_SEL_MASK (0x3U)
+#define SYSCON_MAINCLKSELB_SEL_MASK (0x3U)
+#define SYSCON_SYSPLLCLKSEL_SEL_MASK (0x3U)
+#define SYSCON_SYSPLLSTAT_LOCK_MASK (0x1U)
+#define SYSCON_AHBCLKDIV_DIV_MASK (0xFFU)
+#define SYSCON_ADCCLKSEL_SEL_MASK (0x3U)
+#define SYSCON_ADCCLKDIV_DIV_MASK (0xFFU)
+#define SYSCON_CLKOUTSELA_SEL_MASK (0x3U)
+#define SYSCON_CLKOUTSELB_SEL_MASK (0x3U)
+#define SYSCON_CLKOUTDIV_DIV_MASK (0xFFU)
+#define SYSCON_FLASHCFG_FLASHTIM_MASK (0xF000U)
+#define SYSCON_FLASHCFG_FLASHTIM_SHIFT (12U)
+#define SYSCON_ASYNCAPBCTRL_ENABLE_MASK (0x1U)
+#define ASYNC_SYSCON_ASYNCAPBCLKSELA_SEL_MASK (0x3U)
+#define ASYNC_SYSCON_ASYNCAPBCLKSELB_SEL_MASK (0x3U)
+#define ASYNC_SYSCON_ASYNCCLKDIV_DIV_MASK (0xFFU)
+#define ASYNC_SYSCON_FRGCTRL_DIV_MASK (0xFFU)
+#define ASYNC_SYSCON_FRGCTRL_MULT_MASK (0xFF00U)
+#define ASYNC_SYSCON_FRGCTRL_MULT_SHIFT (8U)
+#define ASYNC_SYSCON_ASYNCAPBCLKCTRL_FRG0_MASK (0x8000U)
+#endif /* SYSCON */
+
+/* Number of the sources of clock_tree_source_t */
+#define CLOCK_TREE_SOURCE_COUNT ((uint32_t)kCLOCK_TreeSourceAsyncApbClk + 1U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Highest core clock rate of each FLASH access time, from kCLOCK_Flash1Cycle, faster rates use kCLOCK_Flash7Cycle */
+static const uint32_t s_Flash_Freq_Limit[] = {12000000U, 24000000U, 48000000U, 72000000U, 84000000U, 100000000U};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Set a clock of the clock tree description from its source and divider */
+static void CLOCK_SetTreeNode(clock_tree_node_t *node, const uint32_t *srcFreq, uint32_t source, uint32_t divider)
+{
+    node->source  = source;
+    node->divider = divider;
+    node->freq    = (divider == 0U) ? 0U : (srcFreq[source] / divider);
+}
+
+/* Source of the PLL input selected by SYSPLLCLKSEL */
+static uint32_t CLOCK_GetTreePllInSource(const clock_tree_regs_t *regs)
+{
+    static const uint8_t source[] = {(uint8_t)kCLOCK_TreeSourceIrc, (uint8_t)kCLOCK_TreeSourceExtClk,
+                                     (uint8_t)kCLOCK_TreeSourceWdtOsc, (uint8_t)kCLOCK_TreeSourceOsc32k};
+
+    return source[regs->syspllclksel & SYSCON_SYSPLLCLKSEL_SEL_MASK];
+}
+
+/* Source of the main clock selected by MAINCLKSELA and MAINCLKSELB */
+static uint32_t CLOCK_GetTreeMainSource(const clock_tree_regs_t *regs)
+{
+    static const uint8_t sourceA[] = {(uint8_t)kCLOCK_TreeSourceIrc, (uint8_t)kCLOCK_TreeSourceExtClk,
+                                      (uint8_t)kCLOCK_TreeSourceWdtOsc, (uint8_t)kCLOCK_TreeSourceNone};
+    static const uint8_t sourceB[] = {(uint8_t)kCLOCK_TreeSourceNone, (uint8_t)kCLOCK_TreeSourcePllIn,
+                                      (uint8_t)kCLOCK_TreeSourcePllOut, (uint8_t)kCLOCK_TreeSourceOsc32k};
+    uint32_t selB = regs->mainclkselb & SYSCON_MAINCLKSELB_SEL_MASK;
+
+    return (selB == 0U) ? sourceA[regs->mainclksela & SYSCON_MAINCLKSELA_SEL_MASK] : sourceB[selB];
+}
+
+/* Source of the asynchronous APB clock selected by ASYNCAPBCLKSELA and ASYNCAPBCLKSELB */
+static uint32_t CLOCK_GetTreeAsyncApbSource(const clock_tree_regs_t *regs)
+{
+    static const uint8_t sourceA[] = {(uint8_t)kCLOCK_TreeSourceIrc, (uint8_t)kCLOCK_TreeSourceWdtOsc,
+                                      (uint8_t)kCLOCK_TreeSourceNone, (uint8_t)kCLOCK_TreeSourceNone};
+    static const uint8_t sourceB[] = {(uint8_t)kCLOCK_TreeSourceMainClk, (uint8_t)kCLOCK_TreeSourceExtClk,
+                                      (uint8_t)kCLOCK_TreeSourcePllOut, (uint8_t)kCLOCK_TreeSourceNone};
+    uint32_t selB = regs->asyncapbclkselb & ASYNC_SYSCON_ASYNCAPBCLKSELB_SEL_MASK;
+
+    return (selB == 3U) ? sourceA[regs->asyncapbclksela & ASYNC_SYSCON_ASYNCAPBCLKSELA_SEL_MASK] : sourceB[selB];
+}
+
+/* Source of the ADC clock selected by ADCCLKSEL */
+static uint32_t CLOCK_GetTreeAdcSource(const clock_tree_regs_t *regs)
+{
+    static const uint8_t source[] = {(uint8_t)kCLOCK_TreeSourceMainClk, (uint8_t)kCLOCK_TreeSourcePllOut,
+                                     (uint8_t)kCLOCK_TreeSourceIrc, (uint8_t)kCLOCK_TreeSourceNone};
+
+    return source[regs->adcclksel & SYSCON_ADCCLKSEL_SEL_MASK];
+}
+
+/* Source of the clock out selected by CLKOUTSELA and CLKOUTSELB */
+static uint32_t CLOCK_GetTreeClockOutSource(const clock_tree_regs_t *regs)
+{
+    static const uint8_t sourceA[] = {(uint8_t)kCLOCK_TreeSourceMainClk, (uint8_t)kCLOCK_TreeSourceExtClk,
+                                      (uint8_t)kCLOCK_TreeSourceWdtOsc, (uint8_t)kCLOCK_TreeSourceIrc};
+    static const uint8_t sourceB[] = {(uint8_t)kCLOCK_TreeSourceNone, (uint8_t)kCLOCK_TreeSourceNone,
+                                      (uint8_t)kCLOCK_TreeSourceNone, (uint8_t)kCLOCK_TreeSourceOsc32k};
+    uint32_t selB = regs->clkoutselb & SYSCON_CLKOUTSELB_SEL_MASK;
+
+    return (selB == 0U) ? sourceA[regs->clkoutsela & SYSCON_CLKOUTSELA_SEL_MASK] : sourceB[selB];
+}
+
+/*! brief	Get the flash wait states required for the input frequency.
+ *  param	iFreq	: Input frequency
+ *  return	FLASH access time, the one set by CLOCK_SetFLASHAccessCyclesForFreq()
+ */
+clock_flashtim_t CLOCK_GetFLASHAccessCyclesForFreq(uint32_t iFreq)
+{
+    uint32_t i;
+
+    for (i = 0U; i < ARRAY_SIZE(s_Flash_Freq_Limit); i++)
+    {
+        if (iFreq <= s_Flash_Freq_Limit[i])
+        {
+            break;
+        }
+    }
+
+    return (clock_flashtim_t)i;
+}
+
+/*! brief	Describe a clock tree and check it against the device limits
+ *  param	regs	: Clock tree registers, read from the device or proposed
+ *  param	info	: Description of the clock tree, the source, divider and
+ *  rate of each clock
+ *  return	Out of spec combinations found, OR'ed #_clock_tree_violation,
+ *  0 if the clock tree is valid
+ *  note	The model does not access the device, it can be built for the host
+ *  from fsl_clock_tree.c to validate a configuration before it is flashed.
+ *  The clock driver computes its cached clock tree with it, so both agree.
+ */
+uint32_t CLOCK_EvaluateClockTree(const clock_tree_regs_t *regs, clock_tree_info_t *info)
+{
+    uint32_t srcFreq[CLOCK_TREE_SOURCE_COUNT] = {0U};
+    clock_tree_node_t *node;
+    uint32_t violations = 0U;
+    uint32_t pllUsed    = 0U;
+    uint32_t i;
+    bool pllOn;
+    bool asyncApbOn;
+
+    assert(regs != NULL);
+    assert(info != NULL);
+
+    node       = info->clock;
+    pllOn      = ((regs->pdruncfg & SYSCON_PDRUNCFG_PDEN_SYS_PLL_MASK) == 0U);
+    asyncApbOn = ((regs->asyncapbctrl & SYSCON_ASYNCAPBCTRL_ENABLE_MASK) != 0U);
+
+    /* Oscillators */
+    if ((regs->pdruncfg & (SYSCON_PDRUNCFG_PDEN_IRC_OSC_MASK | SYSCON_PDRUNCFG_PDEN_IRC_MASK)) == 0U)
+    {
+        srcFreq[kCLOCK_TreeSourceIrc] = CLK_IRC_12MHZ;
+    }
+    if ((regs->pdruncfg & SYSCON_PDRUNCFG_PDEN_WDT_OSC_MASK) == 0U)
+    {
+        srcFreq[kCLOCK_TreeSourceWdtOsc] = CLK_WDT_OSC;
+    }
+    if ((regs->rtcoscctrl & SYSCON_RTCOSCCTRL_EN_MASK) != 0U)
+    {
+        srcFreq[kCLOCK_TreeSourceOsc32k] = CLK_RTC_32K_CLK;
+    }
+    srcFreq[kCLOCK_TreeSourceExtClk] = regs->extClkRate;
+    node[kCLOCK_Irc]    = (clock_tree_node_t){srcFreq[kCLOCK_TreeSourceIrc], (uint32_t)kCLOCK_TreeSourceNone, 1U};
+    node[kCLOCK_ExtClk] = (clock_tree_node_t){srcFreq[kCLOCK_TreeSourceExtClk], (uint32_t)kCLOCK_TreeSourceNone, 1U};
+    node[kCLOCK_WdtOsc] = (clock_tree_node_t){srcFreq[kCLOCK_TreeSourceWdtOsc], (uint32_t)kCLOCK_TreeSourceNone, 1U};
+
+    /* The PLL output is the rate of the setup applied, as the driver stores it. */
+    srcFreq[kCLOCK_TreeSourcePllIn]  = srcFreq[CLOCK_GetTreePllInSource(regs)];
+    srcFreq[kCLOCK_TreeSourcePllOut] = regs->pllRate;
+    node[kCLOCK_PllOut]              = (clock_tree_node_t){regs->pllRate, CLOCK_GetTreePllInSource(regs), 1U};
+
+    /* Main clock, the core clock and the bus clock are both the AHB clock. */
+    CLOCK_SetTreeNode(&node[kCLOCK_MainClk], srcFreq, CLOCK_GetTreeMainSource(regs), 1U);
+    srcFreq[kCLOCK_TreeSourceMainClk] = node[kCLOCK_MainClk].freq;
+    CLOCK_SetTreeNode(&node[kCLOCK_CoreSysClk], srcFreq, (uint32_t)kCLOCK_TreeSourceMainClk,
+                      regs->ahbclkdiv & SYSCON_AHBCLKDIV_DIV_MASK);
+    node[kCLOCK_BusClk] = node[kCLOCK_CoreSysClk];
+    CLOCK_SetTreeNode(&node[kCLOCK_Adc], srcFreq, CLOCK_GetTreeAdcSource(regs),
+                      regs->adcclkdiv & SYSCON_ADCCLKDIV_DIV_MASK);
+    CLOCK_SetTreeNode(&node[kCLOCK_ClockOut], srcFreq, CLOCK_GetTreeClockOutSource(regs),
+                      regs->clkoutdiv & SYSCON_CLKOUTDIV_DIV_MASK);
+
+    /* Asynchronous APB clock and FRG, stopped while the bridge is disabled */
+    CLOCK_SetTreeNode(&node[kCLOCK_AsyncApbClk], srcFreq,
+                      asyncApbOn ? CLOCK_GetTreeAsyncApbSource(regs) : (uint32_t)kCLOCK_TreeSourceNone,
+                      asyncApbOn ? (regs->asyncclkdiv & ASYNC_SYSCON_ASYNCCLKDIV_DIV_MASK) : 0U);
+    srcFreq[kCLOCK_TreeSourceAsyncApbClk] = node[kCLOCK_AsyncApbClk].freq;
+    node[kCLOCK_FRG] = (clock_tree_node_t){0U, (uint32_t)kCLOCK_TreeSourceAsyncApbClk, 0U};
+    if ((regs->frgctrl & ASYNC_SYSCON_FRGCTRL_DIV_MASK) == ASYNC_SYSCON_FRGCTRL_DIV_MASK)
+    {
+        node[kCLOCK_FRG].divider =
+            (ASYNC_SYSCON_FRGCTRL_DIV_MASK + 1U) +
+            ((regs->frgctrl & ASYNC_SYSCON_FRGCTRL_MULT_MASK) >> ASYNC_SYSCON_FRGCTRL_MULT_SHIFT);
+        node[kCLOCK_FRG].freq = (uint32_t)(((uint64_t)srcFreq[kCLOCK_TreeSourceAsyncApbClk] *
+                                            (ASYNC_SYSCON_FRGCTRL_DIV_MASK + 1U)) /
+                                           node[kCLOCK_FRG].divider);
+    }
+
+    /* FLASH access time */
+    info->flashCycles =
+        (clock_flashtim_t)((regs->flashcfg & SYSCON_FLASHCFG_FLASHTIM_MASK) >> SYSCON_FLASHCFG_FLASHTIM_SHIFT);
+    info->flashCyclesRequired = CLOCK_GetFLASHAccessCyclesForFreq(node[kCLOCK_CoreSysClk].freq);
+
+    /* Checks */
+    if (node[kCLOCK_CoreSysClk].freq == 0U)
+    {
+        violations |= (uint32_t)kCLOCK_TreeCoreClkStopped;
+    }
+    if ((node[kCLOCK_MainClk].freq > SDK_DEVICE_MAXIMUM_CPU_CLOCK_FREQUENCY) ||
+        (node[kCLOCK_CoreSysClk].freq > SDK_DEVICE_MAXIMUM_CPU_CLOCK_FREQUENCY) ||
+        (pllOn && (node[kCLOCK_PllOut].freq > SDK_DEVICE_MAXIMUM_CPU_CLOCK_FREQUENCY)) ||
+        (node[kCLOCK_AsyncApbClk].freq > SDK_DEVICE_MAXIMUM_CPU_CLOCK_FREQUENCY) ||
+        (node[kCLOCK_FRG].freq > SDK_DEVICE_MAXIMUM_CPU_CLOCK_FREQUENCY))
+    {
+        violations |= (uint32_t)kCLOCK_TreeClkTooHigh;
+    }
+    if (info->flashCycles < info->flashCyclesRequired)
+    {
+        violations |= (uint32_t)kCLOCK_TreeFlashTooFast;
+    }
+    for (i = 0U; i < CLOCK_NAME_COUNT; i++)
+    {
+        if ((i != (uint32_t)kCLOCK_PllOut) && (node[i].divider != 0U) &&
+            (node[i].source == (uint32_t)kCLOCK_TreeSourcePllOut))
+        {
+            pllUsed++;
+        }
+    }
+    if ((pllUsed != 0U) && ((!pllOn) || ((regs->syspllstat & SYSCON_SYSPLLSTAT_LOCK_MASK) == 0U)))
+    {
+        violations |= (uint32_t)kCLOCK_TreePllNotLocked;
+    }
+    if (pllOn && (srcFreq[kCLOCK_TreeSourcePllIn] < CLOCK_PLL_MIN_INPUT_FREQ))
+    {
+        violations |= (uint32_t)kCLOCK_TreePllInputTooLow;
+    }
+    if (((node[kCLOCK_Adc].divider != 0U) && (node[kCLOCK_Adc].freq == 0U)) ||
+        ((node[kCLOCK_ClockOut].divider != 0U) && (node[kCLOCK_ClockOut].freq == 0U)) ||
+        ((node[kCLOCK_AsyncApbClk].divider != 0U) && (node[kCLOCK_AsyncApbClk].freq == 0U)))
+    {
+        violations |= (uint32_t)kCLOCK_TreeSourceStopped;
+    }
+    if (asyncApbOn && (regs->asyncapbclkctrl != 0U) && (node[kCLOCK_AsyncApbClk].divider == 0U))
+    {
+        violations |= (uint32_t)kCLOCK_TreeAsyncApbStopped;
+    }
+    if (((regs->asyncapbclkctrl & ASYNC_SYSCON_ASYNCAPBCLKCTRL_FRG0_MASK) != 0U) &&
+        ((regs->frgctrl & ASYNC_SYSCON_FRGCTRL_DIV_MASK) != ASYNC_SYSCON_FRGCTRL_DIV_MASK))
+    {
+        violations |= (uint32_t)kCLOCK_TreeFrgDivInvalid;
+    }
+
+    info->violations = violations;
+
+    return violations;
+}
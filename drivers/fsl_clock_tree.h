@@ -0,0 +1,177 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_CLOCK_TREE_H_
+#define _FSL_CLOCK_TREE_H_
+
+#include <stdint.h>
+
+/*! @addtogroup clock */
+/*! @{ */
+
+/*! @file */
+
+/*******************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/*
+ * The clock tree model only depends on the register values it is given, it does not include the device header so
+ * that it is built for the host as well.
+ */
+
+/* Definition for delay API in clock driver, users can redefine it to the real application. */
+#ifndef SDK_DEVICE_MAXIMUM_CPU_CLOCK_FREQUENCY
+#define SDK_DEVICE_MAXIMUM_CPU_CLOCK_FREQUENCY (150000000UL)
+#endif
+
+/*! @brief Clock name used to get clock frequency. */
+typedef enum _clock_name
+{
+    kCLOCK_MainClk,     /*!< Main clock                                              */
+    kCLOCK_CoreSysClk,  /*!< Core/system clock                                       */
+    kCLOCK_BusClk,      /*!< Bus clock (AHB clock)                                   */
+    kCLOCK_Irc,         /*!< Internal IRC                                            */
+    kCLOCK_ExtClk,      /*!< External Clock                                          */
+    kCLOCK_PllOut,      /*!< PLL Output                                              */
+    kCLOCK_WdtOsc,      /*!< Watchdog Oscillator                                     */
+    kCLOCK_FRG,         /*!< Frg Clock                                               */
+    kCLOCK_AsyncApbClk, /*!< Async APB clock                                         */
+    kCLOCK_Adc,         /*!< ADC clock                                               */
+    kCLOCK_ClockOut,    /*!< Clockout clock                                          */
+} clock_name_t;
+
+/*! @brief Number of clocks of #clock_name_t, all of them are cached by the clock tree model. */
+#define CLOCK_NAME_COUNT ((uint32_t)kCLOCK_ClockOut + 1U)
+
+/**
+ * @brief FLASH Access time definitions
+ */
+typedef enum _clock_flashtim
+{
+    kCLOCK_Flash1Cycle = 0, /*!< Flash accesses use 1 CPU clock */
+    kCLOCK_Flash2Cycle,     /*!< Flash accesses use 2 CPU clocks */
+    kCLOCK_Flash3Cycle,     /*!< Flash accesses use 3 CPU clocks */
+    kCLOCK_Flash4Cycle,     /*!< Flash accesses use 4 CPU clocks */
+    kCLOCK_Flash5Cycle,     /*!< Flash accesses use 5 CPU clocks */
+    kCLOCK_Flash6Cycle,     /*!< Flash accesses use 6 CPU clocks */
+    kCLOCK_Flash7Cycle,     /*!< Flash accesses use 7 CPU clocks */
+} clock_flashtim_t;
+
+/*! @brief Minimum rate of the System PLL input. */
+#define CLOCK_PLL_MIN_INPUT_FREQ (4000U)
+
+/*! @brief Source of a clock of the clock tree description. */
+typedef enum _clock_tree_source
+{
+    kCLOCK_TreeSourceNone = 0U,   /*!< No source, the clock is an oscillator or its selector is reserved */
+    kCLOCK_TreeSourceIrc,         /*!< 12 MHz IRC */
+    kCLOCK_TreeSourceExtClk,      /*!< CLKIN pin */
+    kCLOCK_TreeSourceWdtOsc,      /*!< Watchdog oscillator */
+    kCLOCK_TreeSourceOsc32k,      /*!< RTC 32 kHz oscillator */
+    kCLOCK_TreeSourcePllIn,       /*!< PLL input, the PLL is bypassed */
+    kCLOCK_TreeSourcePllOut,      /*!< PLL output */
+    kCLOCK_TreeSourceMainClk,     /*!< Main clock */
+    kCLOCK_TreeSourceAsyncApbClk, /*!< Asynchronous APB clock */
+} clock_tree_source_t;
+
+/*! @brief Out of spec combinations of the clock tree, OR'ed in the violations of #clock_tree_info_t. */
+enum _clock_tree_violation
+{
+    kCLOCK_TreeCoreClkStopped  = (1U << 0U), /*!< The main clock source is stopped or AHBCLKDIV is 0 */
+    kCLOCK_TreeClkTooHigh      = (1U << 1U), /*!< A main, core, PLL, async APB or FRG rate is above the CPU maximum */
+    kCLOCK_TreeFlashTooFast    = (1U << 2U), /*!< FLASHTIM is below the FLASH access time of the core clock */
+    kCLOCK_TreePllNotLocked    = (1U << 3U), /*!< The PLL output is selected while the PLL is off or not locked */
+    kCLOCK_TreePllInputTooLow  = (1U << 4U), /*!< The PLL is on and its input is below #CLOCK_PLL_MIN_INPUT_FREQ */
+    kCLOCK_TreeSourceStopped   = (1U << 5U), /*!< An ADC, CLKOUT or async APB divider is fed by a stopped source */
+    kCLOCK_TreeAsyncApbStopped = (1U << 6U), /*!< Asynchronous APB peripherals are clocked while ASYNCCLKDIV is 0 */
+    kCLOCK_TreeFrgDivInvalid   = (1U << 7U), /*!< The FRG is clocked while the DIV of FRGCTRL is not 0xFF */
+};
+
+/*! @brief Clock tree registers, the input of the clock tree model.
+ *
+ * It is read from the device by CLOCK_GetClockTreeRegs(), or filled with a proposed configuration to evaluate it
+ * with CLOCK_EvaluateClockTree() before it is applied.
+ */
+typedef struct _clock_tree_regs
+{
+    uint32_t pdruncfg;        /*!< SYSCON PDRUNCFG */
+    uint32_t rtcoscctrl;      /*!< SYSCON RTCOSCCTRL */
+    uint32_t mainclksela;     /*!< SYSCON MAINCLKSELA */
+    uint32_t mainclkselb;     /*!< SYSCON MAINCLKSELB */
+    uint32_t syspllclksel;    /*!< SYSCON SYSPLLCLKSEL */
+    uint32_t syspllstat;      /*!< SYSCON SYSPLLSTAT */
+    uint32_t ahbclkdiv;       /*!< SYSCON AHBCLKDIV */
+    uint32_t adcclksel;       /*!< SYSCON ADCCLKSEL */
+    uint32_t adcclkdiv;       /*!< SYSCON ADCCLKDIV */
+    uint32_t clkoutsela;      /*!< SYSCON CLKOUTSELA */
+    uint32_t clkoutselb;      /*!< SYSCON CLKOUTSELB */
+    uint32_t clkoutdiv;       /*!< SYSCON CLKOUTDIV */
+    uint32_t flashcfg;        /*!< SYSCON FLASHCFG */
+    uint32_t asyncapbctrl;    /*!< SYSCON ASYNCAPBCTRL, the ASYNC_SYSCON registers are 0 if the bridge is disabled */
+    uint32_t asyncapbclksela; /*!< ASYNC_SYSCON ASYNCAPBCLKSELA */
+    uint32_t asyncapbclkselb; /*!< ASYNC_SYSCON ASYNCAPBCLKSELB */
+    uint32_t asyncclkdiv;     /*!< ASYNC_SYSCON ASYNCCLKDIV */
+    uint32_t frgctrl;         /*!< ASYNC_SYSCON FRGCTRL */
+    uint32_t asyncapbclkctrl; /*!< ASYNC_SYSCON ASYNCAPBCLKCTRL */
+    uint32_t pllRate;         /*!< PLL output rate, the pllRate of the #pll_setup_t applied */
+    uint32_t extClkRate;      /*!< CLKIN rate, 0 if it is not used */
+} clock_tree_regs_t;
+
+/*! @brief Clock of the clock tree description. */
+typedef struct _clock_tree_node
+{
+    uint32_t freq;    /*!< Rate in Hz, 0 if the clock is stopped */
+    uint32_t source;  /*!< Source selected, #clock_tree_source_t */
+    uint32_t divider; /*!< Divider from the source, 0 if it stops the clock. For the FRG it is 256 + MULT, the rate
+                           is the source rate * 256 / divider. */
+} clock_tree_node_t;
+
+/*! @brief Description of the clock tree, see CLOCK_EvaluateClockTree(). */
+typedef struct _clock_tree_info
+{
+    clock_tree_node_t clock[CLOCK_NAME_COUNT]; /*!< Clocks indexed by #clock_name_t */
+    clock_flashtim_t flashCycles;              /*!< FLASH access time set */
+    clock_flashtim_t flashCyclesRequired;      /*!< FLASH access time required by the core clock */
+    uint32_t violations;                       /*!< Out of spec combinations, OR'ed #_clock_tree_violation */
+} clock_tree_info_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief	Get the flash wait states required for the input frequency.
+ * @param	iFreq	: Input frequency
+ * @return	FLASH access time, the one set by CLOCK_SetFLASHAccessCyclesForFreq()
+ */
+clock_flashtim_t CLOCK_GetFLASHAccessCyclesForFreq(uint32_t iFreq);
+
+/*! @brief	Describe a clock tree and check it against the device limits
+ *  @param	regs	: Clock tree registers, read from the device or proposed
+ *  @param	info	: Description of the clock tree, the source, divider and
+ *  rate of each clock
+ *  @return	Out of spec combinations found, OR'ed #_clock_tree_violation,
+ *  0 if the clock tree is valid
+ *  @note	The model does not access the device, fsl_clock_tree.c and this
+ *  header are built for the host as well to validate a configuration before
+ *  it is flashed, see test/clock_tree_test.c. The clock driver computes its
+ *  cached clock tree with it, so both agree.
+ */
+uint32_t CLOCK_EvaluateClockTree(const clock_tree_regs_t *regs, clock_tree_info_t *info);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*! @} */
+
+#endif /* _FSL_CLOCK_TREE_H_ */
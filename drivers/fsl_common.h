@@ -154,6 +154,7 @@ enum _status_groups
     kStatusGroup_SDK_FLEXSPINOR = 147,        /*!< Group number for FLEXSPINOR status codes.*/
     kStatusGroup_CODEC = 148,                 /*!< Group number for codec status codes. */
     kStatusGroup_ASRC = 149,                 /*!< Group number for codec status ASRC. */
+    kStatusGroup_DVFS = 150,                  /*!< Group number for DVFS status codes. */
 };
 
 /*! @brief Generic status return codes. */
@@ -0,0 +1,551 @@
+/*
+ * Copyright (c) 2016, Freescale Semiconductor, Inc.
+ * Copyright 2016-2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_dma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.lpc_dma"
+#endif
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*!
+ * @brief Get instance number for DMA.
+ *
+ * @param base DMA peripheral base address.
+ */
+static uint32_t DMA_GetInstance(DMA_Type *base);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/*! @brief Array to map DMA instance number to base pointer. */
+static DMA_Type *const s_dmaBases[] = DMA_BASE_PTRS;
+
+#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
+/*! @brief Array to map DMA instance number to clock name. */
+static const clock_ip_name_t s_dmaClockName[] = DMA_CLOCKS;
+#endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
+
+/*! @brief Pointers to DMA resets for each instance. */
+static const reset_ip_name_t s_dmaResets[] = DMA_RSTS_N;
+
+/*! @brief Array to map DMA instance number to IRQ number. */
+static const IRQn_Type s_dmaIRQNumber[] = DMA_IRQS;
+
+/*! @brief Pointers to transfer handle for each DMA channel. */
+static dma_handle_t *s_DMAHandle[FSL_FEATURE_DMA_NUMBER_OF_CHANNELS];
+
+/*! @brief The channels requested or allocated, one bit per channel. */
+static uint32_t s_dmaRequestedChannels[ARRAY_SIZE(s_dmaBases)];
+
+/*! @brief Channel descriptor table, the hardware loads the head descriptor of each channel from it. */
+SDK_ALIGN(static dma_descriptor_t s_dma_descriptor_table[FSL_FEATURE_DMA_NUMBER_OF_CHANNELS],
+          FSL_FEATURE_DMA_DESCRIPTOR_ALIGN_SIZE);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t DMA_GetInstance(DMA_Type *base)
+{
+    uint32_t instance;
+    /* Find the instance index from base address mappings. */
+    for (instance = 0; instance < ARRAY_SIZE(s_dmaBases); instance++)
+    {
+        if (s_dmaBases[instance] == base)
+        {
+            break;
+        }
+    }
+    assert(instance < ARRAY_SIZE(s_dmaBases));
+
+    return instance;
+}
+
+/* The descriptor holds the address of the last element, the stride is worked out from the width and increment. */
+static void *DMA_GetEndAddress(void *startAddr, uint32_t xfercfg, uint32_t inc)
+{
+    uint32_t width = 1UL << ((xfercfg & DMA_CHANNEL_XFERCFG_WIDTH_MASK) >> DMA_CHANNEL_XFERCFG_WIDTH_SHIFT);
+    uint32_t count = (xfercfg & DMA_CHANNEL_XFERCFG_XFERCOUNT_MASK) >> DMA_CHANNEL_XFERCFG_XFERCOUNT_SHIFT;
+
+    if (0U == inc)
+    {
+        return startAddr;
+    }
+    return (void *)((uint32_t)startAddr + count * (width << (inc - 1U)));
+}
+
+/*!
+ * brief Initializes DMA peripheral.
+ *
+ * This function enables the DMA clock, resets the DMA, sets the channel descriptor table and enables the DMA.
+ * It should be called once before any channel is used, DMA_IsInitialized tells whether it has been called.
+ *
+ * param base DMA peripheral base address.
+ */
+void DMA_Init(DMA_Type *base)
+{
+    uint32_t instance = DMA_GetInstance(base);
+
+#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
+    /* enable dma clock gate */
+    CLOCK_EnableClock(s_dmaClockName[instance]);
+#endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
+    /* reset dma */
+    RESET_PeripheralReset(s_dmaResets[instance]);
+
+    s_dmaRequestedChannels[instance] = 0U;
+
+    /* set descriptor table */
+    base->SRAMBASE = (uint32_t)s_dma_descriptor_table;
+    /* enable dma peripheral */
+    base->CTRL |= DMA_CTRL_ENABLE_MASK;
+}
+
+/*!
+ * brief Deinitializes DMA peripheral.
+ *
+ * This function gates the DMA clock, all the channels are released.
+ *
+ * param base DMA peripheral base address.
+ */
+void DMA_Deinit(DMA_Type *base)
+{
+    uint32_t instance = DMA_GetInstance(base);
+
+    /* Disable DMA peripheral */
+    base->CTRL &= ~(DMA_CTRL_ENABLE_MASK);
+    s_dmaRequestedChannels[instance] = 0U;
+
+#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
+    CLOCK_DisableClock(s_dmaClockName[instance]);
+#endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
+}
+
+/*!
+ * brief Requests a given channel.
+ *
+ * The peripheral requests are bound to fixed channels, the drivers of the peripherals request their channels to
+ * detect the conflicts.
+ *
+ * param base DMA peripheral base address.
+ * param channel DMA channel number.
+ * retval kStatus_Success The channel is requested.
+ * retval kStatus_DMA_Busy The channel has been requested.
+ */
+status_t DMA_RequestChannel(DMA_Type *base, uint32_t channel)
+{
+    uint32_t instance = DMA_GetInstance(base);
+    status_t status   = kStatus_Success;
+    uint32_t regPrimask;
+
+    assert(channel < FSL_FEATURE_DMA_NUMBER_OF_CHANNELS);
+
+    regPrimask = DisableGlobalIRQ();
+    if (0U != (s_dmaRequestedChannels[instance] & (1UL << channel)))
+    {
+        status = kStatus_DMA_Busy;
+    }
+    else
+    {
+        s_dmaRequestedChannels[instance] |= (1UL << channel);
+    }
+    EnableGlobalIRQ(regPrimask);
+
+    return status;
+}
+
+/*!
+ * brief Allocates a free channel for the memory to memory transfer.
+ *
+ * The channels are searched from the highest, which are the least likely to be bound to the used peripherals.
+ *
+ * param base DMA peripheral base address.
+ * param channel Pointer to the allocated channel number.
+ * retval kStatus_Success A channel is allocated.
+ * retval kStatus_DMA_NoFreeChannel All the channels have been requested.
+ */
+status_t DMA_AllocateChannel(DMA_Type *base, uint32_t *channel)
+{
+    uint32_t instance = DMA_GetInstance(base);
+    uint32_t regPrimask;
+    uint32_t i;
+
+    assert(channel);
+
+    regPrimask = DisableGlobalIRQ();
+    for (i = FSL_FEATURE_DMA_NUMBER_OF_CHANNELS; i > 0U; i--)
+    {
+        if (0U == (s_dmaRequestedChannels[instance] & (1UL << (i - 1U))))
+        {
+            s_dmaRequestedChannels[instance] |= (1UL << (i - 1U));
+            break;
+        }
+    }
+    EnableGlobalIRQ(regPrimask);
+
+    if (0U == i)
+    {
+        return kStatus_DMA_NoFreeChannel;
+    }
+    *channel = i - 1U;
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Releases a channel requested or allocated.
+ *
+ * The handle created for the channel is forgotten, so that a late interrupt of the channel is not delivered to it.
+ *
+ * param base DMA peripheral base address.
+ * param channel DMA channel number.
+ */
+void DMA_ReleaseChannel(DMA_Type *base, uint32_t channel)
+{
+    uint32_t instance = DMA_GetInstance(base);
+    uint32_t regPrimask;
+
+    assert(channel < FSL_FEATURE_DMA_NUMBER_OF_CHANNELS);
+
+    regPrimask = DisableGlobalIRQ();
+    s_dmaRequestedChannels[instance] &= ~(1UL << channel);
+    s_DMAHandle[channel] = NULL;
+    EnableGlobalIRQ(regPrimask);
+}
+
+/*!
+ * brief Gets the remaining bytes of the current DMA descriptor transfer.
+ *
+ * param base DMA peripheral base address.
+ * param channel DMA channel number.
+ * return The number of bytes which have not been transferred yet, 0 if the channel is not active.
+ */
+uint32_t DMA_GetRemainingBytes(DMA_Type *base, uint32_t channel)
+{
+    uint32_t xfercfg;
+
+    assert(channel < FSL_FEATURE_DMA_NUMBER_OF_CHANNELS);
+
+    /* NOTE: when descriptors are chained, ACTIVE bit remains set */
+    if (DMA_ChannelIsActive(base, channel))
+    {
+        xfercfg = base->CHANNEL[channel].XFERCFG;
+        /* The count reads 0x3FF once the last element is moved. */
+        return ((((xfercfg & DMA_CHANNEL_XFERCFG_XFERCOUNT_MASK) >> DMA_CHANNEL_XFERCFG_XFERCOUNT_SHIFT) + 1U) &
+                (DMA_MAX_TRANSFER_COUNT - 1U))
+               << ((xfercfg & DMA_CHANNEL_XFERCFG_WIDTH_MASK) >> DMA_CHANNEL_XFERCFG_WIDTH_SHIFT);
+    }
+
+    return 0U;
+}
+
+/*!
+ * brief Sets up a DMA descriptor.
+ *
+ * The end addresses of the descriptor are worked out from the start addresses and the transfer configuration.
+ *
+ * param desc The descriptor, 16 bytes aligned if it is linked by another descriptor.
+ * param xfercfg The transfer configuration, made by #DMA_CHANNEL_XFER.
+ * param srcStartAddr Start address of the source.
+ * param dstStartAddr Start address of the destination.
+ * param nextDesc The descriptor linked after it, NULL for the last descriptor of a chain.
+ */
+void DMA_SetupDescriptor(
+    dma_descriptor_t *desc, uint32_t xfercfg, void *srcStartAddr, void *dstStartAddr, void *nextDesc)
+{
+    assert(desc);
+    assert(0U == ((uint32_t)nextDesc & (FSL_FEATURE_DMA_LINK_DESCRIPTOR_ALIGN_SIZE - 1U)));
+
+    desc->xfercfg    = xfercfg;
+    desc->srcEndAddr = DMA_GetEndAddress(
+        srcStartAddr, xfercfg, (xfercfg & DMA_CHANNEL_XFERCFG_SRCINC_MASK) >> DMA_CHANNEL_XFERCFG_SRCINC_SHIFT);
+    desc->dstEndAddr = DMA_GetEndAddress(
+        dstStartAddr, xfercfg, (xfercfg & DMA_CHANNEL_XFERCFG_DSTINC_MASK) >> DMA_CHANNEL_XFERCFG_DSTINC_SHIFT);
+    desc->linkToNextDesc = nextDesc;
+}
+
+/*!
+ * brief Sets up a pair of descriptors linked to each other, for a continuous transfer through a ring.
+ *
+ * The ring is split into two halves, each moved by one of the descriptors. The first descriptor raises the
+ * interrupt A and the second one the interrupt B, so that one half is processed while the other is moved.
+ * The transfer runs until it is aborted.
+ *
+ * param desc Array of two descriptors, 16 bytes aligned.
+ * param xfercfg The transfer configuration of one half, made by #DMA_CHANNEL_XFER. The reload and interrupt
+ *               settings are overridden, the trigger should not be cleared.
+ * param srcStartAddr Start address of the source of the first half.
+ * param dstStartAddr Start address of the destination of the first half.
+ */
+void DMA_SetupPingPongDescriptors(dma_descriptor_t *desc, uint32_t xfercfg, void *srcStartAddr, void *dstStartAddr)
+{
+    uint32_t srcInc = (xfercfg & DMA_CHANNEL_XFERCFG_SRCINC_MASK) >> DMA_CHANNEL_XFERCFG_SRCINC_SHIFT;
+    uint32_t dstInc = (xfercfg & DMA_CHANNEL_XFERCFG_DSTINC_MASK) >> DMA_CHANNEL_XFERCFG_DSTINC_SHIFT;
+    void *srcHalfAddr;
+    void *dstHalfAddr;
+
+    assert(desc);
+    assert(0U == (xfercfg & DMA_CHANNEL_XFERCFG_CLRTRIG_MASK));
+
+    xfercfg &= ~(DMA_CHANNEL_XFERCFG_SETINTA_MASK | DMA_CHANNEL_XFERCFG_SETINTB_MASK);
+    xfercfg |= DMA_CHANNEL_XFERCFG_RELOAD_MASK;
+
+    /* The second half starts one stride after the end of the first half. */
+    srcHalfAddr = srcStartAddr;
+    dstHalfAddr = dstStartAddr;
+    if (0U != srcInc)
+    {
+        srcHalfAddr = (void *)((uint32_t)DMA_GetEndAddress(srcStartAddr, xfercfg, srcInc) +
+                               ((1UL << ((xfercfg & DMA_CHANNEL_XFERCFG_WIDTH_MASK) >> DMA_CHANNEL_XFERCFG_WIDTH_SHIFT))
+                                << (srcInc - 1U)));
+    }
+    if (0U != dstInc)
+    {
+        dstHalfAddr = (void *)((uint32_t)DMA_GetEndAddress(dstStartAddr, xfercfg, dstInc) +
+                               ((1UL << ((xfercfg & DMA_CHANNEL_XFERCFG_WIDTH_MASK) >> DMA_CHANNEL_XFERCFG_WIDTH_SHIFT))
+                                << (dstInc - 1U)));
+    }
+
+    DMA_SetupDescriptor(&desc[0], xfercfg | DMA_CHANNEL_XFERCFG_SETINTA_MASK, srcStartAddr, dstStartAddr, &desc[1]);
+    DMA_SetupDescriptor(&desc[1], xfercfg | DMA_CHANNEL_XFERCFG_SETINTB_MASK, srcHalfAddr, dstHalfAddr, &desc[0]);
+}
+
+/*!
+ * brief Gets the offset in the ring of the next element moved by a ping-pong transfer.
+ *
+ * The offset is taken from a single read of the channel transfer configuration, which tells both the active half
+ * and the progress in it, so it is consistent while the channel switches between the halves.
+ *
+ * param handle DMA handle pointer.
+ * return The offset in bytes from the start of the ring, it is the number of bytes the receiver has produced.
+ */
+uint32_t DMA_GetPingPongOffset(dma_handle_t *handle)
+{
+    uint32_t xfercfg;
+    uint32_t width;
+    uint32_t count;
+    uint32_t remaining;
+
+    assert(handle);
+
+    /* The head descriptor keeps the full count of a half. */
+    count = ((s_dma_descriptor_table[handle->channel].xfercfg & DMA_CHANNEL_XFERCFG_XFERCOUNT_MASK) >>
+             DMA_CHANNEL_XFERCFG_XFERCOUNT_SHIFT) +
+            1U;
+    assert(count < DMA_MAX_TRANSFER_COUNT);
+
+    xfercfg   = handle->base->CHANNEL[handle->channel].XFERCFG;
+    width     = (xfercfg & DMA_CHANNEL_XFERCFG_WIDTH_MASK) >> DMA_CHANNEL_XFERCFG_WIDTH_SHIFT;
+    remaining = (((xfercfg & DMA_CHANNEL_XFERCFG_XFERCOUNT_MASK) >> DMA_CHANNEL_XFERCFG_XFERCOUNT_SHIFT) + 1U) &
+                (DMA_MAX_TRANSFER_COUNT - 1U);
+
+    if (0U != (xfercfg & DMA_CHANNEL_XFERCFG_SETINTB_MASK))
+    {
+        return (count + count - remaining) << width;
+    }
+    return (count - remaining) << width;
+}
+
+/*!
+ * brief Abort running transfer by handle.
+ *
+ * This function aborts DMA transfer specified by handle.
+ *
+ * param handle DMA handle pointer.
+ */
+void DMA_AbortTransfer(dma_handle_t *handle)
+{
+    assert(NULL != handle);
+
+    DMA_DisableChannel(handle->base, handle->channel);
+    while (DMA_ChannelIsBusy(handle->base, handle->channel))
+    {
+    }
+    handle->base->COMMON[0].ABORT = 1UL << handle->channel;
+    DMA_EnableChannel(handle->base, handle->channel);
+}
+
+/*!
+ * brief Creates the DMA handle.
+ *
+ * This function is called if using transaction API for DMA. This function
+ * initializes the internal state of DMA handle, enables the channel and its interrupt.
+ *
+ * param handle DMA handle pointer. The DMA handle stores callback function and
+ *               parameters.
+ * param base DMA peripheral base address.
+ * param channel DMA channel number.
+ */
+void DMA_CreateHandle(dma_handle_t *handle, DMA_Type *base, uint32_t channel)
+{
+    assert((NULL != handle) && (channel < FSL_FEATURE_DMA_NUMBER_OF_CHANNELS));
+
+    (void)memset(handle, 0, sizeof(*handle));
+    handle->base    = base;
+    handle->channel = (uint8_t)channel;
+
+    s_DMAHandle[channel] = handle;
+    /* Enable NVIC interrupt */
+    (void)EnableIRQ(s_dmaIRQNumber[DMA_GetInstance(base)]);
+    /* Enable channel interrupt */
+    DMA_EnableChannelInterrupts(base, channel);
+    DMA_EnableChannel(base, channel);
+}
+
+/*!
+ * brief Installs a callback function for the DMA transfer.
+ *
+ * This callback is called in DMA IRQ handler. Use the callback to do something after
+ * the current major loop transfer completes.
+ *
+ * param handle DMA handle pointer.
+ * param callback DMA callback function pointer.
+ * param userData Parameter for callback function.
+ */
+void DMA_SetCallback(dma_handle_t *handle, dma_callback callback, void *userData)
+{
+    assert(handle != NULL);
+
+    handle->callback = callback;
+    handle->userData = userData;
+}
+
+/*!
+ * brief Submits a single transfer to the channel.
+ *
+ * param handle DMA handle pointer.
+ * param xfercfg The transfer configuration, made by #DMA_CHANNEL_XFER.
+ * param srcStartAddr Start address of the source.
+ * param dstStartAddr Start address of the destination.
+ * param nextDesc The descriptor linked after it, NULL if there is no following transfer.
+ */
+void DMA_SubmitChannelTransferParameter(
+    dma_handle_t *handle, uint32_t xfercfg, void *srcStartAddr, void *dstStartAddr, void *nextDesc)
+{
+    assert(handle != NULL);
+
+    DMA_SetupDescriptor(&s_dma_descriptor_table[handle->channel], xfercfg, srcStartAddr, dstStartAddr, nextDesc);
+    handle->base->CHANNEL[handle->channel].XFERCFG = xfercfg;
+}
+
+/*!
+ * brief Submits the head descriptor of a chain to the channel.
+ *
+ * The descriptor is copied into the channel descriptor table, the descriptors it links to are used in place.
+ *
+ * param handle DMA handle pointer.
+ * param descriptor The head descriptor.
+ */
+void DMA_SubmitChannelDescriptor(dma_handle_t *handle, dma_descriptor_t *descriptor)
+{
+    assert((handle != NULL) && (descriptor != NULL));
+
+    s_dma_descriptor_table[handle->channel].xfercfg        = descriptor->xfercfg;
+    s_dma_descriptor_table[handle->channel].srcEndAddr     = descriptor->srcEndAddr;
+    s_dma_descriptor_table[handle->channel].dstEndAddr     = descriptor->dstEndAddr;
+    s_dma_descriptor_table[handle->channel].linkToNextDesc = descriptor->linkToNextDesc;
+    handle->base->CHANNEL[handle->channel].XFERCFG         = descriptor->xfercfg;
+}
+
+/*!
+ * brief DMA start transfer.
+ *
+ * This function enables the channel request. User can call this function after submitting the transfer request.
+ * The transfer of a channel with the peripheral request enabled is paced by the peripheral.
+ *
+ * param handle DMA handle pointer.
+ */
+void DMA_StartTransfer(dma_handle_t *handle)
+{
+    assert(NULL != handle);
+
+    /* Enable channel interrupt */
+    handle->base->COMMON[0].INTENSET = 1UL << handle->channel;
+    /* If HW trigger is enabled - disable SW trigger */
+    if (0U != (handle->base->CHANNEL[handle->channel].CFG & DMA_CHANNEL_CFG_HWTRIGEN_MASK))
+    {
+        handle->base->CHANNEL[handle->channel].XFERCFG &= ~(DMA_CHANNEL_XFERCFG_SWTRIG_MASK);
+    }
+    /* Otherwise enable SW trigger */
+    else
+    {
+        handle->base->CHANNEL[handle->channel].XFERCFG |= DMA_CHANNEL_XFERCFG_SWTRIG_MASK;
+    }
+}
+
+/*!
+ * brief DMA IRQ handler, it calls the callbacks of the channels with a pending interrupt.
+ *
+ * param base DMA peripheral base address.
+ */
+void DMA_IRQHandle(DMA_Type *base)
+{
+    dma_handle_t *handle;
+    uint32_t intA;
+    uint32_t intB;
+    uint32_t intError;
+    uint32_t pending;
+    uint32_t channel;
+    uint32_t intmode;
+
+    intA     = base->COMMON[0].INTA;
+    intB     = base->COMMON[0].INTB;
+    intError = base->COMMON[0].ERRINT;
+    /* Clear the flags before the callbacks, which could submit the next transfer. */
+    base->COMMON[0].INTA   = intA;
+    base->COMMON[0].INTB   = intB;
+    base->COMMON[0].ERRINT = intError;
+
+    pending = intA | intB | intError;
+    while (0U != pending)
+    {
+        channel = 31U - __CLZ(pending);
+        pending &= ~(1UL << channel);
+
+        handle = s_DMAHandle[channel];
+        if ((NULL == handle) || (NULL == handle->callback))
+        {
+            continue;
+        }
+
+        intmode = 0U;
+        if (0U != (intA & (1UL << channel)))
+        {
+            intmode |= kDMA_IntA;
+        }
+        if (0U != (intB & (1UL << channel)))
+        {
+            intmode |= kDMA_IntB;
+        }
+        if (0U != (intError & (1UL << channel)))
+        {
+            intmode |= kDMA_IntError;
+        }
+        handle->callback(handle, handle->userData, (0U != (intmode & (kDMA_IntA | kDMA_IntB))), intmode);
+    }
+}
+
+void DMA0_DriverIRQHandler(void)
+{
+    DMA_IRQHandle(DMA0);
+/* Add for ARM errata 838869, affects Cortex-M4, Cortex-M4F Store immediate overlapping
+  exception return operation might vector to incorrect interrupt */
+#if defined __CORTEX_M && (__CORTEX_M == 4U)
+    __DSB();
+#endif
+}
@@ -0,0 +1,512 @@
+/*
+ * Copyright (c) 2016, Freescale Semiconductor, Inc.
+ * Copyright 2016-2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_DMA_H_
+#define _FSL_DMA_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup dma
+ * @{
+ */
+
+/*! @file */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @name Driver version */
+/*@{*/
+/*! @brief DMA driver version 2.0.0. */
+#define FSL_DMA_DRIVER_VERSION (MAKE_VERSION(2, 0, 0))
+/*@}*/
+
+/*! @brief DMA max transfer size, in elements of the transfer width */
+#define DMA_MAX_TRANSFER_COUNT (0x400U)
+
+/*!
+ * @brief Makes the transfer configuration of a descriptor.
+ *
+ * @param reload Reload the channel from the linked descriptor once the transfer is done.
+ * @param clrTrig Clear the trigger of the channel once the transfer is done.
+ * @param intA Raise the interrupt A once the transfer is done.
+ * @param intB Raise the interrupt B once the transfer is done.
+ * @param width Width of the element in bytes, 1, 2 or 4.
+ * @param srcInc Source address increment in elements, 0, 1, 2 or 4.
+ * @param dstInc Destination address increment in elements, 0, 1, 2 or 4.
+ * @param bytes Number of bytes of the transfer, up to #DMA_MAX_TRANSFER_COUNT elements.
+ */
+#define DMA_CHANNEL_XFER(reload, clrTrig, intA, intB, width, srcInc, dstInc, bytes)                                 \
+    (DMA_CHANNEL_XFERCFG_CFGVALID_MASK | DMA_CHANNEL_XFERCFG_RELOAD(reload) | DMA_CHANNEL_XFERCFG_CLRTRIG(clrTrig) | \
+     DMA_CHANNEL_XFERCFG_SETINTA(intA) | DMA_CHANNEL_XFERCFG_SETINTB(intB) |                                     \
+     DMA_CHANNEL_XFERCFG_WIDTH((width) == 4U ? 2U : ((width)-1U)) |                                              \
+     DMA_CHANNEL_XFERCFG_SRCINC((srcInc) == 4U ? ((srcInc)-1U) : (srcInc)) |                                     \
+     DMA_CHANNEL_XFERCFG_DSTINC((dstInc) == 4U ? ((dstInc)-1U) : (dstInc)) |                                     \
+     DMA_CHANNEL_XFERCFG_XFERCOUNT((bytes) / (width)-1U))
+
+/*! @brief _dma_status DMA transfer status */
+enum _dma_status
+{
+    kStatus_DMA_Busy          = MAKE_STATUS(kStatusGroup_DMA, 0), /*!< Channel is busy or already requested */
+    kStatus_DMA_NoFreeChannel = MAKE_STATUS(kStatusGroup_DMA, 1), /*!< All the channels are requested */
+};
+
+/*! @brief DMA descriptor structure, the descriptors of a chain are 16 bytes aligned. */
+typedef struct _dma_descriptor
+{
+    volatile uint32_t xfercfg; /*!< Transfer configuration */
+    void *srcEndAddr;          /*!< Last source address of DMA transfer */
+    void *dstEndAddr;          /*!< Last destination address of DMA transfer */
+    void *linkToNextDesc;      /*!< Address of next DMA descriptor in chain */
+} dma_descriptor_t;
+
+/*! @brief DMA interrupt flags */
+enum _dma_interrupt_flags
+{
+    kDMA_IntA     = 0x1U, /*!< DMA interrupt flag A */
+    kDMA_IntB     = 0x2U, /*!< DMA interrupt flag B */
+    kDMA_IntError = 0x4U, /*!< DMA interrupt flag error */
+};
+
+/*! @brief DMA channel priority */
+typedef enum _dma_priority
+{
+    kDMA_ChannelPriority0 = 0, /*!< Highest channel priority - priority 0 */
+    kDMA_ChannelPriority1,     /*!< Channel priority 1 */
+    kDMA_ChannelPriority2,     /*!< Channel priority 2 */
+    kDMA_ChannelPriority3,     /*!< Channel priority 3 */
+    kDMA_ChannelPriority4,     /*!< Channel priority 4 */
+    kDMA_ChannelPriority5,     /*!< Channel priority 5 */
+    kDMA_ChannelPriority6,     /*!< Channel priority 6 */
+    kDMA_ChannelPriority7,     /*!< Lowest channel priority - priority 7 */
+} dma_priority_t;
+
+/*! @brief DMA hardware trigger type, the trigger is routed to the channel by the input multiplexing. */
+typedef enum _dma_trigger_type
+{
+    /*! The channel is started by software */
+    kDMA_NoTrigger = 0U,
+    /*! Low level trigger */
+    kDMA_LowLevelTrigger = DMA_CHANNEL_CFG_HWTRIGEN(1) | DMA_CHANNEL_CFG_TRIGTYPE(1),
+    /*! High level trigger */
+    kDMA_HighLevelTrigger = DMA_CHANNEL_CFG_HWTRIGEN(1) | DMA_CHANNEL_CFG_TRIGTYPE(1) | DMA_CHANNEL_CFG_TRIGPOL(1),
+    /*! Falling edge trigger */
+    kDMA_FallingEdgeTrigger = DMA_CHANNEL_CFG_HWTRIGEN(1),
+    /*! Rising edge trigger */
+    kDMA_RisingEdgeTrigger = DMA_CHANNEL_CFG_HWTRIGEN(1) | DMA_CHANNEL_CFG_TRIGPOL(1),
+} dma_trigger_type_t;
+
+/*! @brief Amount of data moved by a DMA hardware trigger. */
+typedef enum _dma_trigger_burst
+{
+    /*! A trigger starts the whole descriptor transfer */
+    kDMA_SingleTransfer = 0U,
+    /*! An edge trigger moves 1 element */
+    kDMA_EdgeBurstTransfer1 = DMA_CHANNEL_CFG_TRIGBURST(1),
+    /*! An edge trigger moves 2 elements */
+    kDMA_EdgeBurstTransfer2 = DMA_CHANNEL_CFG_TRIGBURST(1) | DMA_CHANNEL_CFG_BURSTPOWER(1),
+    /*! An edge trigger moves 4 elements */
+    kDMA_EdgeBurstTransfer4 = DMA_CHANNEL_CFG_TRIGBURST(1) | DMA_CHANNEL_CFG_BURSTPOWER(2),
+    /*! An edge trigger moves 8 elements */
+    kDMA_EdgeBurstTransfer8 = DMA_CHANNEL_CFG_TRIGBURST(1) | DMA_CHANNEL_CFG_BURSTPOWER(3),
+} dma_trigger_burst_t;
+
+struct _dma_handle;
+
+/*!
+ * @brief Define Callback function for DMA.
+ *
+ * @param handle The DMA handle.
+ * @param userData The user data installed with the callback.
+ * @param transferDone Whether a descriptor raising interrupt A or B is done.
+ * @param intmode The interrupt flags, OR'ed value of #_dma_interrupt_flags.
+ */
+typedef void (*dma_callback)(struct _dma_handle *handle, void *userData, bool transferDone, uint32_t intmode);
+
+/*! @brief DMA transfer handle structure */
+typedef struct _dma_handle
+{
+    dma_callback callback; /*!< Callback function. Invoked when transfer
+                               of descriptor with interrupt flag finishes */
+    void *userData;        /*!< Callback function parameter */
+    DMA_Type *base;        /*!< DMA peripheral base address */
+    uint8_t channel;       /*!< DMA channel number */
+} dma_handle_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @name DMA initialization and De-initialization
+ * @{
+ */
+
+/*!
+ * @brief Initializes DMA peripheral.
+ *
+ * This function enables the DMA clock, resets the DMA, sets the channel descriptor table and enables the DMA.
+ * It should be called once before any channel is used, DMA_IsInitialized tells whether it has been called.
+ *
+ * @param base DMA peripheral base address.
+ */
+void DMA_Init(DMA_Type *base);
+
+/*!
+ * @brief Deinitializes DMA peripheral.
+ *
+ * This function gates the DMA clock, all the channels are released.
+ *
+ * @param base DMA peripheral base address.
+ */
+void DMA_Deinit(DMA_Type *base);
+
+/*!
+ * @brief Checks whether the DMA is initialized.
+ *
+ * It lets the modules sharing the DMA initialize it on first use without resetting the running channels.
+ *
+ * @param base DMA peripheral base address.
+ * @return true if the DMA is enabled.
+ */
+static inline bool DMA_IsInitialized(DMA_Type *base)
+{
+    return (0U != (base->CTRL & DMA_CTRL_ENABLE_MASK));
+}
+
+/* @} */
+
+/*!
+ * @name DMA channel allocation
+ * @{
+ */
+
+/*!
+ * @brief Requests a given channel.
+ *
+ * The peripheral requests are bound to fixed channels, the drivers of the peripherals request their channels to
+ * detect the conflicts.
+ *
+ * @param base DMA peripheral base address.
+ * @param channel DMA channel number.
+ * @retval kStatus_Success The channel is requested.
+ * @retval kStatus_DMA_Busy The channel has been requested.
+ */
+status_t DMA_RequestChannel(DMA_Type *base, uint32_t channel);
+
+/*!
+ * @brief Allocates a free channel for the memory to memory transfer.
+ *
+ * The channels are searched from the highest, which are the least likely to be bound to the used peripherals.
+ *
+ * @param base DMA peripheral base address.
+ * @param channel Pointer to the allocated channel number.
+ * @retval kStatus_Success A channel is allocated.
+ * @retval kStatus_DMA_NoFreeChannel All the channels have been requested.
+ */
+status_t DMA_AllocateChannel(DMA_Type *base, uint32_t *channel);
+
+/*!
+ * @brief Releases a channel requested or allocated.
+ *
+ * The handle created for the channel is forgotten, so that a late interrupt of the channel is not delivered to it.
+ *
+ * @param base DMA peripheral base address.
+ * @param channel DMA channel number.
+ */
+void DMA_ReleaseChannel(DMA_Type *base, uint32_t channel);
+
+/* @} */
+
+/*!
+ * @name DMA Channel Operation
+ * @{
+ */
+
+/*!
+ * @brief Return whether DMA channel is processing transfer
+ *
+ * @param base DMA peripheral base address.
+ * @param channel DMA channel number.
+ * @return True for active state, false otherwise.
+ */
+static inline bool DMA_ChannelIsActive(DMA_Type *base, uint32_t channel)
+{
+    assert(channel < FSL_FEATURE_DMA_NUMBER_OF_CHANNELS);
+    return (base->COMMON[0].ACTIVE & (1UL << channel)) ? true : false;
+}
+
+/*!
+ * @brief Return whether DMA channel is busy
+ *
+ * @param base DMA peripheral base address.
+ * @param channel DMA channel number.
+ * @return True for busy state, false otherwise.
+ */
+static inline bool DMA_ChannelIsBusy(DMA_Type *base, uint32_t channel)
+{
+    assert(channel < FSL_FEATURE_DMA_NUMBER_OF_CHANNELS);
+    return (base->COMMON[0].BUSY & (1UL << channel)) ? true : false;
+}
+
+/*!
+ * @brief Enables the interrupt source for the DMA transfer.
+ *
+ * @param base DMA peripheral base address.
+ * @param channel DMA channel number.
+ */
+static inline void DMA_EnableChannelInterrupts(DMA_Type *base, uint32_t channel)
+{
+    assert(channel < FSL_FEATURE_DMA_NUMBER_OF_CHANNELS);
+    base->COMMON[0].INTENSET = 1UL << channel;
+}
+
+/*!
+ * @brief Disables the interrupt source for the DMA transfer.
+ *
+ * @param base DMA peripheral base address.
+ * @param channel DMA channel number.
+ */
+static inline void DMA_DisableChannelInterrupts(DMA_Type *base, uint32_t channel)
+{
+    assert(channel < FSL_FEATURE_DMA_NUMBER_OF_CHANNELS);
+    base->COMMON[0].INTENCLR = 1UL << channel;
+}
+
+/*!
+ * @brief Enable DMA channel.
+ *
+ * @param base DMA peripheral base address.
+ * @param channel DMA channel number.
+ */
+static inline void DMA_EnableChannel(DMA_Type *base, uint32_t channel)
+{
+    assert(channel < FSL_FEATURE_DMA_NUMBER_OF_CHANNELS);
+    base->COMMON[0].ENABLESET = 1UL << channel;
+}
+
+/*!
+ * @brief Disable DMA channel.
+ *
+ * @param base DMA peripheral base address.
+ * @param channel DMA channel number.
+ */
+static inline void DMA_DisableChannel(DMA_Type *base, uint32_t channel)
+{
+    assert(channel < FSL_FEATURE_DMA_NUMBER_OF_CHANNELS);
+    base->COMMON[0].ENABLECLR = 1UL << channel;
+}
+
+/*!
+ * @brief Set PERIPHREQEN of channel configuration register.
+ *
+ * The transfer of the channel is paced by the request of the peripheral bound to the channel.
+ *
+ * @param base DMA peripheral base address.
+ * @param channel DMA channel number.
+ */
+static inline void DMA_EnableChannelPeriphRq(DMA_Type *base, uint32_t channel)
+{
+    assert(channel < FSL_FEATURE_DMA_NUMBER_OF_CHANNELS);
+    base->CHANNEL[channel].CFG |= DMA_CHANNEL_CFG_PERIPHREQEN_MASK;
+}
+
+/*!
+ * @brief Clear PERIPHREQEN of channel configuration register.
+ *
+ * The channel stops moving data, the peripheral request is held until it is enabled again.
+ *
+ * @param base DMA peripheral base address.
+ * @param channel DMA channel number.
+ */
+static inline void DMA_DisableChannelPeriphRq(DMA_Type *base, uint32_t channel)
+{
+    assert(channel < FSL_FEATURE_DMA_NUMBER_OF_CHANNELS);
+    base->CHANNEL[channel].CFG &= ~DMA_CHANNEL_CFG_PERIPHREQEN_MASK;
+}
+
+/*!
+ * @brief Set priority of channel configuration register.
+ *
+ * @param base DMA peripheral base address.
+ * @param channel DMA channel number.
+ * @param priority Channel priority value.
+ */
+static inline void DMA_SetChannelPriority(DMA_Type *base, uint32_t channel, dma_priority_t priority)
+{
+    assert(channel < FSL_FEATURE_DMA_NUMBER_OF_CHANNELS);
+    base->CHANNEL[channel].CFG =
+        (base->CHANNEL[channel].CFG & (~(DMA_CHANNEL_CFG_CHPRIORITY_MASK))) | DMA_CHANNEL_CFG_CHPRIORITY(priority);
+}
+
+/*!
+ * @brief Configures the hardware trigger of a channel.
+ *
+ * The trigger source itself is selected by the DMA trigger input multiplexing in INPUTMUX.
+ *
+ * @param base DMA peripheral base address.
+ * @param channel DMA channel number.
+ * @param type Trigger type, #kDMA_NoTrigger for a channel started by software.
+ * @param burst Amount of data moved by a trigger.
+ */
+static inline void DMA_ConfigureChannelTrigger(DMA_Type *base,
+                                               uint32_t channel,
+                                               dma_trigger_type_t type,
+                                               dma_trigger_burst_t burst)
+{
+    assert(channel < FSL_FEATURE_DMA_NUMBER_OF_CHANNELS);
+    base->CHANNEL[channel].CFG =
+        (base->CHANNEL[channel].CFG &
+         ~(DMA_CHANNEL_CFG_HWTRIGEN_MASK | DMA_CHANNEL_CFG_TRIGPOL_MASK | DMA_CHANNEL_CFG_TRIGTYPE_MASK |
+           DMA_CHANNEL_CFG_TRIGBURST_MASK | DMA_CHANNEL_CFG_BURSTPOWER_MASK)) |
+        (uint32_t)type | (uint32_t)burst;
+}
+
+/*!
+ * @brief Gets the remaining bytes of the current DMA descriptor transfer.
+ *
+ * @param base DMA peripheral base address.
+ * @param channel DMA channel number.
+ * @return The number of bytes which have not been transferred yet, 0 if the channel is not active.
+ */
+uint32_t DMA_GetRemainingBytes(DMA_Type *base, uint32_t channel);
+
+/*!
+ * @brief Sets up a DMA descriptor.
+ *
+ * The end addresses of the descriptor are worked out from the start addresses and the transfer configuration.
+ *
+ * @param desc The descriptor, 16 bytes aligned if it is linked by another descriptor.
+ * @param xfercfg The transfer configuration, made by #DMA_CHANNEL_XFER.
+ * @param srcStartAddr Start address of the source.
+ * @param dstStartAddr Start address of the destination.
+ * @param nextDesc The descriptor linked after it, NULL for the last descriptor of a chain.
+ */
+void DMA_SetupDescriptor(
+    dma_descriptor_t *desc, uint32_t xfercfg, void *srcStartAddr, void *dstStartAddr, void *nextDesc);
+
+/*!
+ * @brief Sets up a pair of descriptors linked to each other, for a continuous transfer through a ring.
+ *
+ * The ring is split into two halves, each moved by one of the descriptors. The first descriptor raises the
+ * interrupt A and the second one the interrupt B, so that one half is processed while the other is moved.
+ * The transfer runs until it is aborted.
+ *
+ * @param desc Array of two descriptors, 16 bytes aligned.
+ * @param xfercfg The transfer configuration of one half, made by #DMA_CHANNEL_XFER. The reload and interrupt
+ *                settings are overridden, the trigger should not be cleared.
+ * @param srcStartAddr Start address of the source of the first half.
+ * @param dstStartAddr Start address of the destination of the first half.
+ */
+void DMA_SetupPingPongDescriptors(dma_descriptor_t *desc, uint32_t xfercfg, void *srcStartAddr, void *dstStartAddr);
+
+/*!
+ * @brief Gets the offset in the ring of the next element moved by a ping-pong transfer.
+ *
+ * The offset is taken from a single read of the channel transfer configuration, which tells both the active half
+ * and the progress in it, so it is consistent while the channel switches between the halves.
+ *
+ * @param handle DMA handle pointer.
+ * @return The offset in bytes from the start of the ring, it is the number of bytes the receiver has produced.
+ */
+uint32_t DMA_GetPingPongOffset(dma_handle_t *handle);
+
+/* @} */
+
+/*!
+ * @name DMA Transactional Operation
+ * @{
+ */
+
+/*!
+ * @brief Abort running transfer by handle.
+ *
+ * This function aborts DMA transfer specified by handle.
+ *
+ * @param handle DMA handle pointer.
+ */
+void DMA_AbortTransfer(dma_handle_t *handle);
+
+/*!
+ * @brief Creates the DMA handle.
+ *
+ * This function is called if using transaction API for DMA. This function
+ * initializes the internal state of DMA handle, enables the channel and its interrupt.
+ *
+ * @param handle DMA handle pointer. The DMA handle stores callback function and
+ *               parameters.
+ * @param base DMA peripheral base address.
+ * @param channel DMA channel number.
+ */
+void DMA_CreateHandle(dma_handle_t *handle, DMA_Type *base, uint32_t channel);
+
+/*!
+ * @brief Installs a callback function for the DMA transfer.
+ *
+ * This callback is called in DMA IRQ handler. Use the callback to do something after
+ * the current major loop transfer completes.
+ *
+ * @param handle DMA handle pointer.
+ * @param callback DMA callback function pointer.
+ * @param userData Parameter for callback function.
+ */
+void DMA_SetCallback(dma_handle_t *handle, dma_callback callback, void *userData);
+
+/*!
+ * @brief Submits a single transfer to the channel.
+ *
+ * @param handle DMA handle pointer.
+ * @param xfercfg The transfer configuration, made by #DMA_CHANNEL_XFER.
+ * @param srcStartAddr Start address of the source.
+ * @param dstStartAddr Start address of the destination.
+ * @param nextDesc The descriptor linked after it, NULL if there is no following transfer.
+ */
+void DMA_SubmitChannelTransferParameter(
+    dma_handle_t *handle, uint32_t xfercfg, void *srcStartAddr, void *dstStartAddr, void *nextDesc);
+
+/*!
+ * @brief Submits the head descriptor of a chain to the channel.
+ *
+ * The descriptor is copied into the channel descriptor table, the descriptors it links to are used in place.
+ *
+ * @param handle DMA handle pointer.
+ * @param descriptor The head descriptor.
+ */
+void DMA_SubmitChannelDescriptor(dma_handle_t *handle, dma_descriptor_t *descriptor);
+
+/*!
+ * @brief DMA start transfer.
+ *
+ * This function enables the channel request. User can call this function after submitting the transfer request.
+ * The transfer of a channel with the peripheral request enabled is paced by the peripheral.
+ *
+ * @param handle DMA handle pointer.
+ */
+void DMA_StartTransfer(dma_handle_t *handle);
+
+/*!
+ * @brief DMA IRQ handler, it calls the callbacks of the channels with a pending interrupt.
+ *
+ * @param base DMA peripheral base address.
+ */
+void DMA_IRQHandle(DMA_Type *base);
+
+/* @} */
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*! @}*/
+
+#endif /*_FSL_DMA_H_*/
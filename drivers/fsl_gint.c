@@ -0,0 +1,337 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_gint.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.gint"
+#endif
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*!
+ * @brief Gets the instance of a GINT group.
+ *
+ * @param base Base address of the GINT peripheral.
+ * @return GINT instance.
+ */
+static uint32_t GINT_GetInstance(GINT_Type *base);
+
+/*!
+ * @brief Common interrupt handler of the GINT groups.
+ *
+ * @param instance GINT instance.
+ */
+static void GINT_CommonIRQHandler(uint32_t instance);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/*! @brief Pointers to the GINT bases for each instance. */
+static GINT_Type *const s_gintBases[] = GINT_BASE_PTRS;
+/*! @brief Interrupt numbers of the GINT groups. */
+static const IRQn_Type s_gintIRQ[] = GINT_IRQS;
+#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
+/*! @brief Clocks of the GINT groups, shared by both groups. */
+static const clock_ip_name_t s_gintClocks[] = GINT_CLOCKS;
+#endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
+/*! @brief Callbacks of the GINT groups. */
+static gint_cb_t s_gintCallback[ARRAY_SIZE(s_gintBases)];
+/*! @brief Initialized GINT groups, one bit per instance. */
+static uint32_t s_gintInitMask;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t GINT_GetInstance(GINT_Type *base)
+{
+    uint32_t instance;
+
+    for (instance = 0U; instance < ARRAY_SIZE(s_gintBases); instance++)
+    {
+        if (s_gintBases[instance] == base)
+        {
+            break;
+        }
+    }
+
+    assert(instance < ARRAY_SIZE(s_gintBases));
+
+    return instance;
+}
+
+/*!
+ * brief Initializes a GINT group.
+ *
+ * This function enables the GINT clock and disables all the inputs of the group. The two groups share their reset,
+ * so the registers of the group are cleared instead.
+ *
+ * param base Base address of the GINT peripheral.
+ */
+void GINT_Init(GINT_Type *base)
+{
+    uint32_t instance = GINT_GetInstance(base);
+    uint32_t port;
+
+    s_gintCallback[instance] = NULL;
+
+#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
+    CLOCK_EnableClock(s_gintClocks[instance]);
+#endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
+
+    for (port = 0U; port < GINT_PORT_COUNT; port++)
+    {
+        base->PORT_ENA[port] = 0U;
+        base->PORT_POL[port] = 0U;
+    }
+    base->CTRL = GINT_CTRL_INT_MASK;
+
+    s_gintInitMask |= 1UL << instance;
+}
+
+/*!
+ * brief De-initializes a GINT group.
+ *
+ * This function disables the group interrupt and the inputs of the group. The GINT clock is gated once both groups
+ * are de-initialized.
+ *
+ * param base Base address of the GINT peripheral.
+ */
+void GINT_Deinit(GINT_Type *base)
+{
+    uint32_t instance = GINT_GetInstance(base);
+    uint32_t port;
+
+    GINT_DisableDeepSleepWakeup(base);
+    s_gintCallback[instance] = NULL;
+
+    for (port = 0U; port < GINT_PORT_COUNT; port++)
+    {
+        base->PORT_ENA[port] = 0U;
+        base->PORT_POL[port] = 0U;
+    }
+    base->CTRL = GINT_CTRL_INT_MASK;
+
+    s_gintInitMask &= ~(1UL << instance);
+#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
+    if (0U == s_gintInitMask)
+    {
+        CLOCK_DisableClock(s_gintClocks[instance]);
+    }
+#endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
+}
+
+/*!
+ * brief Sets up the GINT group combination and trigger, and installs the callback.
+ *
+ * param base Base address of the GINT peripheral.
+ * param comb Combination of the enabled inputs.
+ * param trig Trigger type.
+ * param callback Callback called from the group interrupt, NULL for no callback.
+ */
+void GINT_SetCtrl(GINT_Type *base, gint_comb_t comb, gint_trig_t trig, gint_cb_t callback)
+{
+    uint32_t instance = GINT_GetInstance(base);
+
+    /* Writing the status bit clears a pending edge detected with the previous setup. */
+    base->CTRL = GINT_CTRL_INT_MASK | GINT_CTRL_COMB(comb) | GINT_CTRL_TRIG(trig);
+
+    s_gintCallback[instance] = callback;
+}
+
+/*!
+ * brief Gets the GINT group combination, trigger and callback.
+ *
+ * param base Base address of the GINT peripheral.
+ * param comb Combination of the enabled inputs.
+ * param trig Trigger type.
+ * param callback Callback called from the group interrupt.
+ */
+void GINT_GetCtrl(GINT_Type *base, gint_comb_t *comb, gint_trig_t *trig, gint_cb_t *callback)
+{
+    uint32_t instance = GINT_GetInstance(base);
+    uint32_t ctrl     = base->CTRL;
+
+    assert((NULL != comb) && (NULL != trig) && (NULL != callback));
+
+    *comb     = (gint_comb_t)((ctrl & GINT_CTRL_COMB_MASK) >> GINT_CTRL_COMB_SHIFT);
+    *trig     = (gint_trig_t)((ctrl & GINT_CTRL_TRIG_MASK) >> GINT_CTRL_TRIG_SHIFT);
+    *callback = s_gintCallback[instance];
+}
+
+/*!
+ * brief Configures the GINT group inputs of a port.
+ *
+ * param base Base address of the GINT peripheral.
+ * param port GPIO port.
+ * param polarityMask Active level of each pin, 1 for high and 0 for low.
+ * param enableMask Pins of the port contributing to the group interrupt.
+ */
+void GINT_ConfigPins(GINT_Type *base, gint_port_t port, uint32_t polarityMask, uint32_t enableMask)
+{
+    assert((uint32_t)port < GINT_PORT_COUNT);
+
+    base->PORT_POL[port] = polarityMask;
+    base->PORT_ENA[port] = enableMask;
+}
+
+/*!
+ * brief Gets the GINT group inputs of a port.
+ *
+ * param base Base address of the GINT peripheral.
+ * param port GPIO port.
+ * param polarityMask Active level of each pin, 1 for high and 0 for low.
+ * param enableMask Pins of the port contributing to the group interrupt.
+ */
+void GINT_GetConfigPins(GINT_Type *base, gint_port_t port, uint32_t *polarityMask, uint32_t *enableMask)
+{
+    assert((uint32_t)port < GINT_PORT_COUNT);
+    assert((NULL != polarityMask) && (NULL != enableMask));
+
+    *polarityMask = base->PORT_POL[port];
+    *enableMask   = base->PORT_ENA[port];
+}
+
+/*!
+ * brief Arms the change detection of pins of a port.
+ *
+ * The active level of each pin is set to the opposite of its current level, so that any pin leaving the returned
+ * levels activates the group. The group should be set up with #kGINT_CombineOr and #kGINT_TrigLevel, then the
+ * interrupt stays asserted as long as a pin differs from the armed levels, and a change happening while arming is
+ * not lost. The callback should arm the detection again, the pins that changed are the armed levels XOR the new
+ * ones.
+ *
+ * param base Base address of the GINT peripheral.
+ * param port GPIO port.
+ * param mask Pins of the port to monitor, the other pins of the port are disabled.
+ * return Levels of the monitored pins the detection is armed with.
+ */
+uint32_t GINT_ArmChangeDetect(GINT_Type *base, gint_port_t port, uint32_t mask)
+{
+    uint32_t levels;
+
+    assert((uint32_t)port < GINT_PORT_COUNT);
+
+    levels = GPIO->PIN[port] & mask;
+
+    base->PORT_POL[port] = ~levels & mask;
+    base->PORT_ENA[port] = mask;
+
+    return levels;
+}
+
+/*!
+ * brief Enables the GINT group interrupt, the pending status is cleared first.
+ *
+ * param base Base address of the GINT peripheral.
+ */
+void GINT_EnableCallback(GINT_Type *base)
+{
+    uint32_t instance = GINT_GetInstance(base);
+
+    GINT_ClrStatus(base);
+    NVIC_ClearPendingIRQ(s_gintIRQ[instance]);
+    (void)EnableIRQ(s_gintIRQ[instance]);
+}
+
+/*!
+ * brief Disables the GINT group interrupt and clears the pending status.
+ *
+ * param base Base address of the GINT peripheral.
+ */
+void GINT_DisableCallback(GINT_Type *base)
+{
+    uint32_t instance = GINT_GetInstance(base);
+
+    (void)DisableIRQ(s_gintIRQ[instance]);
+    GINT_ClrStatus(base);
+    NVIC_ClearPendingIRQ(s_gintIRQ[instance]);
+}
+
+/*!
+ * brief Enables the GINT group interrupt and its wake up from deep sleep.
+ *
+ * The group inputs are evaluated without clock, so the group wakes up the MCU from deep sleep as soon as it becomes
+ * active, and the callback is called once the MCU is running again.
+ *
+ * param base Base address of the GINT peripheral.
+ */
+void GINT_EnableDeepSleepWakeup(GINT_Type *base)
+{
+    uint32_t instance = GINT_GetInstance(base);
+
+    GINT_ClrStatus(base);
+    NVIC_ClearPendingIRQ(s_gintIRQ[instance]);
+    EnableDeepSleepIRQ(s_gintIRQ[instance]);
+}
+
+/*!
+ * brief Disables the GINT group interrupt and its wake up from deep sleep.
+ *
+ * param base Base address of the GINT peripheral.
+ */
+void GINT_DisableDeepSleepWakeup(GINT_Type *base)
+{
+    uint32_t instance = GINT_GetInstance(base);
+
+    DisableDeepSleepIRQ(s_gintIRQ[instance]);
+    GINT_ClrStatus(base);
+    NVIC_ClearPendingIRQ(s_gintIRQ[instance]);
+}
+
+static void GINT_CommonIRQHandler(uint32_t instance)
+{
+    GINT_Type *base = s_gintBases[instance];
+
+    if (0U != (base->CTRL & GINT_CTRL_TRIG_MASK))
+    {
+        /* In level mode the status only clears once the group is inactive, so the callback deactivates it first. */
+        if (NULL != s_gintCallback[instance])
+        {
+            s_gintCallback[instance]();
+        }
+        GINT_ClrStatus(base);
+    }
+    else
+    {
+        /* In edge mode the status is cleared first, so that an edge during the callback is not lost. */
+        GINT_ClrStatus(base);
+        if (NULL != s_gintCallback[instance])
+        {
+            s_gintCallback[instance]();
+        }
+    }
+}
+
+void GINT0_DriverIRQHandler(void)
+{
+    GINT_CommonIRQHandler(0U);
+/* Add for ARM errata 838869, affects Cortex-M4, Cortex-M4F Store immediate overlapping
+  exception return operation might vector to incorrect interrupt */
+#if defined __CORTEX_M && (__CORTEX_M == 4U)
+    __DSB();
+#endif
+}
+
+void GINT1_DriverIRQHandler(void)
+{
+    GINT_CommonIRQHandler(1U);
+/* Add for ARM errata 838869, affects Cortex-M4, Cortex-M4F Store immediate overlapping
+  exception return operation might vector to incorrect interrupt */
+#if defined __CORTEX_M && (__CORTEX_M == 4U)
+    __DSB();
+#endif
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_GINT_H_
+#define _FSL_GINT_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup gint_driver
+ * @{
+ */
+
+/*! @file */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @name Driver version */
+/*@{*/
+/*! @brief GINT driver version 2.0.0. */
+#define FSL_GINT_DRIVER_VERSION (MAKE_VERSION(2, 0, 0))
+/*@}*/
+
+/*! @brief Number of GPIO ports monitored by a GINT group. */
+#define GINT_PORT_COUNT (GINT_PORT_POL_COUNT)
+
+/*! @brief GINT combine inputs type */
+typedef enum _gint_comb
+{
+    kGINT_CombineOr  = 0U, /*!< A grouped interrupt is generated when any one of the enabled inputs is active */
+    kGINT_CombineAnd = 1U, /*!< A grouped interrupt is generated when all enabled inputs are active */
+} gint_comb_t;
+
+/*! @brief GINT trigger type */
+typedef enum _gint_trig
+{
+    kGINT_TrigEdge  = 0U, /*!< Edge triggered based on polarity */
+    kGINT_TrigLevel = 1U, /*!< Level triggered based on polarity */
+} gint_trig_t;
+
+/*! @brief GINT port type */
+typedef enum _gint_port
+{
+    kGINT_Port0 = 0U, /*!< GPIO port 0 */
+    kGINT_Port1 = 1U, /*!< GPIO port 1 */
+} gint_port_t;
+
+/*! @brief GINT callback function type */
+typedef void (*gint_cb_t)(void);
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @name Initialization and configuration
+ * @{
+ */
+
+/*!
+ * @brief Initializes a GINT group.
+ *
+ * This function enables the GINT clock and disables all the inputs of the group. The two groups share their reset,
+ * so the registers of the group are cleared instead.
+ *
+ * @param base Base address of the GINT peripheral.
+ */
+void GINT_Init(GINT_Type *base);
+
+/*!
+ * @brief De-initializes a GINT group.
+ *
+ * This function disables the group interrupt and the inputs of the group. The GINT clock is gated once both groups
+ * are de-initialized.
+ *
+ * @param base Base address of the GINT peripheral.
+ */
+void GINT_Deinit(GINT_Type *base);
+
+/*!
+ * @brief Sets up the GINT group combination and trigger, and installs the callback.
+ *
+ * @param base Base address of the GINT peripheral.
+ * @param comb Combination of the enabled inputs.
+ * @param trig Trigger type.
+ * @param callback Callback called from the group interrupt, NULL for no callback.
+ */
+void GINT_SetCtrl(GINT_Type *base, gint_comb_t comb, gint_trig_t trig, gint_cb_t callback);
+
+/*!
+ * @brief Gets the GINT group combination, trigger and callback.
+ *
+ * @param base Base address of the GINT peripheral.
+ * @param comb Combination of the enabled inputs.
+ * @param trig Trigger type.
+ * @param callback Callback called from the group interrupt.
+ */
+void GINT_GetCtrl(GINT_Type *base, gint_comb_t *comb, gint_trig_t *trig, gint_cb_t *callback);
+
+/*!
+ * @brief Configures the GINT group inputs of a port.
+ *
+ * @param base Base address of the GINT peripheral.
+ * @param port GPIO port.
+ * @param polarityMask Active level of each pin, 1 for high and 0 for low.
+ * @param enableMask Pins of the port contributing to the group interrupt.
+ */
+void GINT_ConfigPins(GINT_Type *base, gint_port_t port, uint32_t polarityMask, uint32_t enableMask);
+
+/*!
+ * @brief Gets the GINT group inputs of a port.
+ *
+ * @param base Base address of the GINT peripheral.
+ * @param port GPIO port.
+ * @param polarityMask Active level of each pin, 1 for high and 0 for low.
+ * @param enableMask Pins of the port contributing to the group interrupt.
+ */
+void GINT_GetConfigPins(GINT_Type *base, gint_port_t port, uint32_t *polarityMask, uint32_t *enableMask);
+
+/*!
+ * @brief Arms the change detection of pins of a port.
+ *
+ * The active level of each pin is set to the opposite of its current level, so that any pin leaving the returned
+ * levels activates the group. The group should be set up with #kGINT_CombineOr and #kGINT_TrigLevel, then the
+ * interrupt stays asserted as long as a pin differs from the armed levels, and a change happening while arming is
+ * not lost. The callback should arm the detection again, the pins that changed are the armed levels XOR the new
+ * ones.
+ *
+ * @param base Base address of the GINT peripheral.
+ * @param port GPIO port.
+ * @param mask Pins of the port to monitor, the other pins of the port are disabled.
+ * @return Levels of the monitored pins the detection is armed with.
+ */
+uint32_t GINT_ArmChangeDetect(GINT_Type *base, gint_port_t port, uint32_t mask);
+
+/*! @} */
+
+/*!
+ * @name Status
+ * @{
+ */
+
+/*!
+ * @brief Gets the GINT group interrupt status.
+ *
+ * @param base Base address of the GINT peripheral.
+ * @return true if the group interrupt is pending.
+ */
+static inline bool GINT_GetStatus(GINT_Type *base)
+{
+    return (0U != (base->CTRL & GINT_CTRL_INT_MASK));
+}
+
+/*!
+ * @brief Clears the GINT group interrupt status.
+ *
+ * In level mode, the status is only cleared once the group is no longer active.
+ *
+ * @param base Base address of the GINT peripheral.
+ */
+static inline void GINT_ClrStatus(GINT_Type *base)
+{
+    base->CTRL |= GINT_CTRL_INT_MASK;
+}
+
+/*! @} */
+
+/*!
+ * @name Interrupt and wake up
+ * @{
+ */
+
+/*!
+ * @brief Enables the GINT group interrupt, the pending status is cleared first.
+ *
+ * @param base Base address of the GINT peripheral.
+ */
+void GINT_EnableCallback(GINT_Type *base);
+
+/*!
+ * @brief Disables the GINT group interrupt and clears the pending status.
+ *
+ * @param base Base address of the GINT peripheral.
+ */
+void GINT_DisableCallback(GINT_Type *base);
+
+/*!
+ * @brief Enables the GINT group interrupt and its wake up from deep sleep.
+ *
+ * The group inputs are evaluated without clock, so the group wakes up the MCU from deep sleep as soon as it becomes
+ * active, and the callback is called once the MCU is running again.
+ *
+ * @param base Base address of the GINT peripheral.
+ */
+void GINT_EnableDeepSleepWakeup(GINT_Type *base);
+
+/*!
+ * @brief Disables the GINT group interrupt and its wake up from deep sleep.
+ *
+ * @param base Base address of the GINT peripheral.
+ */
+void GINT_DisableDeepSleepWakeup(GINT_Type *base);
+
+/*! @} */
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_GINT_H_ */
@@ -111,6 +111,67 @@ void GPIO_PinInit(GPIO_Type *base, uint32_t port, uint32_t pin, const gpio_pin_c
     }
 }
 
+/*!
+ * brief Initializes the layout of a bus on arbitrary pins of one port.
+ *
+ * The pins should be configured separately with GPIO_PinInit(). A bus on consecutive pins could also be declared
+ * at compile time with GPIO_BUS_CONTIGUOUS.
+ *
+ * param bus   Pointer to the bus layout to initialize.
+ * param port  GPIO port number.
+ * param pins  Pin number of each bus bit, bus bit 0 first.
+ * param width Number of bus bits, from 1 to 32.
+ * retval kStatus_Success The bus layout is initialized.
+ * retval kStatus_OutOfRange The pins make more than GPIO_BUS_MAX_RUNS runs.
+ * retval kStatus_InvalidArgument A pin is used twice or is not a pin of the port, or the width is invalid.
+ */
+status_t GPIO_BusInit(gpio_bus_t *bus, uint32_t port, const uint8_t *pins, uint8_t width)
+{
+    uint32_t mask = 0U;
+    uint32_t runCount = 0U;
+    uint32_t bit;
+    uint32_t pin;
+
+    assert(NULL != bus);
+    assert(NULL != pins);
+
+    if ((0U == width) || (width > 32U))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    for (bit = 0U; bit < width; bit++)
+    {
+        pin = pins[bit];
+        if ((pin >= 32U) || (0U != (mask & (1UL << pin))))
+        {
+            return kStatus_InvalidArgument;
+        }
+        mask |= 1UL << pin;
+
+        /* A new run starts unless the pin follows the pin of the previous bus bit. */
+        if ((0U == bit) || (pin != (pins[bit - 1U] + 1U)))
+        {
+            if (runCount >= GPIO_BUS_MAX_RUNS)
+            {
+                return kStatus_OutOfRange;
+            }
+            /* Rotating the bus value right by this amount moves the bus bit onto its pin. */
+            bus->runRotate[runCount] = (uint8_t)((32U + bit - pin) & 31U);
+            bus->runMask[runCount]   = 0U;
+            runCount++;
+        }
+        bus->runMask[runCount - 1U] |= 1UL << pin;
+    }
+
+    bus->port     = port;
+    bus->mask     = mask;
+    bus->width    = width;
+    bus->runCount = (uint8_t)runCount;
+
+    return kStatus_Success;
+}
+
 #if defined(FSL_FEATURE_GPIO_HAS_INTERRUPT) && FSL_FEATURE_GPIO_HAS_INTERRUPT
 /*!
  * @brief Configures the gpio pin interrupt.
@@ -48,6 +48,47 @@ typedef struct _gpio_pin_config
     uint8_t outputLogic; /*!< Set default output logic, no use in input */
 } gpio_pin_config_t;
 
+/*! @brief Maximum number of contiguous pin runs of a GPIO bus. */
+#ifndef GPIO_BUS_MAX_RUNS
+#define GPIO_BUS_MAX_RUNS (4U)
+#endif
+
+/*!
+ * @brief A group of pins of one port driven as a logical N-bit bus.
+ *
+ * The pins are split into runs of adjacent pins mapped to adjacent bus bits. The port value of a run is the bus
+ * value rotated and masked, so a bus value is converted in one rotate and mask per run rather than one step per
+ * pin. A bus on consecutive pins is a single run, see GPIO_BUS_CONTIGUOUS.
+ */
+typedef struct _gpio_bus
+{
+    uint32_t port;                        /*!< GPIO port number. */
+    uint32_t mask;                        /*!< Port bits of all the bus pins. */
+    uint8_t width;                        /*!< Number of bus bits. */
+    uint8_t runCount;                     /*!< Number of valid runs. */
+    uint8_t runRotate[GPIO_BUS_MAX_RUNS]; /*!< Right rotation from the bus value to the port value, per run. */
+    uint32_t runMask[GPIO_BUS_MAX_RUNS];  /*!< Port bits of the pins of each run. */
+} gpio_bus_t;
+
+/*! @brief Port bits of width consecutive pins starting at firstPin. */
+#define GPIO_BUS_PIN_MASK(firstPin, width) ((0xFFFFFFFFU >> (32U - (width))) << (firstPin))
+
+/*!
+ * @brief Initializer of a bus on consecutive pins, evaluated at compile time.
+ *
+ * Bus bit 0 is on the pin firstPin, the pins of the bus should not go beyond pin 31.
+ * @code
+ * static const gpio_bus_t s_lcdData = GPIO_BUS_CONTIGUOUS(1U, 8U, 8U);
+ * @endcode
+ */
+#define GPIO_BUS_CONTIGUOUS(port, firstPin, width)                                           \
+    {                                                                                        \
+        (port), GPIO_BUS_PIN_MASK(firstPin, width), (width), 1U, {(32U - (firstPin)) & 31U}, \
+        {                                                                                    \
+            GPIO_BUS_PIN_MASK(firstPin, width)                                               \
+        }                                                                                    \
+    }
+
 #if (defined(FSL_FEATURE_GPIO_HAS_INTERRUPT) && FSL_FEATURE_GPIO_HAS_INTERRUPT)
 #define GPIO_PIN_INT_LEVEL 0x00U
 #define GPIO_PIN_INT_EDGE 0x01U
@@ -267,6 +308,122 @@ static inline uint32_t GPIO_PortMaskedRead(GPIO_Type *base, uint32_t port)
     return (uint32_t)base->MPIN[port];
 }
 
+/*@}*/
+/*! @name GPIO Bus Operations */
+/*@{*/
+
+/*!
+ * @brief Initializes the layout of a bus on arbitrary pins of one port.
+ *
+ * The pins should be configured separately with GPIO_PinInit(). A bus on consecutive pins could also be declared
+ * at compile time with GPIO_BUS_CONTIGUOUS.
+ *
+ * @param bus   Pointer to the bus layout to initialize.
+ * @param port  GPIO port number.
+ * @param pins  Pin number of each bus bit, bus bit 0 first.
+ * @param width Number of bus bits, from 1 to 32.
+ * @retval kStatus_Success The bus layout is initialized.
+ * @retval kStatus_OutOfRange The pins make more than GPIO_BUS_MAX_RUNS runs.
+ * @retval kStatus_InvalidArgument A pin is used twice or is not a pin of the port, or the width is invalid.
+ */
+status_t GPIO_BusInit(gpio_bus_t *bus, uint32_t port, const uint8_t *pins, uint8_t width);
+
+/*!
+ * @brief Converts a bus value to the port value of the bus pins.
+ *
+ * @param bus   Pointer to the bus layout.
+ * @param value Bus value, the bits beyond the bus width are ignored.
+ * @return Port value, only the bits of the bus pins could be set.
+ */
+static inline uint32_t GPIO_BusToPort(const gpio_bus_t *bus, uint32_t value)
+{
+    uint32_t output = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < bus->runCount; i++)
+    {
+        output |= __ROR(value, bus->runRotate[i]) & bus->runMask[i];
+    }
+    return output;
+}
+
+/*!
+ * @brief Converts a port value to the bus value of the bus pins.
+ *
+ * @param bus    Pointer to the bus layout.
+ * @param output Port value.
+ * @return Bus value.
+ */
+static inline uint32_t GPIO_BusFromPort(const gpio_bus_t *bus, uint32_t output)
+{
+    uint32_t value = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < bus->runCount; i++)
+    {
+        value |= __ROR(output & bus->runMask[i], (32U - bus->runRotate[i]) & 31U);
+    }
+    return value;
+}
+
+/*!
+ * @brief Sets the output level of the bus pins with one SET and one CLR store.
+ *
+ * The other pins of the port and the port mask register are not affected, so it is safe against interrupts using
+ * the same port. The pins going high change one store before the pins going low.
+ *
+ * @param base  GPIO peripheral base pointer(Typically GPIO)
+ * @param bus   Pointer to the bus layout.
+ * @param value Bus value.
+ */
+static inline void GPIO_BusWrite(GPIO_Type *base, const gpio_bus_t *bus, uint32_t value)
+{
+    uint32_t output = GPIO_BusToPort(bus, value);
+
+    base->SET[bus->port] = output;
+    base->CLR[bus->port] = bus->mask & ~output;
+}
+
+/*!
+ * @brief Sets the port mask to the bus pins, for GPIO_BusMaskedWrite() and GPIO_BusMaskedRead().
+ *
+ * The port mask register is shared by all the masked accesses of the port, it is kept while the bus is written in
+ * a burst.
+ *
+ * @param base GPIO peripheral base pointer(Typically GPIO)
+ * @param bus  Pointer to the bus layout.
+ */
+static inline void GPIO_BusMaskedSet(GPIO_Type *base, const gpio_bus_t *bus)
+{
+    base->MASK[bus->port] = ~bus->mask;
+}
+
+/*!
+ * @brief Sets the output level of all the bus pins at once with one MPIN store.
+ *
+ * The port mask should be set by GPIO_BusMaskedSet() before.
+ *
+ * @param base  GPIO peripheral base pointer(Typically GPIO)
+ * @param bus   Pointer to the bus layout.
+ * @param value Bus value.
+ */
+static inline void GPIO_BusMaskedWrite(GPIO_Type *base, const gpio_bus_t *bus, uint32_t value)
+{
+    base->MPIN[bus->port] = GPIO_BusToPort(bus, value);
+}
+
+/*!
+ * @brief Reads the input value of the bus pins.
+ *
+ * @param base GPIO peripheral base pointer(Typically GPIO)
+ * @param bus  Pointer to the bus layout.
+ * @retval Bus value.
+ */
+static inline uint32_t GPIO_BusRead(GPIO_Type *base, const gpio_bus_t *bus)
+{
+    return GPIO_BusFromPort(bus, base->PIN[bus->port]);
+}
+
 #if defined(FSL_FEATURE_GPIO_HAS_INTERRUPT) && FSL_FEATURE_GPIO_HAS_INTERRUPT
 /*!
  * @brief Configures the gpio pin interrupt.
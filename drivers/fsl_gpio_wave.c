@@ -0,0 +1,278 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_gpio_wave.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.gpio_wave"
+#endif
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*!
+ * @brief Gets the instance number of a timer.
+ *
+ * @param base Timer peripheral base pointer.
+ */
+static uint32_t GPIO_WaveGetTimerInstance(CTIMER_Type *base);
+
+/*!
+ * @brief DMA callback of the waveform channel.
+ */
+static void GPIO_WaveDmaCallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/*! @brief Pointers to the timers. */
+static CTIMER_Type *const s_gpioWaveTimerBases[] = CTIMER_BASE_PTRS;
+#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
+/*! @brief Clock names of the timers. */
+static const clock_ip_name_t s_gpioWaveTimerClocks[] = CTIMER_CLOCKS;
+#endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
+/*! @brief Resets of the timers. */
+static const reset_ip_name_t s_gpioWaveTimerResets[] = CTIMER_RSTS;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t GPIO_WaveGetTimerInstance(CTIMER_Type *base)
+{
+    uint32_t instance;
+
+    for (instance = 0U; instance < ARRAY_SIZE(s_gpioWaveTimerBases); instance++)
+    {
+        if (s_gpioWaveTimerBases[instance] == base)
+        {
+            break;
+        }
+    }
+
+    assert(instance < ARRAY_SIZE(s_gpioWaveTimerBases));
+
+    return instance;
+}
+
+static void GPIO_WaveDmaCallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode)
+{
+    gpio_wave_handle_t *waveHandle = (gpio_wave_handle_t *)userData;
+
+    /* Only the last descriptor of a waveform played once raises an interrupt. */
+    if (transferDone)
+    {
+        if (NULL != waveHandle->timer)
+        {
+            waveHandle->timer->TCR = 0U;
+        }
+        waveHandle->busy = false;
+        if (NULL != waveHandle->callback)
+        {
+            waveHandle->callback(waveHandle, waveHandle->userData);
+        }
+    }
+}
+
+/*!
+ * brief Initializes a GPIO waveform handle.
+ *
+ * The DMA channel is requested and triggered by a rising edge of the trigger, one word per edge. With a timer, the
+ * timer is reset on its match 0 every step ticks, and its match 0 triggers the DMA. The DMA is initialized if it is
+ * not yet. The waveform pins should be configured as outputs with GPIO_PinInit(). The timers CTIMER0 and CTIMER1
+ * are on the asynchronous APB bridge, which should be enabled.
+ *
+ * param handle GPIO waveform handle pointer.
+ * param config GPIO waveform configuration.
+ * retval kStatus_Success The handle is initialized.
+ * retval kStatus_DMA_Busy The DMA channel is requested already.
+ * retval kStatus_InvalidArgument The step ticks of the timer is 0.
+ */
+status_t GPIO_WaveInit(gpio_wave_handle_t *handle, const gpio_wave_config_t *config)
+{
+    uint32_t trigger = (uint32_t)config->trigger;
+    uint32_t instance;
+    status_t status;
+
+    assert((NULL != handle) && (NULL != config));
+    assert(config->dmaChannel < INPUTMUX_DMA_ITRIG_INMUX_COUNT);
+
+    if ((NULL != config->timer) && (0U == config->stepTicks))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    (void)memset(handle, 0, sizeof(*handle));
+    handle->base  = config->base;
+    handle->port  = config->port;
+    handle->timer = config->timer;
+
+    if (!DMA_IsInitialized(config->dmaBase))
+    {
+        DMA_Init(config->dmaBase);
+    }
+    status = DMA_RequestChannel(config->dmaBase, config->dmaChannel);
+    if (kStatus_Success != status)
+    {
+        return status;
+    }
+
+    if (NULL != config->timer)
+    {
+        instance = GPIO_WaveGetTimerInstance(config->timer);
+#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
+        CLOCK_EnableClock(s_gpioWaveTimerClocks[instance]);
+#endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
+        RESET_PeripheralReset(s_gpioWaveTimerResets[instance]);
+
+        /* The timer is reset by its match 0, which raises the DMA request once every step. */
+        config->timer->PR    = 0U;
+        config->timer->MR[0] = config->stepTicks - 1U;
+        config->timer->MCR   = CTIMER_MCR_MR0R_MASK;
+        trigger              = (uint32_t)kGPIO_WaveTriggerCtimer0Match0 + instance * 2U;
+    }
+
+#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
+    CLOCK_EnableClock(kCLOCK_InputMux);
+#endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
+    INPUTMUX->DMA_ITRIG_INMUX[config->dmaChannel] = INPUTMUX_DMA_ITRIG_INMUX_INP(trigger);
+
+    DMA_CreateHandle(&handle->dmaHandle, config->dmaBase, config->dmaChannel);
+    DMA_SetCallback(&handle->dmaHandle, GPIO_WaveDmaCallback, handle);
+    DMA_ConfigureChannelTrigger(config->dmaBase, config->dmaChannel, kDMA_RisingEdgeTrigger, kDMA_EdgeBurstTransfer1);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief De-initializes a GPIO waveform handle, the playing waveform is stopped and the DMA channel released.
+ *
+ * param handle GPIO waveform handle pointer.
+ */
+void GPIO_WaveDeinit(gpio_wave_handle_t *handle)
+{
+    assert(NULL != handle);
+
+    GPIO_WaveStop(handle);
+    DMA_ConfigureChannelTrigger(handle->dmaHandle.base, handle->dmaHandle.channel, kDMA_NoTrigger,
+                                kDMA_SingleTransfer);
+    DMA_DisableChannel(handle->dmaHandle.base, handle->dmaHandle.channel);
+    DMA_ReleaseChannel(handle->dmaHandle.base, handle->dmaHandle.channel);
+}
+
+/*!
+ * brief Installs the callback called once a waveform played once is done.
+ *
+ * param handle GPIO waveform handle pointer.
+ * param callback Callback function, NULL for no callback.
+ * param userData Parameter of the callback function.
+ */
+void GPIO_WaveSetCallback(gpio_wave_handle_t *handle, gpio_wave_callback_t callback, void *userData)
+{
+    assert(NULL != handle);
+
+    handle->callback = callback;
+    handle->userData = userData;
+}
+
+/*!
+ * brief Starts playing encoded waveform words.
+ *
+ * The pins should be at the start levels of the encoding. The words are read by the DMA while playing, they
+ * should be kept until the waveform is done or stopped.
+ *
+ * param handle GPIO waveform handle pointer.
+ * param words Encoded words.
+ * param count Number of words, up to #GPIO_WAVE_MAX_STEPS.
+ * param loop Replay the waveform until GPIO_WaveStop() is called.
+ * retval kStatus_Success The waveform is started.
+ * retval kStatus_DMA_Busy A waveform is playing.
+ * retval kStatus_OutOfRange The waveform has too many steps.
+ * retval kStatus_InvalidArgument The count is 0.
+ */
+status_t GPIO_WaveStart(gpio_wave_handle_t *handle, const uint32_t *words, uint32_t count, bool loop)
+{
+    uint32_t descriptorCount;
+    uint32_t length;
+    uint32_t last;
+    uint32_t i;
+    void *next;
+
+    assert((NULL != handle) && (NULL != words));
+
+    if (handle->busy)
+    {
+        return kStatus_DMA_Busy;
+    }
+    if (0U == count)
+    {
+        return kStatus_InvalidArgument;
+    }
+    if (count > GPIO_WAVE_MAX_STEPS)
+    {
+        return kStatus_OutOfRange;
+    }
+
+    /* One descriptor per DMA_MAX_TRANSFER_COUNT words, the last one links back to the first one for a loop. */
+    descriptorCount = (count + DMA_MAX_TRANSFER_COUNT - 1U) / DMA_MAX_TRANSFER_COUNT;
+    for (i = 0U; i < descriptorCount; i++)
+    {
+        last   = (i == (descriptorCount - 1U)) ? 1U : 0U;
+        length = (0U != last) ? (count - i * DMA_MAX_TRANSFER_COUNT) : DMA_MAX_TRANSFER_COUNT;
+        if (0U == last)
+        {
+            next = &handle->descriptor[i + 1U];
+        }
+        else
+        {
+            next = loop ? &handle->descriptor[0] : NULL;
+        }
+        DMA_SetupDescriptor(&handle->descriptor[i],
+                            DMA_CHANNEL_XFER((NULL != next) ? 1U : 0U, 0U, loop ? 0U : last, 0U, 4U, 1U, 0U,
+                                             length * sizeof(uint32_t)),
+                            (void *)(uintptr_t)&words[i * DMA_MAX_TRANSFER_COUNT],
+                            (void *)&handle->base->NOT[handle->port], next);
+    }
+
+    handle->busy = true;
+    DMA_SubmitChannelDescriptor(&handle->dmaHandle, &handle->descriptor[0]);
+    DMA_StartTransfer(&handle->dmaHandle);
+
+    if (NULL != handle->timer)
+    {
+        /* Drop a DMA request left by a previous match before the timer runs. */
+        handle->timer->TCR = CTIMER_TCR_CRST_MASK;
+        handle->timer->IR  = CTIMER_IR_MR0INT_MASK;
+        handle->timer->TCR = CTIMER_TCR_CEN_MASK;
+    }
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Stops the playing waveform, the pins keep the levels of the last step played.
+ *
+ * param handle GPIO waveform handle pointer.
+ */
+void GPIO_WaveStop(gpio_wave_handle_t *handle)
+{
+    assert(NULL != handle);
+
+    if (NULL != handle->timer)
+    {
+        handle->timer->TCR = 0U;
+    }
+    DMA_AbortTransfer(&handle->dmaHandle);
+    handle->busy = false;
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_GPIO_WAVE_H_
+#define _FSL_GPIO_WAVE_H_
+
+#include "fsl_common.h"
+#include "fsl_gpio.h"
+#include "fsl_dma.h"
+#include "fsl_gpio_wave_encode.h"
+
+/*!
+ * @addtogroup gpio_wave
+ * @{
+ */
+
+/*! @file */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @name Driver version */
+/*@{*/
+/*! @brief GPIO waveform driver version 2.0.0. */
+#define FSL_GPIO_WAVE_DRIVER_VERSION (MAKE_VERSION(2, 0, 0))
+/*@}*/
+
+/*! @brief Number of DMA descriptors of a waveform handle, a descriptor plays up to #DMA_MAX_TRANSFER_COUNT steps. */
+#ifndef GPIO_WAVE_MAX_DESCRIPTORS
+#define GPIO_WAVE_MAX_DESCRIPTORS (4U)
+#endif
+
+/*! @brief Maximum number of steps of a waveform. */
+#define GPIO_WAVE_MAX_STEPS (GPIO_WAVE_MAX_DESCRIPTORS * DMA_MAX_TRANSFER_COUNT)
+
+/*! @brief DMA trigger pacing the steps, the values are the DMA trigger inputs of INPUTMUX. */
+typedef enum _gpio_wave_trigger
+{
+    kGPIO_WaveTriggerCtimer0Match0   = 2U,  /*!< CTIMER0 match 0 */
+    kGPIO_WaveTriggerCtimer0Match1   = 3U,  /*!< CTIMER0 match 1 */
+    kGPIO_WaveTriggerCtimer1Match0   = 4U,  /*!< CTIMER1 match 0 */
+    kGPIO_WaveTriggerCtimer1Match1   = 5U,  /*!< CTIMER1 match 1 */
+    kGPIO_WaveTriggerCtimer2Match0   = 6U,  /*!< CTIMER2 match 0 */
+    kGPIO_WaveTriggerCtimer2Match1   = 7U,  /*!< CTIMER2 match 1 */
+    kGPIO_WaveTriggerCtimer3Match0   = 8U,  /*!< CTIMER3 match 0 */
+    kGPIO_WaveTriggerCtimer3Match1   = 9U,  /*!< CTIMER3 match 1 */
+    kGPIO_WaveTriggerCtimer4Match0   = 10U, /*!< CTIMER4 match 0 */
+    kGPIO_WaveTriggerCtimer4Match1   = 11U, /*!< CTIMER4 match 1 */
+    kGPIO_WaveTriggerSct0DmaRequest0 = 12U, /*!< SCT0 DMA request 0 */
+    kGPIO_WaveTriggerSct0DmaRequest1 = 13U, /*!< SCT0 DMA request 1 */
+} gpio_wave_trigger_t;
+
+/*! @brief GPIO waveform configuration. */
+typedef struct _gpio_wave_config
+{
+    GPIO_Type *base;             /*!< GPIO peripheral base pointer. */
+    uint32_t port;               /*!< GPIO port of the waveform pins. */
+    DMA_Type *dmaBase;           /*!< DMA peripheral base pointer. */
+    uint32_t dmaChannel;         /*!< DMA channel playing the waveform. */
+    CTIMER_Type *timer;          /*!< Timer pacing the steps with its match 0, NULL if the trigger is set up by the
+                                      application. */
+    uint32_t stepTicks;          /*!< Timer clock cycles per step, only used with the timer. */
+    gpio_wave_trigger_t trigger; /*!< Trigger pacing the steps, only used without the timer. */
+} gpio_wave_config_t;
+
+/*! @brief GPIO waveform handle. */
+typedef struct _gpio_wave_handle gpio_wave_handle_t;
+
+/*! @brief GPIO waveform callback, called from the DMA interrupt once a waveform played once is done. */
+typedef void (*gpio_wave_callback_t)(gpio_wave_handle_t *handle, void *userData);
+
+/*! @brief GPIO waveform handle structure, the descriptors are linked by the DMA so they stay in the handle. */
+struct _gpio_wave_handle
+{
+    /*! DMA descriptors of the waveform, linked in a chain. */
+    SDK_ALIGN(dma_descriptor_t descriptor[GPIO_WAVE_MAX_DESCRIPTORS], FSL_FEATURE_DMA_LINK_DESCRIPTOR_ALIGN_SIZE);
+    dma_handle_t dmaHandle;        /*!< DMA handle of the channel. */
+    GPIO_Type *base;               /*!< GPIO peripheral base pointer. */
+    uint32_t port;                 /*!< GPIO port of the waveform pins. */
+    CTIMER_Type *timer;            /*!< Timer pacing the steps, NULL if the trigger is set up by the application. */
+    gpio_wave_callback_t callback; /*!< Callback function. */
+    void *userData;                /*!< Callback function parameter. */
+    volatile bool busy;            /*!< A waveform is playing. */
+};
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* _cplusplus */
+
+/*!
+ * @name Playback
+ * @{
+ */
+
+/*!
+ * @brief Initializes a GPIO waveform handle.
+ *
+ * The DMA channel is requested and triggered by a rising edge of the trigger, one word per edge. With a timer, the
+ * timer is reset on its match 0 every step ticks, and its match 0 triggers the DMA. The DMA is initialized if it is
+ * not yet. The waveform pins should be configured as outputs with GPIO_PinInit(). The timers CTIMER0 and CTIMER1
+ * are on the asynchronous APB bridge, which should be enabled.
+ *
+ * @param handle GPIO waveform handle pointer.
+ * @param config GPIO waveform configuration.
+ * @retval kStatus_Success The handle is initialized.
+ * @retval kStatus_DMA_Busy The DMA channel is requested already.
+ * @retval kStatus_InvalidArgument The step ticks of the timer is 0.
+ */
+status_t GPIO_WaveInit(gpio_wave_handle_t *handle, const gpio_wave_config_t *config);
+
+/*!
+ * @brief De-initializes a GPIO waveform handle, the playing waveform is stopped and the DMA channel released.
+ *
+ * @param handle GPIO waveform handle pointer.
+ */
+void GPIO_WaveDeinit(gpio_wave_handle_t *handle);
+
+/*!
+ * @brief Installs the callback called once a waveform played once is done.
+ *
+ * @param handle GPIO waveform handle pointer.
+ * @param callback Callback function, NULL for no callback.
+ * @param userData Parameter of the callback function.
+ */
+void GPIO_WaveSetCallback(gpio_wave_handle_t *handle, gpio_wave_callback_t callback, void *userData);
+
+/*!
+ * @brief Starts playing encoded waveform words.
+ *
+ * The pins should be at the start levels of the encoding. The words are read by the DMA while playing, they
+ * should be kept until the waveform is done or stopped.
+ *
+ * @param handle GPIO waveform handle pointer.
+ * @param words Encoded words.
+ * @param count Number of words, up to #GPIO_WAVE_MAX_STEPS.
+ * @param loop Replay the waveform until GPIO_WaveStop() is called.
+ * @retval kStatus_Success The waveform is started.
+ * @retval kStatus_DMA_Busy A waveform is playing.
+ * @retval kStatus_OutOfRange The waveform has too many steps.
+ * @retval kStatus_InvalidArgument The count is 0.
+ */
+status_t GPIO_WaveStart(gpio_wave_handle_t *handle, const uint32_t *words, uint32_t count, bool loop);
+
+/*!
+ * @brief Stops the playing waveform, the pins keep the levels of the last step played.
+ *
+ * @param handle GPIO waveform handle pointer.
+ */
+void GPIO_WaveStop(gpio_wave_handle_t *handle);
+
+/*!
+ * @brief Gets whether a waveform is playing.
+ *
+ * @param handle GPIO waveform handle pointer.
+ * @return true if a waveform is playing.
+ */
+static inline bool GPIO_WaveIsBusy(gpio_wave_handle_t *handle)
+{
+    return handle->busy;
+}
+
+/*! @} */
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_GPIO_WAVE_H_ */
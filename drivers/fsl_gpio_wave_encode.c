@@ -0,0 +1,106 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_gpio_wave_encode.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.gpio_wave"
+#endif
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/*!
+ * brief Encodes a sequence of pin levels into waveform words.
+ *
+ * A waveform word is written to the GPIO NOT register of the port, it holds the pins changing at the step. The other
+ * pins of the port and the GPIO MASK register are not affected. The encoding only depends on its arguments, it is
+ * built on the host by the tests as well.
+ *
+ * param mask Port bits of the waveform pins.
+ * param levels Port levels at each step, only the bits of the mask are used.
+ * param words Encoded words, it could be the same array as the levels.
+ * param count Number of steps.
+ * param startLevels Port levels before the first step. For a looped waveform, it should be the levels of the last
+ *                    step.
+ * retval kStatus_Success The levels are encoded.
+ * retval kStatus_InvalidArgument The count is 0.
+ */
+status_t GPIO_WaveEncode(uint32_t mask, const uint32_t *levels, uint32_t *words, uint32_t count, uint32_t startLevels)
+{
+    uint32_t previous = startLevels;
+    uint32_t current;
+    uint32_t i;
+
+    assert((NULL != levels) && (NULL != words));
+
+    if (0U == count)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    for (i = 0U; i < count; i++)
+    {
+        current  = levels[i];
+        words[i] = (current ^ previous) & mask;
+        previous = current;
+    }
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Encodes a bit stream into waveform words, with one bit cell per data bit.
+ *
+ * The bits are played the most significant bit of each byte first, the pin is low before the first step.
+ *
+ * param cell Bit cell of the protocol.
+ * param data Data to encode.
+ * param bitCount Number of data bits.
+ * param words Encoded words, the cell steps times the bit count words are written.
+ * param wordCount Number of words of the words array.
+ * retval kStatus_Success The bits are encoded.
+ * retval kStatus_OutOfRange The words array is too short.
+ * retval kStatus_InvalidArgument The cell is invalid or the bit count is 0.
+ */
+status_t GPIO_WaveEncodeBits(
+    const gpio_wave_cell_t *cell, const uint8_t *data, uint32_t bitCount, uint32_t *words, uint32_t wordCount)
+{
+    uint32_t level = 0U;
+    uint32_t pattern;
+    uint32_t bit;
+    uint32_t step;
+
+    assert((NULL != cell) && (NULL != data) && (NULL != words));
+
+    if ((0U == cell->steps) || (cell->steps > 32U) || (0U == cell->pinMask) || (0U == bitCount))
+    {
+        return kStatus_InvalidArgument;
+    }
+    if ((uint64_t)bitCount * cell->steps > wordCount)
+    {
+        return kStatus_OutOfRange;
+    }
+
+    for (bit = 0U; bit < bitCount; bit++)
+    {
+        pattern = (0U != (data[bit >> 3U] & (0x80U >> (bit & 7U)))) ? cell->oneLevels : cell->zeroLevels;
+        for (step = 0U; step < cell->steps; step++)
+        {
+            /* The word toggles the pin when the level of the step differs from the level of the previous step. */
+            *words++ = (0U != (((pattern >> step) ^ level) & 1U)) ? cell->pinMask : 0U;
+            level    = (pattern >> step) & 1U;
+        }
+    }
+
+    return kStatus_Success;
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_GPIO_WAVE_ENCODE_H_
+#define _FSL_GPIO_WAVE_ENCODE_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup gpio_wave
+ * @{
+ */
+
+/*! @file */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!
+ * @brief Bit cell of a one-wire serial waveform, such as the WS2812 LED protocol.
+ *
+ * Each data bit is played as the same number of steps, the level of the pin at step n is the bit n of the level
+ * pattern of the bit value.
+ */
+typedef struct _gpio_wave_cell
+{
+    uint32_t pinMask;    /*!< Port bit of the data pin. */
+    uint32_t zeroLevels; /*!< Pin level at each step of a 0 bit, step 0 in bit 0. */
+    uint32_t oneLevels;  /*!< Pin level at each step of a 1 bit, step 0 in bit 0. */
+    uint8_t steps;       /*!< Number of steps of a bit cell, from 1 to 32. */
+} gpio_wave_cell_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @name Encoding
+ * @{
+ */
+
+/*!
+ * @brief Encodes a sequence of pin levels into waveform words.
+ *
+ * A waveform word is written to the GPIO NOT register of the port, it holds the pins changing at the step. The other
+ * pins of the port and the GPIO MASK register are not affected. The encoding only depends on its arguments, it is
+ * built on the host by the tests as well.
+ *
+ * @param mask Port bits of the waveform pins.
+ * @param levels Port levels at each step, only the bits of the mask are used.
+ * @param words Encoded words, it could be the same array as the levels.
+ * @param count Number of steps.
+ * @param startLevels Port levels before the first step. For a looped waveform, it should be the levels of the last
+ *                    step.
+ * @retval kStatus_Success The levels are encoded.
+ * @retval kStatus_InvalidArgument The count is 0.
+ */
+status_t GPIO_WaveEncode(uint32_t mask, const uint32_t *levels, uint32_t *words, uint32_t count, uint32_t startLevels);
+
+/*!
+ * @brief Encodes a bit stream into waveform words, with one bit cell per data bit.
+ *
+ * The bits are played the most significant bit of each byte first, the pin is low before the first step.
+ *
+ * @param cell Bit cell of the protocol.
+ * @param data Data to encode.
+ * @param bitCount Number of data bits.
+ * @param words Encoded words, the cell steps times the bit count words are written.
+ * @param wordCount Number of words of the words array.
+ * @retval kStatus_Success The bits are encoded.
+ * @retval kStatus_OutOfRange The words array is too short.
+ * @retval kStatus_InvalidArgument The cell is invalid or the bit count is 0.
+ */
+status_t GPIO_WaveEncodeBits(
+    const gpio_wave_cell_t *cell, const uint8_t *data, uint32_t bitCount, uint32_t *words, uint32_t wordCount);
+
+/*! @} */
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_GPIO_WAVE_ENCODE_H_ */
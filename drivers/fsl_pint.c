@@ -0,0 +1,446 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_pint.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.pint"
+#endif
+
+/*! @brief Width of the source and condition fields of a bit slice in PMSRC and PMCFG. */
+#define PINT_PMATCH_FIELD_WIDTH (3U)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*!
+ * @brief Common interrupt handler of the pin interrupts.
+ *
+ * @param intr Pin interrupt.
+ */
+static void PINT_CommonIRQHandler(pint_pin_int_t intr);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/*! @brief Interrupt numbers of the pin interrupts. */
+static const IRQn_Type s_pintIRQ[] = PINT_IRQS;
+/*! @brief Callbacks of the pin interrupts. */
+static pint_cb_t s_pintCallback[PINT_PIN_INT_COUNT];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*!
+ * brief Initializes the PINT peripheral.
+ *
+ * This function enables the PINT clock, resets the module and removes all the callbacks.
+ *
+ * param base Base address of the PINT peripheral.
+ */
+void PINT_Init(PINT_Type *base)
+{
+    uint32_t i;
+
+    assert(NULL != base);
+
+    for (i = 0U; i < PINT_PIN_INT_COUNT; i++)
+    {
+        s_pintCallback[i] = NULL;
+    }
+
+#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
+    CLOCK_EnableClock(kCLOCK_Pint);
+#endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
+    RESET_PeripheralReset(kPINT_RST_SHIFT_RSTn);
+}
+
+/*!
+ * brief Deinitializes the PINT peripheral.
+ *
+ * This function disables the PINT interrupts and gates the PINT clock.
+ *
+ * param base Base address of the PINT peripheral.
+ */
+void PINT_Deinit(PINT_Type *base)
+{
+    uint32_t i;
+
+    assert(NULL != base);
+
+    PINT_DisableCallback(base);
+    for (i = 0U; i < PINT_PIN_INT_COUNT; i++)
+    {
+        s_pintCallback[i] = NULL;
+    }
+
+    RESET_PeripheralReset(kPINT_RST_SHIFT_RSTn);
+#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
+    CLOCK_DisableClock(kCLOCK_Pint);
+#endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
+}
+
+/*!
+ * brief Attaches a GPIO pin to a pin interrupt input.
+ *
+ * The input is used by the pin interrupt of the same number and as a pattern match input source.
+ *
+ * param base Base address of the PINT peripheral.
+ * param intr Pin interrupt input.
+ * param port GPIO port of the pin.
+ * param pin GPIO pin number.
+ */
+void PINT_AttachPin(PINT_Type *base, pint_pin_int_t intr, uint32_t port, uint32_t pin)
+{
+    assert((uint32_t)intr < INPUTMUX_PINTSEL_COUNT);
+    assert(pin < 32U);
+
+#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
+    CLOCK_EnableClock(kCLOCK_InputMux);
+#endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
+    INPUTMUX->PINTSEL[intr] = INPUTMUX_PINTSEL_INTPIN(port * 32U + pin);
+}
+
+/*!
+ * brief Configures a pin interrupt.
+ *
+ * In pattern match mode, the edge types raise the interrupt when the product term ending at the bit slice becomes
+ * true and the level types raise it while the product term is true.
+ *
+ * param base Base address of the PINT peripheral.
+ * param intr Pin interrupt.
+ * param enable Interrupt type.
+ * param callback Callback called from the interrupt, NULL for no callback.
+ */
+void PINT_PinInterruptConfig(PINT_Type *base, pint_pin_int_t intr, pint_pin_enable_t enable, pint_cb_t callback)
+{
+    uint32_t mask = 1UL << (uint32_t)intr;
+
+    assert((uint32_t)intr < PINT_PIN_INT_COUNT);
+
+    base->CIENR = mask;
+    base->CIENF = mask;
+
+    switch (enable)
+    {
+        case kPINT_PinIntEnableRiseEdge:
+            base->ISEL &= ~mask;
+            base->SIENR = mask;
+            break;
+        case kPINT_PinIntEnableFallEdge:
+            base->ISEL &= ~mask;
+            base->SIENF = mask;
+            break;
+        case kPINT_PinIntEnableBothEdges:
+            base->ISEL &= ~mask;
+            base->SIENR = mask;
+            base->SIENF = mask;
+            break;
+        case kPINT_PinIntEnableLowLevel:
+            /* In level mode, IENF selects the active level. */
+            base->ISEL |= mask;
+            base->SIENR = mask;
+            break;
+        case kPINT_PinIntEnableHighLevel:
+            base->ISEL |= mask;
+            base->SIENR = mask;
+            base->SIENF = mask;
+            break;
+        default:
+            base->ISEL &= ~mask;
+            break;
+    }
+
+    /* Drop an edge detected before the configuration. */
+    if (0U == (base->ISEL & mask))
+    {
+        base->IST = mask;
+    }
+
+    s_pintCallback[intr] = callback;
+}
+
+/*!
+ * brief Compiles a sum-of-products expression into the configuration of all the bit slices.
+ *
+ * The literals of each term are placed in consecutive bit slices, the last bit slice of a term ends it and raises
+ * the pin interrupt of the same number. The unused bit slices never match, so that they raise no interrupt. The
+ * configuration only depends on the arguments, so it could be compiled on a host as well.
+ *
+ * param terms Product terms of the expression.
+ * param termCount Number of product terms.
+ * param cfg Configuration of the #PINT_PIN_INT_COUNT bit slices.
+ * param termInt Pin interrupt raised by each term, NULL if not needed.
+ * retval kStatus_Success The expression is compiled.
+ * retval kStatus_OutOfRange The expression has more literals than bit slices.
+ * retval kStatus_InvalidArgument A term is empty or a literal is invalid.
+ */
+status_t PINT_PatternMatchCompile(const pint_pmatch_term_t *terms,
+                                  uint32_t termCount,
+                                  pint_pmatch_cfg_t *cfg,
+                                  pint_pin_int_t *termInt)
+{
+    const pint_pmatch_literal_t *literal;
+    uint32_t slice = 0U;
+    uint32_t term;
+    uint32_t i;
+
+    assert((NULL != terms) && (NULL != cfg));
+
+    for (term = 0U; term < termCount; term++)
+    {
+        if ((0U == terms[term].literalCount) || (NULL == terms[term].literals))
+        {
+            return kStatus_InvalidArgument;
+        }
+        if ((slice + terms[term].literalCount) > PINT_PIN_INT_COUNT)
+        {
+            return kStatus_OutOfRange;
+        }
+
+        for (i = 0U; i < terms[term].literalCount; i++)
+        {
+            literal = &terms[term].literals[i];
+            if (((uint32_t)literal->source >= PINT_PIN_INT_COUNT) ||
+                ((uint32_t)literal->condition > (uint32_t)kPINT_PatternMatchBothEdges))
+            {
+                return kStatus_InvalidArgument;
+            }
+            cfg[slice].source    = literal->source;
+            cfg[slice].condition = literal->condition;
+            cfg[slice].endPoint  = false;
+            slice++;
+        }
+
+        cfg[slice - 1U].endPoint = true;
+        if (NULL != termInt)
+        {
+            termInt[term] = (pint_pin_int_t)(slice - 1U);
+        }
+    }
+
+    /* The bit slices left over make a last term ending at the last bit slice, it should never match. */
+    for (; slice < PINT_PIN_INT_COUNT; slice++)
+    {
+        cfg[slice].source    = kPINT_PatternMatchInp0Src;
+        cfg[slice].condition = kPINT_PatternMatchNever;
+        cfg[slice].endPoint  = (slice == (PINT_PIN_INT_COUNT - 1U));
+    }
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Configures all the bit slices at once.
+ *
+ * The sources and the conditions are written by one store each. The pattern match engine is disabled around the
+ * two stores, so it never evaluates an expression with the new sources and the old conditions. Meanwhile the pins
+ * act as pin interrupts, their interrupts should not be enabled. It also resets the sticky edge detection.
+ *
+ * param base Base address of the PINT peripheral.
+ * param cfg Configuration of the #PINT_PIN_INT_COUNT bit slices.
+ */
+void PINT_PatternMatchConfigAll(PINT_Type *base, const pint_pmatch_cfg_t *cfg)
+{
+    uint32_t pmsrc = 0U;
+    uint32_t pmcfg = 0U;
+    uint32_t pmctrl;
+    uint32_t slice;
+
+    assert(NULL != cfg);
+
+    for (slice = 0U; slice < PINT_PIN_INT_COUNT; slice++)
+    {
+        pmsrc |= (uint32_t)cfg[slice].source << (PINT_PMSRC_SRC0_SHIFT + slice * PINT_PMATCH_FIELD_WIDTH);
+        pmcfg |= (uint32_t)cfg[slice].condition << (PINT_PMCFG_CFG0_SHIFT + slice * PINT_PMATCH_FIELD_WIDTH);
+        /* The last bit slice has no end point bit, it always ends a product term. */
+        if ((slice < (PINT_PIN_INT_COUNT - 1U)) && cfg[slice].endPoint)
+        {
+            pmcfg |= 1UL << (PINT_PMCFG_PROD_ENDPTS0_SHIFT + slice);
+        }
+    }
+
+    pmctrl       = base->PMCTRL;
+    base->PMCTRL = pmctrl & ~PINT_PMCTRL_SEL_PMATCH_MASK;
+    base->PMCFG  = pmcfg;
+    base->PMSRC  = pmsrc;
+    base->PMCTRL = pmctrl;
+}
+
+/*!
+ * brief Configures one bit slice.
+ *
+ * param base Base address of the PINT peripheral.
+ * param bslice Bit slice.
+ * param cfg Configuration of the bit slice.
+ */
+void PINT_PatternMatchConfig(PINT_Type *base, uint32_t bslice, const pint_pmatch_cfg_t *cfg)
+{
+    uint32_t srcShift = PINT_PMSRC_SRC0_SHIFT + bslice * PINT_PMATCH_FIELD_WIDTH;
+    uint32_t cfgShift = PINT_PMCFG_CFG0_SHIFT + bslice * PINT_PMATCH_FIELD_WIDTH;
+    uint32_t pmcfg;
+
+    assert((bslice < PINT_PIN_INT_COUNT) && (NULL != cfg));
+
+    pmcfg = (base->PMCFG & ~(0x7UL << cfgShift)) | ((uint32_t)cfg->condition << cfgShift);
+    if (bslice < (PINT_PIN_INT_COUNT - 1U))
+    {
+        pmcfg &= ~(1UL << (PINT_PMCFG_PROD_ENDPTS0_SHIFT + bslice));
+        if (cfg->endPoint)
+        {
+            pmcfg |= 1UL << (PINT_PMCFG_PROD_ENDPTS0_SHIFT + bslice);
+        }
+    }
+
+    base->PMCFG = pmcfg;
+    base->PMSRC = (base->PMSRC & ~(0x7UL << srcShift)) | ((uint32_t)cfg->source << srcShift);
+}
+
+/*!
+ * brief Enables the interrupts of all the pin interrupts with a callback.
+ *
+ * param base Base address of the PINT peripheral.
+ */
+void PINT_EnableCallback(PINT_Type *base)
+{
+    uint32_t i;
+
+    assert(NULL != base);
+
+    for (i = 0U; i < PINT_PIN_INT_COUNT; i++)
+    {
+        if (NULL != s_pintCallback[i])
+        {
+            PINT_PinInterruptClrStatus(base, (pint_pin_int_t)i);
+            NVIC_ClearPendingIRQ(s_pintIRQ[i]);
+            (void)EnableIRQ(s_pintIRQ[i]);
+        }
+    }
+}
+
+/*!
+ * brief Disables the interrupts of all the pin interrupts.
+ *
+ * param base Base address of the PINT peripheral.
+ */
+void PINT_DisableCallback(PINT_Type *base)
+{
+    uint32_t i;
+
+    assert(NULL != base);
+
+    for (i = 0U; i < PINT_PIN_INT_COUNT; i++)
+    {
+        (void)DisableIRQ(s_pintIRQ[i]);
+        PINT_PinInterruptClrStatus(base, (pint_pin_int_t)i);
+        NVIC_ClearPendingIRQ(s_pintIRQ[i]);
+    }
+}
+
+static void PINT_CommonIRQHandler(pint_pin_int_t intr)
+{
+    uint32_t pmatchStatus = 0U;
+
+    if (0U != (PINT->PMCTRL & PINT_PMCTRL_SEL_PMATCH_MASK))
+    {
+        pmatchStatus = PINT_PatternMatchGetStatusAll(PINT);
+    }
+    PINT_PinInterruptClrStatus(PINT, intr);
+
+    if (NULL != s_pintCallback[intr])
+    {
+        s_pintCallback[intr](intr, pmatchStatus);
+    }
+}
+
+void PIN_INT0_DriverIRQHandler(void)
+{
+    PINT_CommonIRQHandler(kPINT_PinInt0);
+/* Add for ARM errata 838869, affects Cortex-M4, Cortex-M4F Store immediate overlapping
+  exception return operation might vector to incorrect interrupt */
+#if defined __CORTEX_M && (__CORTEX_M == 4U)
+    __DSB();
+#endif
+}
+
+void PIN_INT1_DriverIRQHandler(void)
+{
+    PINT_CommonIRQHandler(kPINT_PinInt1);
+/* Add for ARM errata 838869, affects Cortex-M4, Cortex-M4F Store immediate overlapping
+  exception return operation might vector to incorrect interrupt */
+#if defined __CORTEX_M && (__CORTEX_M == 4U)
+    __DSB();
+#endif
+}
+
+void PIN_INT2_DriverIRQHandler(void)
+{
+    PINT_CommonIRQHandler(kPINT_PinInt2);
+/* Add for ARM errata 838869, affects Cortex-M4, Cortex-M4F Store immediate overlapping
+  exception return operation might vector to incorrect interrupt */
+#if defined __CORTEX_M && (__CORTEX_M == 4U)
+    __DSB();
+#endif
+}
+
+void PIN_INT3_DriverIRQHandler(void)
+{
+    PINT_CommonIRQHandler(kPINT_PinInt3);
+/* Add for ARM errata 838869, affects Cortex-M4, Cortex-M4F Store immediate overlapping
+  exception return operation might vector to incorrect interrupt */
+#if defined __CORTEX_M && (__CORTEX_M == 4U)
+    __DSB();
+#endif
+}
+
+void PIN_INT4_DriverIRQHandler(void)
+{
+    PINT_CommonIRQHandler(kPINT_PinInt4);
+/* Add for ARM errata 838869, affects Cortex-M4, Cortex-M4F Store immediate overlapping
+  exception return operation might vector to incorrect interrupt */
+#if defined __CORTEX_M && (__CORTEX_M == 4U)
+    __DSB();
+#endif
+}
+
+void PIN_INT5_DriverIRQHandler(void)
+{
+    PINT_CommonIRQHandler(kPINT_PinInt5);
+/* Add for ARM errata 838869, affects Cortex-M4, Cortex-M4F Store immediate overlapping
+  exception return operation might vector to incorrect interrupt */
+#if defined __CORTEX_M && (__CORTEX_M == 4U)
+    __DSB();
+#endif
+}
+
+void PIN_INT6_DriverIRQHandler(void)
+{
+    PINT_CommonIRQHandler(kPINT_PinInt6);
+/* Add for ARM errata 838869, affects Cortex-M4, Cortex-M4F Store immediate overlapping
+  exception return operation might vector to incorrect interrupt */
+#if defined __CORTEX_M && (__CORTEX_M == 4U)
+    __DSB();
+#endif
+}
+
+void PIN_INT7_DriverIRQHandler(void)
+{
+    PINT_CommonIRQHandler(kPINT_PinInt7);
+/* Add for ARM errata 838869, affects Cortex-M4, Cortex-M4F Store immediate overlapping
+  exception return operation might vector to incorrect interrupt */
+#if defined __CORTEX_M && (__CORTEX_M == 4U)
+    __DSB();
+#endif
+}
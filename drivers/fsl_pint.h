@@ -0,0 +1,343 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_PINT_H_
+#define _FSL_PINT_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup pint_driver
+ * @{
+ */
+
+/*! @file */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @name Driver version */
+/*@{*/
+/*! @brief PINT driver version 2.0.0. */
+#define FSL_PINT_DRIVER_VERSION (MAKE_VERSION(2, 0, 0))
+/*@}*/
+
+/*! @brief Number of pin interrupts, it is also the number of pattern match bit slices. */
+#define PINT_PIN_INT_COUNT (FSL_FEATURE_PINT_NUMBER_OF_CONNECTED_OUTPUTS)
+
+/*! @brief PINT pin interrupt enable type */
+typedef enum _pint_pin_enable
+{
+    kPINT_PinIntEnableNone      = 0U, /*!< Do not generate Pin Interrupt */
+    kPINT_PinIntEnableRiseEdge  = 1U, /*!< Generate Pin Interrupt on rising edge */
+    kPINT_PinIntEnableFallEdge  = 2U, /*!< Generate Pin Interrupt on falling edge */
+    kPINT_PinIntEnableBothEdges = 3U, /*!< Generate Pin Interrupt on both edges */
+    kPINT_PinIntEnableLowLevel  = 4U, /*!< Generate Pin Interrupt on low level */
+    kPINT_PinIntEnableHighLevel = 5U, /*!< Generate Pin Interrupt on high level */
+} pint_pin_enable_t;
+
+/*! @brief PINT pin interrupt, it is also the pattern match bit slice ending a product term. */
+typedef enum _pint_pin_int
+{
+    kPINT_PinInt0 = 0U, /*!< Pin Interrupt 0 */
+    kPINT_PinInt1 = 1U, /*!< Pin Interrupt 1 */
+    kPINT_PinInt2 = 2U, /*!< Pin Interrupt 2 */
+    kPINT_PinInt3 = 3U, /*!< Pin Interrupt 3 */
+    kPINT_PinInt4 = 4U, /*!< Pin Interrupt 4 */
+    kPINT_PinInt5 = 5U, /*!< Pin Interrupt 5 */
+    kPINT_PinInt6 = 6U, /*!< Pin Interrupt 6 */
+    kPINT_PinInt7 = 7U, /*!< Pin Interrupt 7 */
+} pint_pin_int_t;
+
+/*! @brief PINT pattern match bit slice input source, the pin attached to the pin interrupt input. */
+typedef enum _pint_pmatch_input_src
+{
+    kPINT_PatternMatchInp0Src = 0U, /*!< Input source 0 */
+    kPINT_PatternMatchInp1Src = 1U, /*!< Input source 1 */
+    kPINT_PatternMatchInp2Src = 2U, /*!< Input source 2 */
+    kPINT_PatternMatchInp3Src = 3U, /*!< Input source 3 */
+    kPINT_PatternMatchInp4Src = 4U, /*!< Input source 4 */
+    kPINT_PatternMatchInp5Src = 5U, /*!< Input source 5 */
+    kPINT_PatternMatchInp6Src = 6U, /*!< Input source 6 */
+    kPINT_PatternMatchInp7Src = 7U, /*!< Input source 7 */
+} pint_pmatch_input_src_t;
+
+/*! @brief PINT pattern match bit slice condition */
+typedef enum _pint_pmatch_bslice_cfg
+{
+    kPINT_PatternMatchAlways          = 0U, /*!< Always Contributes to product term match */
+    kPINT_PatternMatchStickyRise      = 1U, /*!< Sticky Rising edge */
+    kPINT_PatternMatchStickyFall      = 2U, /*!< Sticky Falling edge */
+    kPINT_PatternMatchStickyBothEdges = 3U, /*!< Sticky Rising or Falling edge */
+    kPINT_PatternMatchHigh            = 4U, /*!< High level */
+    kPINT_PatternMatchLow             = 5U, /*!< Low level */
+    kPINT_PatternMatchNever           = 6U, /*!< Never contributes to product term match */
+    kPINT_PatternMatchBothEdges       = 7U, /*!< Either rising or falling edge, not sticky */
+} pint_pmatch_bslice_cfg_t;
+
+/*! @brief PINT callback function, the pattern match status is 0 in pin interrupt mode. */
+typedef void (*pint_cb_t)(pint_pin_int_t pintr, uint32_t pmatchStatus);
+
+/*! @brief PINT pattern match configuration of a bit slice */
+typedef struct _pint_pmatch_cfg
+{
+    pint_pmatch_input_src_t source;     /*!< Input of the bit slice. */
+    pint_pmatch_bslice_cfg_t condition; /*!< Condition of the input. */
+    bool endPoint;                      /*!< The bit slice ends a product term, bit slice 7 always ends one. */
+} pint_pmatch_cfg_t;
+
+/*! @brief Literal of a product term, an input with its condition. */
+typedef struct _pint_pmatch_literal
+{
+    pint_pmatch_input_src_t source;     /*!< Input of the literal. */
+    pint_pmatch_bslice_cfg_t condition; /*!< Condition of the input. */
+} pint_pmatch_literal_t;
+
+/*! @brief Product term of a sum-of-products expression, it is true when all its literals are. */
+typedef struct _pint_pmatch_term
+{
+    const pint_pmatch_literal_t *literals; /*!< Literals of the term. */
+    uint8_t literalCount;                  /*!< Number of literals of the term. */
+} pint_pmatch_term_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @name Initialization
+ * @{
+ */
+
+/*!
+ * @brief Initializes the PINT peripheral.
+ *
+ * This function enables the PINT clock, resets the module and removes all the callbacks.
+ *
+ * @param base Base address of the PINT peripheral.
+ */
+void PINT_Init(PINT_Type *base);
+
+/*!
+ * @brief Deinitializes the PINT peripheral.
+ *
+ * This function disables the PINT interrupts and gates the PINT clock.
+ *
+ * @param base Base address of the PINT peripheral.
+ */
+void PINT_Deinit(PINT_Type *base);
+
+/*!
+ * @brief Attaches a GPIO pin to a pin interrupt input.
+ *
+ * The input is used by the pin interrupt of the same number and as a pattern match input source.
+ *
+ * @param base Base address of the PINT peripheral.
+ * @param intr Pin interrupt input.
+ * @param port GPIO port of the pin.
+ * @param pin GPIO pin number.
+ */
+void PINT_AttachPin(PINT_Type *base, pint_pin_int_t intr, uint32_t port, uint32_t pin);
+
+/*! @} */
+
+/*!
+ * @name Pin interrupt
+ * @{
+ */
+
+/*!
+ * @brief Configures a pin interrupt.
+ *
+ * In pattern match mode, the edge types raise the interrupt when the product term ending at the bit slice becomes
+ * true and the level types raise it while the product term is true.
+ *
+ * @param base Base address of the PINT peripheral.
+ * @param intr Pin interrupt.
+ * @param enable Interrupt type.
+ * @param callback Callback called from the interrupt, NULL for no callback.
+ */
+void PINT_PinInterruptConfig(PINT_Type *base, pint_pin_int_t intr, pint_pin_enable_t enable, pint_cb_t callback);
+
+/*!
+ * @brief Gets the status of all the pin interrupts.
+ *
+ * @param base Base address of the PINT peripheral.
+ * @return Status of the pin interrupts, one bit per pin interrupt.
+ */
+static inline uint32_t PINT_PinInterruptGetStatusAll(PINT_Type *base)
+{
+    return base->IST;
+}
+
+/*!
+ * @brief Clears the status of a pin interrupt in edge mode, the status of a level interrupt follows the input.
+ *
+ * @param base Base address of the PINT peripheral.
+ * @param intr Pin interrupt.
+ */
+static inline void PINT_PinInterruptClrStatus(PINT_Type *base, pint_pin_int_t intr)
+{
+    /* Writing the status of a level interrupt would switch its active level. */
+    if (0U == (base->ISEL & (1UL << (uint32_t)intr)))
+    {
+        base->IST = 1UL << (uint32_t)intr;
+    }
+}
+
+/*! @} */
+
+/*!
+ * @name Pattern match
+ * @{
+ */
+
+/*!
+ * @brief Compiles a sum-of-products expression into the configuration of all the bit slices.
+ *
+ * The literals of each term are placed in consecutive bit slices, the last bit slice of a term ends it and raises
+ * the pin interrupt of the same number. The unused bit slices never match, so that they raise no interrupt. The
+ * configuration only depends on the arguments, so it could be compiled on a host as well.
+ *
+ * @code
+ * // (input 0 high AND input 1 low) OR (input 2 rising)
+ * static const pint_pmatch_literal_t s_interlock[] = {{kPINT_PatternMatchInp0Src, kPINT_PatternMatchHigh},
+ *                                                     {kPINT_PatternMatchInp1Src, kPINT_PatternMatchLow}};
+ * static const pint_pmatch_literal_t s_emergency[] = {{kPINT_PatternMatchInp2Src, kPINT_PatternMatchStickyRise}};
+ * static const pint_pmatch_term_t s_terms[] = {{s_interlock, 2U}, {s_emergency, 1U}};
+ * @endcode
+ *
+ * @param terms Product terms of the expression.
+ * @param termCount Number of product terms.
+ * @param cfg Configuration of the #PINT_PIN_INT_COUNT bit slices.
+ * @param termInt Pin interrupt raised by each term, NULL if not needed.
+ * @retval kStatus_Success The expression is compiled.
+ * @retval kStatus_OutOfRange The expression has more literals than bit slices.
+ * @retval kStatus_InvalidArgument A term is empty or a literal is invalid.
+ */
+status_t PINT_PatternMatchCompile(const pint_pmatch_term_t *terms,
+                                  uint32_t termCount,
+                                  pint_pmatch_cfg_t *cfg,
+                                  pint_pin_int_t *termInt);
+
+/*!
+ * @brief Configures all the bit slices at once.
+ *
+ * The sources and the conditions are written by one store each. The pattern match engine is disabled around the
+ * two stores, so it never evaluates an expression with the new sources and the old conditions. Meanwhile the pins
+ * act as pin interrupts, their interrupts should not be enabled. It also resets the sticky edge detection.
+ *
+ * @param base Base address of the PINT peripheral.
+ * @param cfg Configuration of the #PINT_PIN_INT_COUNT bit slices.
+ */
+void PINT_PatternMatchConfigAll(PINT_Type *base, const pint_pmatch_cfg_t *cfg);
+
+/*!
+ * @brief Configures one bit slice.
+ *
+ * @param base Base address of the PINT peripheral.
+ * @param bslice Bit slice.
+ * @param cfg Configuration of the bit slice.
+ */
+void PINT_PatternMatchConfig(PINT_Type *base, uint32_t bslice, const pint_pmatch_cfg_t *cfg);
+
+/*!
+ * @brief Gets the match status of all the product terms.
+ *
+ * @param base Base address of the PINT peripheral.
+ * @return Match status, one bit per bit slice ending a true product term.
+ */
+static inline uint32_t PINT_PatternMatchGetStatusAll(PINT_Type *base)
+{
+    return (base->PMCTRL & PINT_PMCTRL_PMAT_MASK) >> PINT_PMCTRL_PMAT_SHIFT;
+}
+
+/*!
+ * @brief Resets the sticky edge detection of all the bit slices.
+ *
+ * @param base Base address of the PINT peripheral.
+ */
+static inline void PINT_PatternMatchResetDetectLogic(PINT_Type *base)
+{
+    base->PMSRC = base->PMSRC;
+}
+
+/*!
+ * @brief Switches the pin interrupts to the pattern match engine.
+ *
+ * @param base Base address of the PINT peripheral.
+ */
+static inline void PINT_PatternMatchEnable(PINT_Type *base)
+{
+    base->PMCTRL = (base->PMCTRL & PINT_PMCTRL_ENA_RXEV_MASK) | PINT_PMCTRL_SEL_PMATCH_MASK;
+}
+
+/*!
+ * @brief Switches the pin interrupts back to the pin inputs.
+ *
+ * @param base Base address of the PINT peripheral.
+ */
+static inline void PINT_PatternMatchDisable(PINT_Type *base)
+{
+    base->PMCTRL = base->PMCTRL & PINT_PMCTRL_ENA_RXEV_MASK;
+}
+
+/*!
+ * @brief Enables the RXEV output of the core when a product term is true, to wake it up from WFE.
+ *
+ * @param base Base address of the PINT peripheral.
+ */
+static inline void PINT_PatternMatchEnableRXEV(PINT_Type *base)
+{
+    base->PMCTRL = (base->PMCTRL & PINT_PMCTRL_SEL_PMATCH_MASK) | PINT_PMCTRL_ENA_RXEV_MASK;
+}
+
+/*!
+ * @brief Disables the RXEV output of the core.
+ *
+ * @param base Base address of the PINT peripheral.
+ */
+static inline void PINT_PatternMatchDisableRXEV(PINT_Type *base)
+{
+    base->PMCTRL = base->PMCTRL & PINT_PMCTRL_SEL_PMATCH_MASK;
+}
+
+/*! @} */
+
+/*!
+ * @name Callback
+ * @{
+ */
+
+/*!
+ * @brief Enables the interrupts of all the pin interrupts with a callback.
+ *
+ * @param base Base address of the PINT peripheral.
+ */
+void PINT_EnableCallback(PINT_Type *base);
+
+/*!
+ * @brief Disables the interrupts of all the pin interrupts.
+ *
+ * @param base Base address of the PINT peripheral.
+ */
+void PINT_DisableCallback(PINT_Type *base);
+
+/*! @} */
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_PINT_H_ */
@@ -43,6 +43,16 @@ static const clock_ip_name_t s_usartClock[] = USART_CLOCKS;
 static const reset_ip_name_t s_usartResets[] = USART_RSTS;
 #endif
 
+/* FIFO configuration of a USART cached for the blocking transfers. */
+typedef struct _usart_fifo_context
+{
+    bool isTxFifoEnabled; /* TX goes through the system FIFO. */
+    bool isRxFifoEnabled; /* RX goes through the system FIFO. */
+} usart_fifo_context_t;
+
+/* Array of the FIFO configuration of each USART instance. */
+static usart_fifo_context_t s_usartFifoContext[FSL_FEATURE_SOC_USART_COUNT];
+
 /* Typedef for interrupt handler. */
 typedef void (*usart_isr_t)(USART_Type *base, usart_handle_t *handle);
 
@@ -52,6 +62,27 @@ static usart_isr_t s_usartIsr;
 /*******************************************************************************
  * Code
  ******************************************************************************/
+/* Get the instance from the address without searching s_usartBaseAddrs, the USARTs are evenly spaced. */
+static inline uint32_t USART_GetInstanceFromAddress(USART_Type *base)
+{
+    uint32_t instance = ((uint32_t)base - s_usartBaseAddrs[0]) / (s_usartBaseAddrs[1] - s_usartBaseAddrs[0]);
+
+    assert((instance < FSL_FEATURE_SOC_USART_COUNT) && ((uint32_t)base == s_usartBaseAddrs[instance]));
+    return instance;
+}
+
+/*!
+ * brief Updates the FIFO configuration cached for the byte and blocking transfers.
+ *
+ * param base USART peripheral base address.
+ */
+void USART_UpdateFifoContext(USART_Type *base)
+{
+    uint32_t instance = USART_GetInstanceFromAddress(base);
+
+    s_usartFifoContext[instance].isTxFifoEnabled = USART_IsTxFifoEnable(base);
+    s_usartFifoContext[instance].isRxFifoEnabled = USART_IsRxFifoEnable(base);
+}
 
 /* Get the index corresponding to the USART */
 /*! brief Returns instance number for USART peripheral base address. */
@@ -83,8 +114,9 @@ uint32_t USART_GetInstance(USART_Type *base)
  */
 void USART_WriteByte(USART_Type *base, uint8_t data)
 {
-    uint32_t instance = USART_GetInstance(base);
-    if (USART_IsTxFifoEnable(base))
+    uint32_t instance = USART_GetInstanceFromAddress(base);
+
+    if (s_usartFifoContext[instance].isTxFifoEnabled)
     {
         VFIFO->USART[instance].TXDATUSART = data;
     }
@@ -107,8 +139,10 @@ void USART_WriteByte(USART_Type *base, uint8_t data)
  */
 uint8_t USART_ReadByte(USART_Type *base)
 {
-    uint32_t instance = USART_GetInstance(base);
-    return ((USART_IsRxFifoEnable(base)) ? (VFIFO->USART[instance].RXDATUSART) : (base->RXDAT & 0x000000FFU));
+    uint32_t instance = USART_GetInstanceFromAddress(base);
+
+    return ((s_usartFifoContext[instance].isRxFifoEnabled) ? (VFIFO->USART[instance].RXDATUSART) :
+                                                             (base->RXDAT & 0x000000FFU));
 }
 
 /* Get system FIFO USART status flags. */
@@ -131,7 +165,7 @@ uint8_t USART_ReadByte(USART_Type *base)
  */
 uint32_t USART_GetFifoStatusFlags(USART_Type *base)
 {
-    uint32_t instance = USART_GetInstance(base);
+    uint32_t instance = USART_GetInstanceFromAddress(base);
     return (VFIFO->USART[instance].STATUSART);
 }
 
@@ -152,7 +186,7 @@ uint32_t USART_GetFifoStatusFlags(USART_Type *base)
  */
 void USART_ClearFifoStatusFlags(USART_Type *base, uint32_t mask)
 {
-    uint32_t instance = USART_GetInstance(base);
+    uint32_t instance = USART_GetInstanceFromAddress(base);
     VFIFO->USART[instance].STATUSART |= mask;
 }
 
@@ -172,7 +206,7 @@ void USART_ClearFifoStatusFlags(USART_Type *base, uint32_t mask)
  */
 void USART_EnableFifoInterrupts(USART_Type *base, uint32_t mask)
 {
-    uint32_t instance = USART_GetInstance(base);
+    uint32_t instance = USART_GetInstanceFromAddress(base);
     VFIFO->USART[instance].CTLSETUSART |= mask;
 }
 
@@ -192,7 +226,7 @@ void USART_EnableFifoInterrupts(USART_Type *base, uint32_t mask)
  */
 void USART_DisableFifoInterrupts(USART_Type *base, uint32_t mask)
 {
-    uint32_t instance = USART_GetInstance(base);
+    uint32_t instance = USART_GetInstanceFromAddress(base);
     VFIFO->USART[instance].CTLCLRUSART |= mask;
 }
 
@@ -206,7 +240,7 @@ void USART_DisableFifoInterrupts(USART_Type *base, uint32_t mask)
  */
 uint32_t USART_GetEnabledFifoInterrupts(USART_Type *base)
 {
-    uint32_t instance = USART_GetInstance(base);
+    uint32_t instance = USART_GetInstanceFromAddress(base);
     return (VFIFO->USART[instance].CTLSETUSART);
 }
 
@@ -221,7 +255,7 @@ uint32_t USART_GetEnabledFifoInterrupts(USART_Type *base)
  */
 void USART_FifoFlush(USART_Type *base, uint32_t direction)
 {
-    uint32_t instance = USART_GetInstance(base);
+    uint32_t instance = USART_GetInstanceFromAddress(base);
 
     if (kUSART_FifoTx & direction)
     {
@@ -298,14 +332,13 @@ void USART_EnableFifo(USART_Type *base, const usart_fifo_config_t *config)
     VFIFO->USART[instance].CFGUSART &= ~(VFIFO_USART_CFGUSART_RXTHRESHOLD_MASK | VFIFO_USART_CFGUSART_TXTHRESHOLD_MASK);
     VFIFO->USART[instance].CFGUSART |= VFIFO_USART_CFGUSART_RXTHRESHOLD(config->rxFifoThreshold) |
                                        VFIFO_USART_CFGUSART_TXTHRESHOLD(config->txFifoThreshold);
-    /* Update all the TX and RX fifo size. */
-    VFIFO->FIFOUPDATEUSART |=
-        VFIFO_FIFOUPDATEUSART_USART0RXUPDATESIZE_MASK | VFIFO_FIFOUPDATEUSART_USART1RXUPDATESIZE_MASK |
-        VFIFO_FIFOUPDATEUSART_USART2RXUPDATESIZE_MASK | VFIFO_FIFOUPDATEUSART_USART3RXUPDATESIZE_MASK |
-        VFIFO_FIFOUPDATEUSART_USART0TXUPDATESIZE_MASK | VFIFO_FIFOUPDATEUSART_USART1TXUPDATESIZE_MASK |
-        VFIFO_FIFOUPDATEUSART_USART2TXUPDATESIZE_MASK | VFIFO_FIFOUPDATEUSART_USART3TXUPDATESIZE_MASK;
+    /* Update the TX and RX fifo size of this instance only, the other instances keep their entries. */
+    VFIFO->FIFOUPDATEUSART =
+        (VFIFO_FIFOUPDATEUSART_USART0RXUPDATESIZE_MASK | VFIFO_FIFOUPDATEUSART_USART0TXUPDATESIZE_MASK) << instance;
     /* Unpause the system FIFO for transfer. */
     VFIFO->FIFOCTLUSART &= ~(VFIFO_FIFOCTLUSART_RXPAUSE_MASK | VFIFO_FIFOCTLUSART_TXPAUSE_MASK);
+
+    USART_UpdateFifoContext(base);
 }
 
 /*!
@@ -332,6 +365,9 @@ void USART_DisableFifo(USART_Type *base)
     USART_FifoFlush(base, kUSART_FifoTx | kUSART_FifoRx);
     /* Set the TX and RX FIFO size. */
     VFIFO->FIFOCFGUSART[instance] = VFIFO_FIFOCFGUSART_RXSIZE(0U) | VFIFO_FIFOCFGUSART_TXSIZE(0U);
+    /* Give the entries of this instance back to the pools. */
+    VFIFO->FIFOUPDATEUSART =
+        (VFIFO_FIFOUPDATEUSART_USART0RXUPDATESIZE_MASK | VFIFO_FIFOUPDATEUSART_USART0TXUPDATESIZE_MASK) << instance;
     /* Set the TX and RX FIFO threshold size. */
     VFIFO->USART[instance].CFGUSART &= ~(VFIFO_USART_CFGUSART_RXTHRESHOLD_MASK | VFIFO_USART_CFGUSART_TXTHRESHOLD_MASK);
     /* Disable all FIFO interrupts. */
@@ -360,6 +396,8 @@ void USART_DisableFifo(USART_Type *base)
         default:
             break;
     }
+
+    USART_UpdateFifoContext(base);
 }
 
 /* Check if TX FIFO enabled. */
@@ -497,24 +535,6 @@ size_t USART_TransferGetRxRingBufferLength(usart_handle_t *handle)
     return size;
 }
 
-static bool USART_TransferIsRxRingBufferFull(usart_handle_t *handle)
-{
-    bool full = 0U;
-
-    /* Check arguments */
-    assert(NULL != handle);
-
-    if (USART_TransferGetRxRingBufferLength(handle) == (handle->rxRingBufferSize - 1U))
-    {
-        full = true;
-    }
-    else
-    {
-        full = false;
-    }
-    return full;
-}
-
 /*!
  * brief Sets up the RX ring buffer.
  *
@@ -538,12 +558,15 @@ void USART_TransferStartRingBuffer(USART_Type *base, usart_handle_t *handle, uin
     assert(NULL != base);
     assert(NULL != handle);
     assert(NULL != ringBuffer);
+    /* A burst from the RX FIFO should fit in the ring buffer. */
+    assert(ringBufferSize > ((handle->isRxFifoEnabled) ? (handle->rxFifoThreshold + 1U) : (1U)));
 
     /* Setup the ringbuffer address */
-    handle->rxRingBuffer     = ringBuffer;
-    handle->rxRingBufferSize = ringBufferSize;
-    handle->rxRingBufferHead = 0U;
-    handle->rxRingBufferTail = 0U;
+    handle->rxRingBuffer             = ringBuffer;
+    handle->rxRingBufferSize         = ringBufferSize;
+    handle->rxRingBufferHead         = 0U;
+    handle->rxRingBufferTail         = 0U;
+    handle->rxRingBufferOverrunCount = 0U;
 
     /* Ring buffer is ready we can start receiving data */
     if (handle->isRxFifoEnabled)
@@ -639,10 +662,19 @@ status_t USART_Init(USART_Type *base, const usart_config_t *config, uint32_t src
     base->CFG = USART_CFG_PARITYSEL(config->parityMode) | USART_CFG_STOPLEN(config->stopBitCount) |
                 USART_CFG_DATALEN(config->bitCountPerChar) | USART_CFG_LOOP(config->loopback) |
                 USART_CFG_SYNCEN(config->syncMode >> 1) | USART_CFG_SYNCMST(config->syncMode) |
-                USART_CFG_CLKPOL(config->clockPolarity) | USART_CFG_ENABLE_MASK;
+                USART_CFG_CLKPOL(config->clockPolarity) | USART_CFG_OESEL(config->outputEnable) |
+                USART_CFG_OEPOL((uint32_t)config->outputEnable >> 1U) |
+                USART_CFG_OETA(config->enableOutputEnableTurnaround) | USART_CFG_ENABLE_MASK;
 
-    /* Setup baudrate */
-    result = USART_SetBaudRate(base, config->baudRate_Bps, srcClock_Hz);
+    /* Setup baudrate, the SCLK of the synchronous mode has no oversampling to trade against the FRG. */
+    if ((config->enableFractionalBaudRate) && (kUSART_SyncModeDisabled == config->syncMode))
+    {
+        result = USART_SetFractionalBaudRate(base, config->baudRate_Bps, srcClock_Hz, NULL);
+    }
+    else
+    {
+        result = USART_SetBaudRate(base, config->baudRate_Bps, srcClock_Hz);
+    }
     if (kStatus_Success != result)
     {
         return result;
@@ -651,11 +683,18 @@ status_t USART_Init(USART_Type *base, const usart_config_t *config, uint32_t src
     /* Setting continuous Clock configuration. used for synchronous mode. */
     USART_EnableContinuousSCLK(base, config->enableContinuousSCLK);
 
+    /* Setting hardware flow control, the transmitter is held off while CTS is deasserted. */
+    USART_EnableCTS(base, config->enableHardwareFlowControl);
+
     /* Check if FIFO is enabled from extern configuration. */
     if ((config->fifoConfig.enableTxFifo) || (config->fifoConfig.enableRxFifo))
     {
         USART_EnableFifo(base, &config->fifoConfig);
     }
+    else
+    {
+        USART_UpdateFifoContext(base);
+    }
     /* Setup the USART transmit and receive. */
     USART_EnableTx(base, config->enableTx);
     USART_EnableRx(base, config->enableRx);
@@ -716,22 +755,26 @@ void USART_GetDefaultConfig(usart_config_t *config)
     memset(config, 0, sizeof(*config));
 
     /* Set always all members ! */
-    config->baudRate_Bps               = 115200U;
-    config->parityMode                 = kUSART_ParityDisabled;
-    config->stopBitCount               = kUSART_OneStopBit;
-    config->bitCountPerChar            = kUSART_8BitsPerChar;
-    config->loopback                   = false;
-    config->enableRx                   = false;
-    config->enableTx                   = false;
-    config->fifoConfig.enableTxFifo    = false;
-    config->fifoConfig.enableRxFifo    = false;
-    config->fifoConfig.rxFifoSize      = 16U;
-    config->fifoConfig.txFifoSize      = 16U;
-    config->fifoConfig.txFifoThreshold = 0U;
-    config->fifoConfig.rxFifoThreshold = 0U;
-    config->syncMode                   = kUSART_SyncModeDisabled;
-    config->enableContinuousSCLK       = false;
-    config->clockPolarity              = kUSART_RxSampleOnFallingEdge;
+    config->baudRate_Bps                 = 115200U;
+    config->parityMode                   = kUSART_ParityDisabled;
+    config->stopBitCount                 = kUSART_OneStopBit;
+    config->bitCountPerChar              = kUSART_8BitsPerChar;
+    config->loopback                     = false;
+    config->enableHardwareFlowControl    = false;
+    config->enableRx                     = false;
+    config->enableTx                     = false;
+    config->fifoConfig.enableTxFifo      = false;
+    config->fifoConfig.enableRxFifo      = false;
+    config->fifoConfig.rxFifoSize        = 16U;
+    config->fifoConfig.txFifoSize        = 16U;
+    config->fifoConfig.txFifoThreshold   = 0U;
+    config->fifoConfig.rxFifoThreshold   = 0U;
+    config->syncMode                     = kUSART_SyncModeDisabled;
+    config->enableContinuousSCLK         = false;
+    config->clockPolarity                = kUSART_RxSampleOnFallingEdge;
+    config->outputEnable                 = kUSART_OutputEnableDisabled;
+    config->enableOutputEnableTurnaround = false;
+    config->enableFractionalBaudRate     = false;
 }
 
 /*!
@@ -767,8 +810,14 @@ status_t USART_SetBaudRate(USART_Type *base, uint32_t baudrate_Bps, uint32_t src
     {
         if (base->CFG & USART_CFG_SYNCMST_MASK)
         {
-            brgval    = srcClock_Hz / baudrate_Bps;
-            base->BRG = brgval - 1;
+            /* SCLK is the clock divided by BRG, without oversampling; round up so that it does not exceed the
+             * requested rate. */
+            brgval = (srcClock_Hz + baudrate_Bps - 1U) / baudrate_Bps;
+            if ((brgval == 0U) || (brgval > 0x10000U))
+            {
+                return kStatus_USART_BaudrateNotSupport;
+            }
+            base->BRG = brgval - 1U;
         }
     }
     else
@@ -807,6 +856,131 @@ status_t USART_SetBaudRate(USART_Type *base, uint32_t baudrate_Bps, uint32_t src
     return kStatus_Success;
 }
 
+/*!
+ * brief Calculates the FRG multiplier, oversampling and BRG values for a baud rate.
+ *
+ * The three dividers are searched jointly, which reaches rates such as 921600 or 3000000 baud that an integer BRG
+ * cannot hit from the same clock. Higher oversampling is preferred among settings with the same error. The search
+ * time grows with the ratio of the clock to the baud rate, USART_SetBaudRate is cheaper for low rates.
+ *
+ * param baudrate_Bps USART baudrate to be set.
+ * param srcClock_Hz Frequency of the clock feeding the FRG, the asynchronous APB clock.
+ * param config Pointer to the settings found, the error is also reported when the rate is out of tolerance.
+ * retval kStatus_USART_BaudrateNotSupport The error is over USART_FRACTIONAL_BAUDRATE_TOLERANCE_PPM.
+ * retval kStatus_Success A setting within tolerance is found.
+ * retval kStatus_InvalidArgument One or more arguments are invalid.
+ */
+status_t USART_CalculateFractionalBaudRate(uint32_t baudrate_Bps,
+                                           uint32_t srcClock_Hz,
+                                           usart_fractional_baudrate_t *config)
+{
+    uint64_t numerator = (uint64_t)srcClock_Hz * 256U;
+    uint64_t divider, brgMin, brgMax, brg;
+    uint32_t best_diff = (uint32_t)-1;
+    uint32_t osrval, mult, diff, baudrate;
+
+    /* check arguments */
+    assert(!((NULL == config) || (0 == baudrate_Bps) || (0 == srcClock_Hz)));
+    if ((NULL == config) || (0 == baudrate_Bps) || (0 == srcClock_Hz))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    config->errorPpm = (uint32_t)-1;
+
+    for (osrval = 15U; (osrval >= 4U) && (0U != best_diff); osrval--)
+    {
+        /* (256 + MULT) * (BRG + 1) should be numerator / divider, with 256 + MULT from 256 to 511. */
+        divider = (uint64_t)baudrate_Bps * (osrval + 1U);
+        brgMin  = (numerator + (divider * 511U) - 1U) / (divider * 511U);
+        brgMax  = numerator / (divider * 256U);
+        if (brgMax > (USART_BRG_BRGVAL_MASK + 1U))
+        {
+            brgMax = USART_BRG_BRGVAL_MASK + 1U;
+        }
+
+        for (brg = brgMin; (brg <= brgMax) && (0U != best_diff); brg++)
+        {
+            /* Round 256 + MULT to the nearest value for this BRG. */
+            mult = (uint32_t)((numerator + ((divider * brg) / 2U)) / (divider * brg));
+            if (mult > 511U)
+            {
+                mult = 511U;
+            }
+            baudrate = (uint32_t)(numerator / ((uint64_t)mult * (osrval + 1U) * brg));
+            diff     = baudrate_Bps < baudrate ? baudrate - baudrate_Bps : baudrate_Bps - baudrate;
+            if (diff < best_diff)
+            {
+                best_diff        = diff;
+                config->frgMult  = (uint8_t)(mult - 256U);
+                config->osrVal   = (uint8_t)osrval;
+                config->brgVal   = (uint16_t)(brg - 1U);
+                config->errorPpm = (uint32_t)(((uint64_t)diff * 1000000U) / baudrate_Bps);
+            }
+        }
+    }
+
+    if (config->errorPpm > USART_FRACTIONAL_BAUDRATE_TOLERANCE_PPM)
+    {
+        return kStatus_USART_BaudrateNotSupport;
+    }
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Sets the USART instance baud rate through the FRG.
+ *
+ * This function searches the settings with USART_CalculateFractionalBaudRate, programs the FRG multiplier and
+ * the USART OSR and BRG registers.
+ * code
+ *  USART_SetFractionalBaudRate(USART0, 3000000U, CLOCK_GetAsyncApbClkFreq(), &errorPpm);
+ * endcode
+ *
+ * note The FRG is shared by all the USART instances, setting it changes the baud rate of the other instances.
+ *
+ * param base USART peripheral base address.
+ * param baudrate_Bps USART baudrate to be set.
+ * param srcClock_Hz Frequency of the clock feeding the FRG, the asynchronous APB clock.
+ * param errorPpm Returns the error of the baud rate set in parts per million, it could be NULL.
+ * retval kStatus_USART_BaudrateNotSupport The error is over USART_FRACTIONAL_BAUDRATE_TOLERANCE_PPM.
+ * retval kStatus_Success Set baudrate succeed.
+ * retval kStatus_InvalidArgument One or more arguments are invalid.
+ */
+status_t USART_SetFractionalBaudRate(USART_Type *base,
+                                     uint32_t baudrate_Bps,
+                                     uint32_t srcClock_Hz,
+                                     uint32_t *errorPpm)
+{
+    usart_fractional_baudrate_t config;
+    status_t result;
+
+    /* check arguments */
+    assert(NULL != base);
+    if (NULL == base)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    config.errorPpm = (uint32_t)-1;
+    result          = USART_CalculateFractionalBaudRate(baudrate_Bps, srcClock_Hz, &config);
+    if (NULL != errorPpm)
+    {
+        *errorPpm = config.errorPpm;
+    }
+    if (kStatus_Success != result)
+    {
+        return result;
+    }
+
+    /* The multiplier is programmed as found, it is not derived back from a rate of another clock. */
+    CLOCK_SetFRGMult(config.frgMult);
+    base->OSR = config.osrVal;
+    base->BRG = config.brgVal;
+
+    return kStatus_Success;
+}
+
 /*!
  * brief Writes to the TX register using a blocking method.
  *
@@ -820,6 +994,7 @@ status_t USART_SetBaudRate(USART_Type *base, uint32_t baudrate_Bps, uint32_t src
 void USART_WriteBlocking(USART_Type *base, const uint8_t *data, size_t length)
 {
     uint32_t instance = 0U;
+    uint32_t count;
     /* Check arguments */
     assert(!((NULL == base) || (NULL == data)));
     if ((NULL == base) || (NULL == data))
@@ -827,27 +1002,37 @@ void USART_WriteBlocking(USART_Type *base, const uint8_t *data, size_t length)
         return;
     }
 
-    instance = USART_GetInstance(base);
+    instance = USART_GetInstanceFromAddress(base);
 
-    for (; length > 0; length--)
+    if (s_usartFifoContext[instance].isTxFifoEnabled)
     {
-        if (USART_IsTxFifoEnable(base))
+        while (length > 0U)
         {
-            /* Loop until TX FIFO is empty for new data */
-            while (!(VFIFO->USART[instance].STATUSART & VFIFO_USART_STATUSART_TXEMPTY_MASK))
+            /* Fill all the free entries of the TX FIFO in a burst. */
+            count = (VFIFO->USART[instance].STATUSART & VFIFO_USART_STATUSART_TXCOUNT_MASK) >>
+                    VFIFO_USART_STATUSART_TXCOUNT_SHIFT;
+            for (; (count > 0U) && (length > 0U); count--, length--)
             {
+                VFIFO->USART[instance].TXDATUSART = *data;
+                data++;
             }
-            VFIFO->USART[instance].TXDATUSART = *data;
         }
-        else
+        /* Wait for the TX FIFO to be drained into the USART. */
+        while (!(VFIFO->USART[instance].STATUSART & VFIFO_USART_STATUSART_TXEMPTY_MASK))
+        {
+        }
+    }
+    else
+    {
+        for (; length > 0; length--)
         {
             /* Wait for TX is ready to transmit new data. */
             while (!(base->STAT & USART_STAT_TXRDY_MASK))
             {
             }
             base->TXDAT = *data;
+            data++;
         }
-        data++;
     }
     /* Wait to finish transfer */
     while (!(base->STAT & USART_STAT_TXIDLE_MASK))
@@ -855,6 +1040,40 @@ void USART_WriteBlocking(USART_Type *base, const uint8_t *data, size_t length)
     }
 }
 
+/*!
+ * brief Writes an address character in multi-drop mode using a blocking method.
+ *
+ * This function waits for the TX register to be empty or for the TX FIFO to have room and writes the address with
+ * the ninth bit set, the USART should be configured for 9-bit characters. It does not wait for the transmission to
+ * complete, so the data written next follows the address without a gap.
+ *
+ * param base USART peripheral base address.
+ * param address Address of the destination node.
+ */
+void USART_WriteAddressBlocking(USART_Type *base, uint8_t address)
+{
+    uint32_t instance;
+
+    assert(NULL != base);
+
+    instance = USART_GetInstanceFromAddress(base);
+
+    if (s_usartFifoContext[instance].isTxFifoEnabled)
+    {
+        while (!(VFIFO->USART[instance].STATUSART & VFIFO_USART_STATUSART_TXCOUNT_MASK))
+        {
+        }
+        VFIFO->USART[instance].TXDATUSART = USART_ADDRESS_CHARACTER_MASK | address;
+    }
+    else
+    {
+        while (!(base->STAT & USART_STAT_TXRDY_MASK))
+        {
+        }
+        base->TXDAT = USART_ADDRESS_CHARACTER_MASK | address;
+    }
+}
+
 /*!
  * brief Read RX data register using a blocking method.
  *
@@ -874,6 +1093,7 @@ status_t USART_ReadBlocking(USART_Type *base, uint8_t *data, size_t length)
 {
     uint32_t status;
     uint32_t instance = 0U;
+    uint32_t count;
 
     /* Check arguments */
     assert(!((NULL == base) || (NULL == data)));
@@ -882,69 +1102,72 @@ status_t USART_ReadBlocking(USART_Type *base, uint8_t *data, size_t length)
         return kStatus_InvalidArgument;
     }
 
-    instance = USART_GetInstance(base);
+    instance = USART_GetInstanceFromAddress(base);
 
-    for (; length > 0; length--)
+    if (s_usartFifoContext[instance].isRxFifoEnabled)
     {
-        if (USART_IsRxFifoEnable(base))
+        while (length > 0U)
         {
-            /* Wait for RX FIFO is not empty. */
-            while ((VFIFO->USART[instance].STATUSART & VFIFO_USART_STATUSART_RXEMPTY_MASK))
-            {
-            }
-            /* Check FIFO receive status. */
+            /* Check FIFO receive status, and drain all the received bytes in a burst. */
             status = VFIFO->USART[instance].STATUSART;
             if (status & VFIFO_USART_STATUSART_BUSERR_MASK)
             {
                 return kStatus_USART_FifoBusError;
             }
-            status = VFIFO->USART[instance].RXDATSTATUSART;
-            if (status & VFIFO_USART_RXDATSTATUSART_FRAMERR_MASK)
-            {
-                return kStatus_USART_FramingError;
-            }
-            if (status & VFIFO_USART_RXDATSTATUSART_PARITYERR_MASK)
-            {
-                return kStatus_USART_ParityError;
-            }
-            if (status & VFIFO_USART_RXDATSTATUSART_RXNOISE_MASK)
+            count = (status & VFIFO_USART_STATUSART_RXCOUNT_MASK) >> VFIFO_USART_STATUSART_RXCOUNT_SHIFT;
+            for (; (count > 0U) && (length > 0U); count--, length--)
             {
-                return kStatus_USART_NoiseError;
+                status = VFIFO->USART[instance].RXDATSTATUSART;
+                if (status & VFIFO_USART_RXDATSTATUSART_FRAMERR_MASK)
+                {
+                    return kStatus_USART_FramingError;
+                }
+                if (status & VFIFO_USART_RXDATSTATUSART_PARITYERR_MASK)
+                {
+                    return kStatus_USART_ParityError;
+                }
+                if (status & VFIFO_USART_RXDATSTATUSART_RXNOISE_MASK)
+                {
+                    return kStatus_USART_NoiseError;
+                }
+                *data = (status & VFIFO_USART_RXDATSTATUSART_RXDAT_MASK);
+                data++;
             }
-            *data = (status & VFIFO_USART_RXDATSTATUSART_RXDAT_MASK);
         }
-        else
+        return kStatus_Success;
+    }
+
+    for (; length > 0; length--)
+    {
+        /* loop until receive is ready to read */
+        while (!(base->STAT & USART_STAT_RXRDY_MASK))
         {
-            /* loop until receive is ready to read */
-            while (!(base->STAT & USART_STAT_RXRDY_MASK))
-            {
-            }
+        }
 
-            /* Check receive status */
-            status = base->STAT;
+        /* Check receive status */
+        status = base->STAT;
 
-            if (status & USART_STAT_FRAMERRINT_MASK)
-            {
-                base->STAT |= USART_STAT_FRAMERRINT_MASK;
-                return kStatus_USART_FramingError;
-            }
-            if (status & USART_STAT_PARITYERRINT_MASK)
-            {
-                base->STAT |= USART_STAT_PARITYERRINT_MASK;
-                return kStatus_USART_ParityError;
-            }
-            if (status & USART_STAT_RXNOISEINT_MASK)
-            {
-                base->STAT |= USART_STAT_RXNOISEINT_MASK;
-                return kStatus_USART_NoiseError;
-            }
-            if (base->STAT & USART_STAT_OVERRUNINT_MASK)
-            {
-                base->STAT |= USART_STAT_OVERRUNINT_MASK;
-                return kStatus_USART_HardwareOverrun;
-            }
-            *data = base->RXDAT;
+        if (status & USART_STAT_FRAMERRINT_MASK)
+        {
+            base->STAT |= USART_STAT_FRAMERRINT_MASK;
+            return kStatus_USART_FramingError;
+        }
+        if (status & USART_STAT_PARITYERRINT_MASK)
+        {
+            base->STAT |= USART_STAT_PARITYERRINT_MASK;
+            return kStatus_USART_ParityError;
+        }
+        if (status & USART_STAT_RXNOISEINT_MASK)
+        {
+            base->STAT |= USART_STAT_RXNOISEINT_MASK;
+            return kStatus_USART_NoiseError;
+        }
+        if (base->STAT & USART_STAT_OVERRUNINT_MASK)
+        {
+            base->STAT |= USART_STAT_OVERRUNINT_MASK;
+            return kStatus_USART_HardwareOverrun;
         }
+        *data = base->RXDAT;
         data++;
     }
     return kStatus_Success;
@@ -1379,13 +1602,14 @@ void USART_TransferHandleIRQ(USART_Type *base, usart_handle_t *handle)
 
     bool receiveEnabled = (handle->rxDataSize) || (handle->rxRingBuffer);
     bool sendEnabled    = handle->txDataSize;
-    uint32_t instance   = USART_GetInstance(base);
+    uint32_t instance   = USART_GetInstanceFromAddress(base);
 
     /* If RX overrun. */
     if (base->STAT & USART_STAT_OVERRUNINT_MASK)
     {
         /* Clear rx error state. */
         base->STAT |= USART_STAT_OVERRUNINT_MASK;
+        handle->rxHardwareOverrunCount++;
         /* Trigger callback. */
         if (handle->callback)
         {
@@ -1454,49 +1678,57 @@ void USART_TransferHandleIRQ(USART_Type *base, usart_handle_t *handle)
             {
                 if (handle->rxRingBuffer)
                 {
-                    uint8_t count = (handle->isRxFifoEnabled) ? (handle->rxFifoThreshold + 1) : (1U);
-                    /* If RX ring buffer is full, trigger callback to notify over run. */
-                    while (count--)
+                    uint32_t count = (handle->isRxFifoEnabled) ? (handle->rxFifoThreshold + 1U) : (1U);
+                    uint32_t head  = handle->rxRingBufferHead;
+                    uint32_t space = handle->rxRingBufferSize - 1U - USART_TransferGetRxRingBufferLength(handle);
+                    uint32_t span;
+
+                    /* If RX ring buffer has no room for the burst, trigger callback once to notify over run. */
+                    if (count > space)
                     {
-                        if (USART_TransferIsRxRingBufferFull(handle))
+                        if (handle->callback)
                         {
-                            if (handle->callback)
-                            {
-                                handle->callback(base, handle, kStatus_USART_RxRingBufferOverrun, handle->userData);
-                            }
+                            handle->callback(base, handle, kStatus_USART_RxRingBufferOverrun, handle->userData);
                         }
-                        /* If ring buffer is still full after callback function, the oldest data is overridden. */
-                        if (USART_TransferIsRxRingBufferFull(handle))
+                        space = handle->rxRingBufferSize - 1U - USART_TransferGetRxRingBufferLength(handle);
+                    }
+                    /* If ring buffer is still short after callback function, the oldest data is overridden. */
+                    if (count > space)
+                    {
+                        span = handle->rxRingBufferTail + (count - space);
+                        if (span >= handle->rxRingBufferSize)
                         {
-                            /* Increase handle->rxRingBufferTail to make room for new data. */
-                            if (handle->rxRingBufferTail + 1U == handle->rxRingBufferSize)
-                            {
-                                handle->rxRingBufferTail = 0U;
-                            }
-                            else
-                            {
-                                handle->rxRingBufferTail++;
-                            }
+                            span -= handle->rxRingBufferSize;
                         }
-                        /* Read data. */
-                        if (handle->isRxFifoEnabled)
+                        handle->rxRingBufferTail = span;
+                        handle->rxRingBufferOverrunCount += count - space;
+                    }
+                    /* Read data, the burst is split in two spans at most by the end of the ring buffer. */
+                    while (count > 0U)
+                    {
+                        span = handle->rxRingBufferSize - head;
+                        if (span > count)
                         {
-                            handle->rxRingBuffer[handle->rxRingBufferHead] = VFIFO->USART[instance].RXDATUSART;
+                            span = count;
                         }
-                        else
+                        count -= span;
+                        if (handle->isRxFifoEnabled)
                         {
-                            handle->rxRingBuffer[handle->rxRingBufferHead] = base->RXDAT;
+                            for (; span > 0U; span--)
+                            {
+                                handle->rxRingBuffer[head++] = VFIFO->USART[instance].RXDATUSART;
+                            }
                         }
-                        /* Increase handle->rxRingBufferHead. */
-                        if (handle->rxRingBufferHead + 1U == handle->rxRingBufferSize)
+                        else
                         {
-                            handle->rxRingBufferHead = 0U;
+                            handle->rxRingBuffer[head++] = base->RXDAT;
                         }
-                        else
+                        if (head == handle->rxRingBufferSize)
                         {
-                            handle->rxRingBufferHead++;
+                            head = 0U;
                         }
                     }
+                    handle->rxRingBufferHead = head;
                 }
             }
         }
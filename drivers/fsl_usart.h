@@ -25,6 +25,11 @@
 #define FSL_USART_DRIVER_VERSION (MAKE_VERSION(2, 1, 0))
 /*@}*/
 
+/*! @brief Largest baud rate error (in parts per million) accepted by #USART_CalculateFractionalBaudRate. */
+#ifndef USART_FRACTIONAL_BAUDRATE_TOLERANCE_PPM
+#define USART_FRACTIONAL_BAUDRATE_TOLERANCE_PPM (10000U)
+#endif
+
 /*! @brief Error codes for the USART driver. */
 enum _usart_status
 {
@@ -72,8 +77,12 @@ typedef enum _usart_data_len
 {
     kUSART_7BitsPerChar = 0U, /*!< Seven bit mode */
     kUSART_8BitsPerChar = 1U, /*!< Eight bit mode */
+    kUSART_9BitsPerChar = 2U, /*!< Nine bit mode, the ninth bit marks the address characters in multi-drop mode */
 } usart_data_len_t;
 
+/*! @brief Ninth bit of a received or transmitted character, set for the address characters in 9-bit mode. */
+#define USART_ADDRESS_CHARACTER_MASK (0x100U)
+
 /*! @brief USART FIFO driection. */
 typedef enum _usart_fifo_direction
 {
@@ -88,6 +97,28 @@ typedef enum _usart_clock_polarity
     kUSART_RxSampleOnRisingEdge  = 0x1U, /*!< Un_RXD is sampled on the rising edge of SCLK. */
 } usart_clock_polarity_t;
 
+/*! @brief USART output enable, the RTS pin used as the driver enable of an RS-485 transceiver. */
+typedef enum _usart_output_enable
+{
+    kUSART_OutputEnableDisabled   = 0x0U, /*!< RTS is the standard flow control output. */
+    kUSART_OutputEnableActiveLow  = 0x1U, /*!< RTS is an active low output enable, asserted while transmitting. */
+    kUSART_OutputEnableActiveHigh = 0x3U, /*!< RTS is an active high output enable, asserted while transmitting. */
+} usart_output_enable_t;
+
+/*!
+ * @brief USART fractional baud rate settings.
+ *
+ * The baud rate is srcClock_Hz * 256 / ((256 + frgMult) * (osrVal + 1) * (brgVal + 1)), where srcClock_Hz is the
+ * clock feeding the FRG.
+ */
+typedef struct _usart_fractional_baudrate
+{
+    uint8_t frgMult;   /*!< FRG multiplier, 0 leaves the FRG clock undivided. */
+    uint8_t osrVal;    /*!< Oversampling value, each bit is sampled osrVal + 1 times. */
+    uint16_t brgVal;   /*!< Baud rate generator value, the divider is brgVal + 1. */
+    uint32_t errorPpm; /*!< Error of the resulting baud rate in parts per million. */
+} usart_fractional_baudrate_t;
+
 /*!
  * @brief USART interrupt configuration structure, default settings all disabled.
  */
@@ -185,12 +216,20 @@ typedef struct _usart_config
     bool enableTx;                       /*!< USART transmit enable.  */
     bool enableContinuousSCLK;           /*!< USART continuous Clock generation enable in synchronous master mode. */
     bool loopback;                       /*!< Enable peripheral loopback */
+    bool enableHardwareFlowControl;      /*!< Enable CTS gating of the transmitter. RTS is driven by the receiver
+                                              whenever the pin is routed to the USART. */
     usart_parity_mode_t parityMode;      /*!< Parity mode, disabled (default), even, odd */
     usart_stop_bit_count_t stopBitCount; /*!< Number of stop bits, 1 stop bit (default) or 2 stop bits  */
-    usart_data_len_t bitCountPerChar;    /*!< Data length - 7 bit, 8 bit  */
+    usart_data_len_t bitCountPerChar;    /*!< Data length - 7 bit, 8 bit, 9 bit  */
     usart_fifo_config_t fifoConfig;      /*!< FIFO configuration for USART. */
     usart_sync_mode_t syncMode; /*!< Transfer mode select - asynchronous, synchronous master, synchronous slave. */
     usart_clock_polarity_t clockPolarity; /*!< Selects the clock polarity and sampling edge in synchronous mode. */
+    usart_output_enable_t outputEnable;   /*!< RS-485 output enable on RTS, asserted by the hardware from the start
+                                               bit to the end of the last stop bit of a transmission. */
+    bool enableOutputEnableTurnaround;    /*!< Keep the output enable asserted for one more character time, for
+                                               transceivers slow to release the bus. */
+    bool enableFractionalBaudRate;        /*!< Set the baud rate with USART_SetFractionalBaudRate in the asynchronous
+                                               mode, the srcClock_Hz of USART_Init is then the clock feeding the FRG. */
 } usart_config_t;
 
 /*! @brief USART transfer structure. */
@@ -220,6 +259,8 @@ struct _usart_handle
     size_t rxRingBufferSize;            /*!< Size of the ring buffer. */
     volatile uint16_t rxRingBufferHead; /*!< Index for the driver to store received data into ring buffer. */
     volatile uint16_t rxRingBufferTail; /*!< Index for the user to get data from the ring buffer. */
+    volatile uint32_t rxRingBufferOverrunCount; /*!< Bytes of the ring buffer overridden by new data. */
+    volatile uint32_t rxHardwareOverrunCount;   /*!< Hardware overruns seen by the transactional driver. */
 
     usart_transfer_callback_t callback; /*!< Callback function. */
     void *userData;                     /*!< USART callback function parameter.*/
@@ -271,7 +312,7 @@ uint32_t USART_GetInstance(USART_Type *base);
  *
  * @param base USART peripheral base address.
  * @param config Pointer to user-defined configuration structure.
- * @param srcClock_Hz USART clock source frequency in HZ.
+ * @param srcClock_Hz USART clock source frequency in HZ, or the clock feeding the FRG with enableFractionalBaudRate.
  * @retval kStatus_USART_BaudrateNotSupport Baudrate is not support in current clock source.
  * @retval kStatus_InvalidArgument USART base address is not valid
  * @retval kStatus_Success Status USART initialize succeed
@@ -323,6 +364,44 @@ void USART_GetDefaultConfig(usart_config_t *config);
  */
 status_t USART_SetBaudRate(USART_Type *base, uint32_t baudrate_Bps, uint32_t srcClock_Hz);
 
+/*!
+ * @brief Calculates the FRG multiplier, oversampling and BRG values for a baud rate.
+ *
+ * The three dividers are searched jointly, which reaches rates such as 921600 or 3000000 baud that an integer BRG
+ * cannot hit from the same clock. Higher oversampling is preferred among settings with the same error.
+ *
+ * @param baudrate_Bps USART baudrate to be set.
+ * @param srcClock_Hz Frequency of the clock feeding the FRG, the asynchronous APB clock.
+ * @param config Pointer to the settings found, the error is also reported when the rate is out of tolerance.
+ * @retval kStatus_USART_BaudrateNotSupport The error is over #USART_FRACTIONAL_BAUDRATE_TOLERANCE_PPM.
+ * @retval kStatus_Success A setting within tolerance is found.
+ * @retval kStatus_InvalidArgument One or more arguments are invalid.
+ */
+status_t USART_CalculateFractionalBaudRate(uint32_t baudrate_Bps,
+                                           uint32_t srcClock_Hz,
+                                           usart_fractional_baudrate_t *config);
+
+/*!
+ * @brief Sets the USART instance baud rate through the FRG.
+ *
+ * This function searches the settings with #USART_CalculateFractionalBaudRate, programs the FRG multiplier and
+ * the USART OSR and BRG registers.
+ *
+ * @note The FRG is shared by all the USART instances, setting it changes the baud rate of the other instances.
+ *
+ * @param base USART peripheral base address.
+ * @param baudrate_Bps USART baudrate to be set.
+ * @param srcClock_Hz Frequency of the clock feeding the FRG, the asynchronous APB clock.
+ * @param errorPpm Returns the error of the baud rate set in parts per million, it could be NULL.
+ * @retval kStatus_USART_BaudrateNotSupport The error is over #USART_FRACTIONAL_BAUDRATE_TOLERANCE_PPM.
+ * @retval kStatus_Success Set baudrate succeed.
+ * @retval kStatus_InvalidArgument One or more arguments are invalid.
+ */
+status_t USART_SetFractionalBaudRate(USART_Type *base,
+                                     uint32_t baudrate_Bps,
+                                     uint32_t srcClock_Hz,
+                                     uint32_t *errorPpm);
+
 /* @} */
 
 /*!
@@ -544,6 +623,17 @@ bool USART_IsTxFifoEnable(USART_Type *base);
  */
 bool USART_IsRxFifoEnable(USART_Type *base);
 
+/*!
+ * @brief Updates the FIFO configuration cached for the byte and blocking transfers.
+ *
+ * The byte and blocking transfers use the FIFO enables cached by USART_Init, USART_EnableFifo and USART_DisableFifo
+ * rather than reading them back from SYSCON and VFIFO for each byte. It should be called once the system FIFO of
+ * the USART is configured by other means, such as VFIFO_ApplyPartition.
+ *
+ * @param base USART peripheral base address.
+ */
+void USART_UpdateFifoContext(USART_Type *base);
+
 /*!
  * @brief Flush the FIFO buffer.
  *
@@ -620,6 +710,89 @@ static inline void USART_EnableCTS(USART_Type *base, bool enable)
     }
 }
 
+/*!
+ * @brief Sets the address matched by the hardware in multi-drop mode.
+ *
+ * @param base    USART peripheral base address.
+ * @param address Address of this node.
+ */
+static inline void USART_SetMatchAddress(USART_Type *base, uint8_t address)
+{
+    base->ADDR = USART_ADDR_ADDRESS(address);
+}
+
+/*!
+ * @brief Enable or disable the address detection.
+ *
+ * While the detection is enabled, the receiver ignores the data characters, and the address characters which do not
+ * match the address set by USART_SetMatchAddress when the matching is enabled. The CPU is not involved in the
+ * characters ignored.
+ *
+ * @param base    USART peripheral base address.
+ * @param enable  Enable address detection or not, true for enable and false for disable.
+ */
+static inline void USART_EnableAddressDetect(USART_Type *base, bool enable)
+{
+    if (enable)
+    {
+        base->CTL |= USART_CTL_ADDRDET_MASK;
+    }
+    else
+    {
+        base->CTL &= ~USART_CTL_ADDRDET_MASK;
+    }
+}
+
+/*!
+ * @brief Enable or disable the hardware address matching of the multi-drop mode.
+ *
+ * The USART should be configured for 9-bit characters. Enabling the matching also enables the address detection,
+ * so that the receiver stays muted until an address character matching the address set by USART_SetMatchAddress
+ * is received. The received characters are then passed to USART_FilterMatchAddress, which opens the receiver for
+ * the message of this node and mutes it again at the address of another node.
+ *
+ * @param base    USART peripheral base address.
+ * @param match   Enable the matching or not, true for enable and false for disable.
+ */
+static inline void USART_EnableMatchAddress(USART_Type *base, bool match)
+{
+    if (match)
+    {
+        base->CFG |= USART_CFG_AUTOADDR_MASK;
+        base->CTL |= USART_CTL_ADDRDET_MASK;
+    }
+    else
+    {
+        base->CFG &= ~USART_CFG_AUTOADDR_MASK;
+        base->CTL &= ~USART_CTL_ADDRDET_MASK;
+    }
+}
+
+/*!
+ * @brief Filters a received character in multi-drop mode.
+ *
+ * An address character selects or deselects this node and is consumed: the address detection is disabled for the
+ * message of this node, and enabled again for the message of another node so that the hardware drops it. The
+ * characters must be passed in the order received, because the FIFO could still hold characters received before
+ * the address detection changed. The data characters are kept only while this node is addressed.
+ *
+ * @param base    USART peripheral base address.
+ * @param data    Received character, with the ninth bit.
+ * @param matched Pointer to the addressed state of this node, initially false, kept by the caller.
+ * @return true if the character is data for this node, false if it should be dropped.
+ */
+static inline bool USART_FilterMatchAddress(USART_Type *base, uint32_t data, bool *matched)
+{
+    if (0U != (data & USART_ADDRESS_CHARACTER_MASK))
+    {
+        *matched = ((data & USART_ADDR_ADDRESS_MASK) == (base->ADDR & USART_ADDR_ADDRESS_MASK));
+        USART_EnableAddressDetect(base, !(*matched));
+        return false;
+    }
+
+    return *matched;
+}
+
 /*!
  * @brief Enable the USART transmit.
  *
@@ -703,6 +876,18 @@ uint8_t USART_ReadByte(USART_Type *base);
  */
 void USART_WriteBlocking(USART_Type *base, const uint8_t *data, size_t length);
 
+/*!
+ * @brief Writes an address character in multi-drop mode using a blocking method.
+ *
+ * This function waits for the TX register to be empty or for the TX FIFO to have room and writes the address with
+ * the ninth bit set, the USART should be configured for 9-bit characters. It does not wait for the transmission to
+ * complete, so the data written next follows the address without a gap.
+ *
+ * @param base USART peripheral base address.
+ * @param address Address of the destination node.
+ */
+void USART_WriteAddressBlocking(USART_Type *base, uint8_t address);
+
 /*!
  * @brief Read RX data register using a blocking method.
  *
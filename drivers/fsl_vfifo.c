@@ -0,0 +1,438 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_vfifo.h"
+#include "fsl_usart.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.vfifo"
+#endif
+
+/*! @brief The FIFO enables of the USART and SPI peripherals in SYSCON FIFOCTRL. */
+#define VFIFO_FIFOCTRL_ENABLE_MASK                                                                                     \
+    (SYSCON_FIFOCTRL_U0TXFIFOEN_MASK | SYSCON_FIFOCTRL_U1TXFIFOEN_MASK | SYSCON_FIFOCTRL_U2TXFIFOEN_MASK |             \
+     SYSCON_FIFOCTRL_U3TXFIFOEN_MASK | SYSCON_FIFOCTRL_SPI0TXFIFOEN_MASK | SYSCON_FIFOCTRL_SPI1TXFIFOEN_MASK |         \
+     SYSCON_FIFOCTRL_U0RXFIFOEN_MASK | SYSCON_FIFOCTRL_U1RXFIFOEN_MASK | SYSCON_FIFOCTRL_U2RXFIFOEN_MASK |             \
+     SYSCON_FIFOCTRL_U3RXFIFOEN_MASK | SYSCON_FIFOCTRL_SPI0RXFIFOEN_MASK | SYSCON_FIFOCTRL_SPI1RXFIFOEN_MASK)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*!
+ * @brief Shares out the entries of a FIFO pool in proportion to the rates.
+ *
+ * @param rates Rates of the peripherals of the pool.
+ * @param sizes FIFO depth calculated for the peripherals of the pool.
+ * @param count Number of the peripherals of the pool.
+ * @param entries Entries of the pool.
+ */
+static status_t VFIFO_SplitPool(const uint32_t *rates, uint8_t *sizes, uint32_t count, uint32_t entries);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/*! @brief Pointers to the USART bases, whose cached FIFO configuration is updated. */
+static USART_Type *const s_vfifoUsartBases[] = USART_BASE_PTRS;
+
+/*! @brief Peak fill level of the FIFOs of each peripheral. */
+static vfifo_fill_t s_vfifoPeakFill[VFIFO_INSTANCE_COUNT];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static status_t VFIFO_SplitPool(const uint32_t *rates, uint8_t *sizes, uint32_t count, uint32_t entries)
+{
+    uint64_t remainder[VFIFO_INSTANCE_COUNT];
+    uint64_t sum    = 0U;
+    uint32_t active = 0U;
+    uint32_t given  = 0U;
+    uint32_t left;
+    uint32_t share;
+    uint32_t best;
+    uint32_t i;
+
+    for (i = 0U; i < count; i++)
+    {
+        sizes[i] = 0U;
+        if (0U != rates[i])
+        {
+            sum += rates[i];
+            active++;
+        }
+    }
+    if (0U == active)
+    {
+        return kStatus_Success;
+    }
+    if (active > entries)
+    {
+        return kStatus_OutOfRange;
+    }
+
+    /* Each active direction gets one entry, the rest is shared out by the largest remainder method. */
+    left = entries - active;
+    for (i = 0U; i < count; i++)
+    {
+        remainder[i] = 0U;
+        if (0U != rates[i])
+        {
+            share        = (uint32_t)(((uint64_t)rates[i] * left) / sum);
+            remainder[i] = ((uint64_t)rates[i] * left) % sum;
+            sizes[i]     = (uint8_t)(1U + share);
+            given += share;
+        }
+    }
+    for (; given < left; given++)
+    {
+        best = 0U;
+        for (i = 1U; i < count; i++)
+        {
+            if (remainder[i] > remainder[best])
+            {
+                best = i;
+            }
+        }
+        sizes[best]++;
+        remainder[best] = 0U;
+    }
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Calculates the FIFO depth of each peripheral from the throughput profiles.
+ *
+ * The USART receive, USART transmit, SPI receive and SPI transmit entries are separate pools. Each pool is shared
+ * out in proportion to the rates of the peripherals, each direction with a non zero rate gets one entry at least.
+ *
+ * param profile Array of VFIFO_INSTANCE_COUNT profiles, indexed by vfifo_instance_t.
+ * param partition Pointer to the partition calculated.
+ * retval kStatus_Success The partition is calculated.
+ * retval kStatus_OutOfRange A pool has more active directions than entries.
+ * retval kStatus_InvalidArgument One or more arguments are invalid.
+ */
+status_t VFIFO_CalculatePartition(const vfifo_profile_t *profile, vfifo_partition_t *partition)
+{
+    uint32_t rxRates[VFIFO_INSTANCE_COUNT];
+    uint32_t txRates[VFIFO_INSTANCE_COUNT];
+    status_t status;
+    uint32_t i;
+
+    /* Check arguments */
+    assert(!((NULL == profile) || (NULL == partition)));
+    if ((NULL == profile) || (NULL == partition))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    for (i = 0U; i < VFIFO_INSTANCE_COUNT; i++)
+    {
+        rxRates[i] = profile[i].rxRate;
+        txRates[i] = profile[i].txRate;
+    }
+
+    status = VFIFO_SplitPool(&rxRates[kVFIFO_Usart0], &partition->rxSize[kVFIFO_Usart0], FSL_FEATURE_SOC_USART_COUNT,
+                             FSL_FEATURE_VFIFO_USART_RX_TOTAL);
+    if (kStatus_Success == status)
+    {
+        status = VFIFO_SplitPool(&txRates[kVFIFO_Usart0], &partition->txSize[kVFIFO_Usart0],
+                                 FSL_FEATURE_SOC_USART_COUNT, FSL_FEATURE_VFIFO_USART_TX_TOTAL);
+    }
+    if (kStatus_Success == status)
+    {
+        status = VFIFO_SplitPool(&rxRates[kVFIFO_Spi0], &partition->rxSize[kVFIFO_Spi0], FSL_FEATURE_SOC_SPI_COUNT,
+                                 FSL_FEATURE_VFIFO_SPI_RX_TOTAL);
+    }
+    if (kStatus_Success == status)
+    {
+        status = VFIFO_SplitPool(&txRates[kVFIFO_Spi0], &partition->txSize[kVFIFO_Spi0], FSL_FEATURE_SOC_SPI_COUNT,
+                                 FSL_FEATURE_VFIFO_SPI_TX_TOTAL);
+    }
+
+    return status;
+}
+
+/*!
+ * brief Applies the FIFO depth of all the peripherals in one pass.
+ *
+ * The system FIFO is paused and flushed once, all the sizes are written and updated together, the FIFO of each
+ * peripheral is enabled in SYSCON if it has entries and disabled otherwise, and the thresholds beyond the new
+ * depths are lowered. The peak fill counters are reset.
+ *
+ * note It is applied once at boot, before the USART or SPI drivers are initialized. All the FIFOs are flushed, so the
+ * data in flight of a running peripheral would be lost, it fails if a FIFO is already enabled in SYSCON. The UART
+ * adapter keeps the entries of its instance, see HAL_UART_ADAPTER_FIFO_SIZE, and the FIFO configuration cached by the
+ * USART driver is updated.
+ *
+ * param partition Pointer to the partition to apply.
+ * retval kStatus_Success The partition is applied.
+ * retval kStatus_Fail A FIFO is already enabled, the partition is not applied.
+ * retval kStatus_OutOfRange The partition exceeds the entries of a pool.
+ * retval kStatus_InvalidArgument One or more arguments are invalid.
+ */
+status_t VFIFO_ApplyPartition(const vfifo_partition_t *partition)
+{
+    uint32_t usartRx = 0U, usartTx = 0U, spiRx = 0U, spiTx = 0U;
+    uint32_t enable = 0U;
+    uint32_t threshold;
+    uint32_t cfg;
+    uint32_t i;
+
+    /* Check arguments */
+    assert(NULL != partition);
+    if (NULL == partition)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    for (i = 0U; i < FSL_FEATURE_SOC_USART_COUNT; i++)
+    {
+        usartRx += partition->rxSize[kVFIFO_Usart0 + i];
+        usartTx += partition->txSize[kVFIFO_Usart0 + i];
+    }
+    for (i = 0U; i < FSL_FEATURE_SOC_SPI_COUNT; i++)
+    {
+        spiRx += partition->rxSize[kVFIFO_Spi0 + i];
+        spiTx += partition->txSize[kVFIFO_Spi0 + i];
+    }
+    if ((usartRx > FSL_FEATURE_VFIFO_USART_RX_TOTAL) || (usartTx > FSL_FEATURE_VFIFO_USART_TX_TOTAL) ||
+        (spiRx > FSL_FEATURE_VFIFO_SPI_RX_TOTAL) || (spiTx > FSL_FEATURE_VFIFO_SPI_TX_TOTAL))
+    {
+        return kStatus_OutOfRange;
+    }
+
+    /* The partition is only applied while no peripheral uses the system FIFO, the flush would drop its data. */
+    assert(0U == (SYSCON->FIFOCTRL & VFIFO_FIFOCTRL_ENABLE_MASK));
+    if (0U != (SYSCON->FIFOCTRL & VFIFO_FIFOCTRL_ENABLE_MASK))
+    {
+        return kStatus_Fail;
+    }
+
+#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
+    /* Enable the system FIFO clock. */
+    CLOCK_EnableClock(kCLOCK_Fifo);
+#endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
+
+    /* Pause the USART and SPI FIFOs for setting. */
+    while (!((VFIFO->FIFOCTLUSART & VFIFO_FIFOCTLUSART_RXPAUSED_MASK) &&
+             (VFIFO->FIFOCTLUSART & VFIFO_FIFOCTLUSART_TXPAUSED_MASK) &&
+             (VFIFO->FIFOCTLSPI & VFIFO_FIFOCTLSPI_RXPAUSED_MASK) &&
+             (VFIFO->FIFOCTLSPI & VFIFO_FIFOCTLSPI_TXPAUSED_MASK)))
+    {
+        VFIFO->FIFOCTLUSART |= (VFIFO_FIFOCTLUSART_RXPAUSE_MASK | VFIFO_FIFOCTLUSART_TXPAUSE_MASK);
+        VFIFO->FIFOCTLSPI |= (VFIFO_FIFOCTLSPI_RXPAUSE_MASK | VFIFO_FIFOCTLSPI_TXPAUSE_MASK);
+    }
+
+    for (i = 0U; i < FSL_FEATURE_SOC_USART_COUNT; i++)
+    {
+        /* Flush the TX and RX FIFO buffer. */
+        VFIFO->USART[i].CTLSETUSART |= VFIFO_USART_CTLSETUSART_TXFLUSH_MASK | VFIFO_USART_CTLSETUSART_RXFLUSH_MASK;
+        VFIFO->USART[i].CTLCLRUSART |=
+            VFIFO_USART_CTLCLRUSART_TXFLUSHCLR_MASK | VFIFO_USART_CTLCLRUSART_RXFLUSHCLR_MASK;
+        /* Set the TX and RX FIFO size. */
+        VFIFO->FIFOCFGUSART[i] = VFIFO_FIFOCFGUSART_RXSIZE(partition->rxSize[kVFIFO_Usart0 + i]) |
+                                 VFIFO_FIFOCFGUSART_TXSIZE(partition->txSize[kVFIFO_Usart0 + i]);
+        /* Keep the thresholds below the FIFO size. */
+        cfg       = VFIFO->USART[i].CFGUSART;
+        threshold = (cfg & VFIFO_USART_CFGUSART_RXTHRESHOLD_MASK) >> VFIFO_USART_CFGUSART_RXTHRESHOLD_SHIFT;
+        if ((0U != threshold) && (threshold >= partition->rxSize[kVFIFO_Usart0 + i]))
+        {
+            cfg = (cfg & ~VFIFO_USART_CFGUSART_RXTHRESHOLD_MASK) |
+                  VFIFO_USART_CFGUSART_RXTHRESHOLD((partition->rxSize[kVFIFO_Usart0 + i] > 0U) ?
+                                                       (partition->rxSize[kVFIFO_Usart0 + i] - 1U) :
+                                                       0U);
+        }
+        threshold = (cfg & VFIFO_USART_CFGUSART_TXTHRESHOLD_MASK) >> VFIFO_USART_CFGUSART_TXTHRESHOLD_SHIFT;
+        if ((0U != threshold) && (threshold >= partition->txSize[kVFIFO_Usart0 + i]))
+        {
+            cfg = (cfg & ~VFIFO_USART_CFGUSART_TXTHRESHOLD_MASK) |
+                  VFIFO_USART_CFGUSART_TXTHRESHOLD((partition->txSize[kVFIFO_Usart0 + i] > 0U) ?
+                                                       (partition->txSize[kVFIFO_Usart0 + i] - 1U) :
+                                                       0U);
+        }
+        VFIFO->USART[i].CFGUSART = cfg;
+        if (0U != partition->rxSize[kVFIFO_Usart0 + i])
+        {
+            enable |= SYSCON_FIFOCTRL_U0RXFIFOEN_MASK << i;
+        }
+        if (0U != partition->txSize[kVFIFO_Usart0 + i])
+        {
+            enable |= SYSCON_FIFOCTRL_U0TXFIFOEN_MASK << i;
+        }
+    }
+
+    for (i = 0U; i < FSL_FEATURE_SOC_SPI_COUNT; i++)
+    {
+        /* Flush the TX and RX FIFO buffer. */
+        VFIFO->SPI[i].CTLSETSPI |= VFIFO_SPI_CTLSETSPI_TXFLUSH_MASK | VFIFO_SPI_CTLSETSPI_RXFLUSH_MASK;
+        VFIFO->SPI[i].CTLCLRSPI |= VFIFO_SPI_CTLCLRSPI_TXFLUSHCLR_MASK | VFIFO_SPI_CTLCLRSPI_RXFLUSHCLR_MASK;
+        /* Set the TX and RX FIFO size. */
+        VFIFO->FIFOCFGSPI[i] = VFIFO_FIFOCFGSPI_RXSIZE(partition->rxSize[kVFIFO_Spi0 + i]) |
+                               VFIFO_FIFOCFGSPI_TXSIZE(partition->txSize[kVFIFO_Spi0 + i]);
+        /* Keep the thresholds below the FIFO size. */
+        cfg       = VFIFO->SPI[i].CFGSPI;
+        threshold = (cfg & VFIFO_SPI_CFGSPI_RXTHRESHOLD_MASK) >> VFIFO_SPI_CFGSPI_RXTHRESHOLD_SHIFT;
+        if ((0U != threshold) && (threshold >= partition->rxSize[kVFIFO_Spi0 + i]))
+        {
+            cfg = (cfg & ~VFIFO_SPI_CFGSPI_RXTHRESHOLD_MASK) |
+                  VFIFO_SPI_CFGSPI_RXTHRESHOLD((partition->rxSize[kVFIFO_Spi0 + i] > 0U) ?
+                                                   (partition->rxSize[kVFIFO_Spi0 + i] - 1U) :
+                                                   0U);
+        }
+        threshold = (cfg & VFIFO_SPI_CFGSPI_TXTHRESHOLD_MASK) >> VFIFO_SPI_CFGSPI_TXTHRESHOLD_SHIFT;
+        if ((0U != threshold) && (threshold >= partition->txSize[kVFIFO_Spi0 + i]))
+        {
+            cfg = (cfg & ~VFIFO_SPI_CFGSPI_TXTHRESHOLD_MASK) |
+                  VFIFO_SPI_CFGSPI_TXTHRESHOLD((partition->txSize[kVFIFO_Spi0 + i] > 0U) ?
+                                                   (partition->txSize[kVFIFO_Spi0 + i] - 1U) :
+                                                   0U);
+        }
+        VFIFO->SPI[i].CFGSPI = cfg;
+        if (0U != partition->rxSize[kVFIFO_Spi0 + i])
+        {
+            enable |= SYSCON_FIFOCTRL_SPI0RXFIFOEN_MASK << i;
+        }
+        if (0U != partition->txSize[kVFIFO_Spi0 + i])
+        {
+            enable |= SYSCON_FIFOCTRL_SPI0TXFIFOEN_MASK << i;
+        }
+    }
+
+    /* Update all the TX and RX fifo size at once. */
+    VFIFO->FIFOUPDATEUSART =
+        VFIFO_FIFOUPDATEUSART_USART0RXUPDATESIZE_MASK | VFIFO_FIFOUPDATEUSART_USART1RXUPDATESIZE_MASK |
+        VFIFO_FIFOUPDATEUSART_USART2RXUPDATESIZE_MASK | VFIFO_FIFOUPDATEUSART_USART3RXUPDATESIZE_MASK |
+        VFIFO_FIFOUPDATEUSART_USART0TXUPDATESIZE_MASK | VFIFO_FIFOUPDATEUSART_USART1TXUPDATESIZE_MASK |
+        VFIFO_FIFOUPDATEUSART_USART2TXUPDATESIZE_MASK | VFIFO_FIFOUPDATEUSART_USART3TXUPDATESIZE_MASK;
+    VFIFO->FIFOUPDATESPI = VFIFO_FIFOUPDATESPI_SPI0RXUPDATESIZE_MASK | VFIFO_FIFOUPDATESPI_SPI1RXUPDATESIZE_MASK |
+                           VFIFO_FIFOUPDATESPI_SPI0TXUPDATESIZE_MASK | VFIFO_FIFOUPDATESPI_SPI1TXUPDATESIZE_MASK;
+
+    /* Enable the TX/RX FIFO mode of the peripherals with entries. */
+    SYSCON->FIFOCTRL = (SYSCON->FIFOCTRL & ~VFIFO_FIFOCTRL_ENABLE_MASK) | enable;
+
+    /* Unpause the system FIFO for transfer. */
+    VFIFO->FIFOCTLUSART &= ~(VFIFO_FIFOCTLUSART_RXPAUSE_MASK | VFIFO_FIFOCTLUSART_TXPAUSE_MASK);
+    VFIFO->FIFOCTLSPI &= ~(VFIFO_FIFOCTLSPI_RXPAUSE_MASK | VFIFO_FIFOCTLSPI_TXPAUSE_MASK);
+
+    /* The USART driver caches the FIFO enables for its byte and blocking transfers. */
+    for (i = 0U; i < FSL_FEATURE_SOC_USART_COUNT; i++)
+    {
+        USART_UpdateFifoContext(s_vfifoUsartBases[i]);
+    }
+
+    VFIFO_ResetPeakFill();
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Gets the current fill level of the FIFOs of a peripheral.
+ *
+ * param instance Peripheral of the FIFOs.
+ * param fill Pointer to the fill level.
+ */
+void VFIFO_GetFill(vfifo_instance_t instance, vfifo_fill_t *fill)
+{
+    uint32_t status;
+    uint32_t txSize;
+    uint32_t txFree;
+
+    assert((uint32_t)instance < VFIFO_INSTANCE_COUNT);
+    assert(NULL != fill);
+
+    if ((uint32_t)instance < FSL_FEATURE_SOC_USART_COUNT)
+    {
+        status = VFIFO->USART[instance].STATUSART;
+        txSize = (VFIFO->FIFOCFGUSART[instance] & VFIFO_FIFOCFGUSART_TXSIZE_MASK) >> VFIFO_FIFOCFGUSART_TXSIZE_SHIFT;
+        fill->rxCount = (status & VFIFO_USART_STATUSART_RXCOUNT_MASK) >> VFIFO_USART_STATUSART_RXCOUNT_SHIFT;
+        txFree        = (status & VFIFO_USART_STATUSART_TXCOUNT_MASK) >> VFIFO_USART_STATUSART_TXCOUNT_SHIFT;
+    }
+    else
+    {
+        status = VFIFO->SPI[instance - kVFIFO_Spi0].STATSPI;
+        txSize = (VFIFO->FIFOCFGSPI[instance - kVFIFO_Spi0] & VFIFO_FIFOCFGSPI_TXSIZE_MASK) >>
+                 VFIFO_FIFOCFGSPI_TXSIZE_SHIFT;
+        fill->rxCount = (status & VFIFO_SPI_STATSPI_RXCOUNT_MASK) >> VFIFO_SPI_STATSPI_RXCOUNT_SHIFT;
+        txFree        = (status & VFIFO_SPI_STATSPI_TXCOUNT_MASK) >> VFIFO_SPI_STATSPI_TXCOUNT_SHIFT;
+    }
+    /* The TX count of the status is the number of free entries. */
+    fill->txCount = (txSize > txFree) ? (uint8_t)(txSize - txFree) : 0U;
+}
+
+/*!
+ * brief Samples the fill level of the FIFOs of a peripheral into its peak fill counters.
+ *
+ * It is cheap enough for the interrupt handler of the peripheral, see HAL_UART_ADAPTER_FIFO_TELEMETRY.
+ *
+ * param instance Peripheral of the FIFOs.
+ */
+void VFIFO_SamplePeripheralFill(vfifo_instance_t instance)
+{
+    vfifo_fill_t fill;
+
+    VFIFO_GetFill(instance, &fill);
+    if (fill.rxCount > s_vfifoPeakFill[instance].rxCount)
+    {
+        s_vfifoPeakFill[instance].rxCount = fill.rxCount;
+    }
+    if (fill.txCount > s_vfifoPeakFill[instance].txCount)
+    {
+        s_vfifoPeakFill[instance].txCount = fill.txCount;
+    }
+}
+
+/*!
+ * brief Samples the fill level of all the FIFOs into the peak fill counters.
+ *
+ * The FIFOs have no peak register, so the peaks are only as good as the sampling. It could be called from the
+ * interrupt handlers of the peripherals, where the FIFOs are at their fullest, or from a periodic timer.
+ */
+void VFIFO_SampleFill(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < VFIFO_INSTANCE_COUNT; i++)
+    {
+        VFIFO_SamplePeripheralFill((vfifo_instance_t)i);
+    }
+}
+
+/*!
+ * brief Gets the peak fill level of the FIFOs of a peripheral since the last reset.
+ *
+ * param instance Peripheral of the FIFOs.
+ * param peak Pointer to the peak fill level.
+ */
+void VFIFO_GetPeakFill(vfifo_instance_t instance, vfifo_fill_t *peak)
+{
+    assert((uint32_t)instance < VFIFO_INSTANCE_COUNT);
+    assert(NULL != peak);
+
+    *peak = s_vfifoPeakFill[instance];
+}
+
+/*!
+ * brief Resets the peak fill counters of all the peripherals.
+ */
+void VFIFO_ResetPeakFill(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < VFIFO_INSTANCE_COUNT; i++)
+    {
+        s_vfifoPeakFill[i].rxCount = 0U;
+        s_vfifoPeakFill[i].txCount = 0U;
+    }
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_VFIFO_H_
+#define _FSL_VFIFO_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup vfifo
+ * @{
+ */
+
+/*! @file */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @name Driver version */
+/*@{*/
+/*! @brief VFIFO driver version 2.0.0. */
+#define FSL_VFIFO_DRIVER_VERSION (MAKE_VERSION(2, 0, 0))
+/*@}*/
+
+/*! @brief Number of the peripherals sharing the system FIFO. */
+#define VFIFO_INSTANCE_COUNT (FSL_FEATURE_SOC_USART_COUNT + FSL_FEATURE_SOC_SPI_COUNT)
+
+/*! @brief Peripherals sharing the system FIFO. */
+typedef enum _vfifo_instance
+{
+    kVFIFO_Usart0 = 0U, /*!< USART0 */
+    kVFIFO_Usart1 = 1U, /*!< USART1 */
+    kVFIFO_Usart2 = 2U, /*!< USART2 */
+    kVFIFO_Usart3 = 3U, /*!< USART3 */
+    kVFIFO_Spi0   = 4U, /*!< SPI0 */
+    kVFIFO_Spi1   = 5U, /*!< SPI1 */
+} vfifo_instance_t;
+
+/*!
+ * @brief Throughput profile of a peripheral.
+ *
+ * The rates are only compared with the rates of the other peripherals sharing the same FIFO pool, so any unit
+ * could be used as long as it is the same for all. A direction with a zero rate gets no FIFO entry.
+ */
+typedef struct _vfifo_profile
+{
+    uint32_t rxRate; /*!< Expected receive rate, for example in bytes per second. */
+    uint32_t txRate; /*!< Expected transmit rate, for example in bytes per second. */
+} vfifo_profile_t;
+
+/*! @brief FIFO depth of each peripheral, in entries. */
+typedef struct _vfifo_partition
+{
+    uint8_t rxSize[VFIFO_INSTANCE_COUNT]; /*!< Receive FIFO depth, indexed by #vfifo_instance_t. */
+    uint8_t txSize[VFIFO_INSTANCE_COUNT]; /*!< Transmit FIFO depth, indexed by #vfifo_instance_t. */
+} vfifo_partition_t;
+
+/*! @brief Fill level of the FIFOs of a peripheral, in entries. */
+typedef struct _vfifo_fill
+{
+    uint8_t rxCount; /*!< Entries holding received data not read yet. */
+    uint8_t txCount; /*!< Entries holding data not transmitted yet. */
+} vfifo_fill_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* _cplusplus */
+
+/*!
+ * @name Partition
+ * @{
+ */
+
+/*!
+ * @brief Calculates the FIFO depth of each peripheral from the throughput profiles.
+ *
+ * The USART receive, USART transmit, SPI receive and SPI transmit entries are separate pools. Each pool is shared
+ * out in proportion to the rates of the peripherals, each direction with a non zero rate gets one entry at least.
+ *
+ * @param profile Array of #VFIFO_INSTANCE_COUNT profiles, indexed by #vfifo_instance_t.
+ * @param partition Pointer to the partition calculated.
+ * @retval kStatus_Success The partition is calculated.
+ * @retval kStatus_OutOfRange A pool has more active directions than entries.
+ * @retval kStatus_InvalidArgument One or more arguments are invalid.
+ */
+status_t VFIFO_CalculatePartition(const vfifo_profile_t *profile, vfifo_partition_t *partition);
+
+/*!
+ * @brief Applies the FIFO depth of all the peripherals in one pass.
+ *
+ * The system FIFO is paused and flushed once, all the sizes are written and updated together, the FIFO of each
+ * peripheral is enabled in SYSCON if it has entries and disabled otherwise, and the thresholds beyond the new
+ * depths are lowered. The peak fill counters are reset.
+ *
+ * @note It is applied once at boot, before the USART or SPI drivers are initialized. All the FIFOs are flushed, so
+ * the data in flight of a running peripheral would be lost, it fails if a FIFO is already enabled in SYSCON. The UART
+ * adapter keeps the entries of its instance, see HAL_UART_ADAPTER_FIFO_SIZE, and the FIFO configuration cached by the
+ * USART driver is updated.
+ *
+ * @param partition Pointer to the partition to apply.
+ * @retval kStatus_Success The partition is applied.
+ * @retval kStatus_Fail A FIFO is already enabled, the partition is not applied.
+ * @retval kStatus_OutOfRange The partition exceeds the entries of a pool.
+ * @retval kStatus_InvalidArgument One or more arguments are invalid.
+ */
+status_t VFIFO_ApplyPartition(const vfifo_partition_t *partition);
+
+/*! @} */
+
+/*!
+ * @name Telemetry
+ * @{
+ */
+
+/*!
+ * @brief Gets the current fill level of the FIFOs of a peripheral.
+ *
+ * @param instance Peripheral of the FIFOs.
+ * @param fill Pointer to the fill level.
+ */
+void VFIFO_GetFill(vfifo_instance_t instance, vfifo_fill_t *fill);
+
+/*!
+ * @brief Samples the fill level of the FIFOs of a peripheral into its peak fill counters.
+ * It is cheap enough for the interrupt handler of the peripheral, see HAL_UART_ADAPTER_FIFO_TELEMETRY.
+ * @param instance Peripheral of the FIFOs.
+ */
+void VFIFO_SamplePeripheralFill(vfifo_instance_t instance);
+
+/*!
+ * @brief Samples the fill level of all the FIFOs into the peak fill counters.
+ *
+ * The FIFOs have no peak register, so the peaks are only as good as the sampling. It could be called from the
+ * interrupt handlers of the peripherals, where the FIFOs are at their fullest, or from a periodic timer.
+ */
+void VFIFO_SampleFill(void);
+
+/*!
+ * @brief Gets the peak fill level of the FIFOs of a peripheral since the last reset.
+ *
+ * @param instance Peripheral of the FIFOs.
+ * @param peak Pointer to the peak fill level.
+ */
+void VFIFO_GetPeakFill(vfifo_instance_t instance, vfifo_fill_t *peak);
+
+/*!
+ * @brief Resets the peak fill counters of all the peripherals.
+ */
+void VFIFO_ResetPeakFill(void);
+
+/*! @} */
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_VFIFO_H_ */
@@ -0,0 +1,272 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_common.h"
+#include "fsl_debug_console.h"
+#include "fsl_gpio.h"
+#include "generic_list.h"
+#include "uart.h"
+#include "board.h"
+#include <string.h>
+
+#include "benchmark.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* The number of runs each measure is averaged over */
+#define BENCHMARK_RUN_COUNT (16U)
+
+/* The longest list of the insertion benchmark */
+#define BENCHMARK_LIST_MAX_LENGTH (256U)
+
+/* The interrupt benchmark runs on the internal loopback of a USART other than the debug console */
+#if (defined(UART_ADAPTER_NON_BLOCKING_MODE) && (UART_ADAPTER_NON_BLOCKING_MODE > 0U)) && \
+    !(defined(HAL_UART_TRANSFER_MODE) && (HAL_UART_TRANSFER_MODE > 0U)) &&                 \
+    !(defined(HAL_UART_DMA_ENABLE) && (HAL_UART_DMA_ENABLE > 0U))
+#define BENCHMARK_UART_ISR_ENABLE (1U)
+#else
+#define BENCHMARK_UART_ISR_ENABLE (0U)
+#endif
+
+/* The bus of the GPIO benchmark, its pins are not set as outputs so that nothing is driven */
+#define BENCHMARK_GPIO_BUS_PORT (1U)
+#define BENCHMARK_GPIO_BUS_FIRST_PIN (8U)
+#define BENCHMARK_GPIO_BUS_WIDTH (8U)
+/* The number of bytes written in each run of the GPIO benchmark */
+#define BENCHMARK_GPIO_BUS_WRITE_COUNT (256U)
+
+#define BENCHMARK_UART_INSTANCE (1U)
+#define BENCHMARK_UART_BASE USART1
+#define BENCHMARK_UART_IRQ USART1_IRQn
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static list_element_t s_benchmarkElement[BENCHMARK_LIST_MAX_LENGTH + 1U];
+
+#if (BENCHMARK_UART_ISR_ENABLE > 0U)
+static uint32_t s_benchmarkUartHandle[(HAL_UART_HANDLE_SIZE + sizeof(uint32_t) - 1U) / sizeof(uint32_t)];
+/* The cycle count at which the received byte is handed to the callback, 0 until then */
+static volatile uint32_t s_benchmarkUartStamp;
+#endif
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void BENCHMARK_StartCycleCounter(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+void BENCHMARK_ListInsert(void)
+{
+    static const uint32_t lengths[] = {0U, 16U, 64U, BENCHMARK_LIST_MAX_LENGTH};
+    list_element_handle_t element = &s_benchmarkElement[BENCHMARK_LIST_MAX_LENGTH];
+    list_label_t list;
+    uint32_t tailCycles;
+    uint32_t headCycles;
+    uint32_t start;
+
+    BENCHMARK_StartCycleCounter();
+
+    (void)PRINTF("List insertion, cycles with the IRQ masked:\r\n");
+    for (uint32_t i = 0U; i < ARRAY_SIZE(lengths); i++)
+    {
+        LIST_Init(&list, 0U);
+        for (uint32_t j = 0U; j < lengths[i]; j++)
+        {
+            (void)LIST_AddTail(&list, &s_benchmarkElement[j]);
+        }
+
+        tailCycles = 0U;
+        headCycles = 0U;
+        for (uint32_t run = 0U; run < BENCHMARK_RUN_COUNT; run++)
+        {
+            start = DWT->CYCCNT;
+            (void)LIST_AddTail(&list, element);
+            tailCycles += DWT->CYCCNT - start;
+            (void)LIST_RemoveElement(element);
+
+            start = DWT->CYCCNT;
+            (void)LIST_AddHead(&list, element);
+            headCycles += DWT->CYCCNT - start;
+            (void)LIST_RemoveElement(element);
+        }
+        (void)PRINTF("  length %4u: AddTail %5u, AddHead %5u\r\n", lengths[i], tailCycles / BENCHMARK_RUN_COUNT,
+                     headCycles / BENCHMARK_RUN_COUNT);
+
+        /* The elements are unlinked, so that they are not seen as duplicates in the next list. */
+        while (NULL != LIST_RemoveHead(&list))
+        {
+        }
+    }
+}
+
+static void BENCHMARK_PrintBusRate(const char *name, uint32_t cycles)
+{
+    uint32_t perWrite = cycles / (BENCHMARK_RUN_COUNT * BENCHMARK_GPIO_BUS_WRITE_COUNT);
+
+    (void)PRINTF("  %-22s %4u cycles, %6u kwrites/s\r\n", name, perWrite,
+                 (0U != perWrite) ? (CLOCK_GetCoreClkFreq() / perWrite / 1000U) : 0U);
+}
+
+void BENCHMARK_GpioBusWrite(void)
+{
+    static const gpio_bus_t contiguous =
+        GPIO_BUS_CONTIGUOUS(BENCHMARK_GPIO_BUS_PORT, BENCHMARK_GPIO_BUS_FIRST_PIN, BENCHMARK_GPIO_BUS_WIDTH);
+    /* The same pins in two runs with the nibbles swapped, as on a routed board */
+    static const uint8_t scatteredPins[BENCHMARK_GPIO_BUS_WIDTH] = {12U, 13U, 14U, 15U, 8U, 9U, 10U, 11U};
+    gpio_bus_t scattered;
+    uint32_t savedMask;
+    uint32_t cycles;
+    uint32_t start;
+
+    if (kStatus_Success != GPIO_BusInit(&scattered, BENCHMARK_GPIO_BUS_PORT, scatteredPins, BENCHMARK_GPIO_BUS_WIDTH))
+    {
+        return;
+    }
+
+    BENCHMARK_StartCycleCounter();
+
+    (void)PRINTF("GPIO bus, cycles per %u-bit write at %u Hz:\r\n", BENCHMARK_GPIO_BUS_WIDTH,
+                 CLOCK_GetCoreClkFreq());
+
+    start = DWT->CYCCNT;
+    for (uint32_t run = 0U; run < BENCHMARK_RUN_COUNT; run++)
+    {
+        for (uint32_t value = 0U; value < BENCHMARK_GPIO_BUS_WRITE_COUNT; value++)
+        {
+            for (uint32_t bit = 0U; bit < BENCHMARK_GPIO_BUS_WIDTH; bit++)
+            {
+                GPIO_PinWrite(GPIO, BENCHMARK_GPIO_BUS_PORT, BENCHMARK_GPIO_BUS_FIRST_PIN + bit,
+                              (uint8_t)((value >> bit) & 1U));
+            }
+        }
+    }
+    BENCHMARK_PrintBusRate("GPIO_PinWrite per pin", DWT->CYCCNT - start);
+
+    start = DWT->CYCCNT;
+    for (uint32_t run = 0U; run < BENCHMARK_RUN_COUNT; run++)
+    {
+        for (uint32_t value = 0U; value < BENCHMARK_GPIO_BUS_WRITE_COUNT; value++)
+        {
+            GPIO_BusWrite(GPIO, &contiguous, value);
+        }
+    }
+    BENCHMARK_PrintBusRate("GPIO_BusWrite", DWT->CYCCNT - start);
+
+    start = DWT->CYCCNT;
+    for (uint32_t run = 0U; run < BENCHMARK_RUN_COUNT; run++)
+    {
+        for (uint32_t value = 0U; value < BENCHMARK_GPIO_BUS_WRITE_COUNT; value++)
+        {
+            GPIO_BusWrite(GPIO, &scattered, value);
+        }
+    }
+    BENCHMARK_PrintBusRate("GPIO_BusWrite 2 runs", DWT->CYCCNT - start);
+
+    /* The port mask is shared with the other masked accesses, it is restored afterwards. */
+    savedMask = GPIO->MASK[BENCHMARK_GPIO_BUS_PORT];
+    GPIO_BusMaskedSet(GPIO, &contiguous);
+    start = DWT->CYCCNT;
+    for (uint32_t run = 0U; run < BENCHMARK_RUN_COUNT; run++)
+    {
+        for (uint32_t value = 0U; value < BENCHMARK_GPIO_BUS_WRITE_COUNT; value++)
+        {
+            GPIO_BusMaskedWrite(GPIO, &contiguous, value);
+        }
+    }
+    cycles                              = DWT->CYCCNT - start;
+    GPIO->MASK[BENCHMARK_GPIO_BUS_PORT] = savedMask;
+    BENCHMARK_PrintBusRate("GPIO_BusMaskedWrite", cycles);
+}
+
+#if (BENCHMARK_UART_ISR_ENABLE > 0U)
+static void BENCHMARK_UartCallback(hal_uart_handle_t handle, hal_uart_status_t status, void *userData)
+{
+    if (kStatus_HAL_UartRxIdle == status)
+    {
+        s_benchmarkUartStamp = DWT->CYCCNT;
+    }
+}
+
+void BENCHMARK_UartIsr(void)
+{
+    hal_uart_handle_t handle = (hal_uart_handle_t)&s_benchmarkUartHandle[0];
+    hal_uart_config_t config;
+    uint8_t txData = 0x55U;
+    uint8_t rxData;
+    uint32_t cycles;
+    uint32_t minCycles = UINT32_MAX;
+    uint32_t maxCycles = 0U;
+    uint32_t start;
+
+    (void)memset(&config, 0, sizeof(config));
+    config.srcClock_Hz  = BOARD_DEBUG_UART_CLK_FREQ;
+    config.baudRate_Bps = BOARD_DEBUG_UART_BAUDRATE;
+    config.parityMode   = kHAL_UartParityDisabled;
+    config.stopBitCount = kHAL_UartOneStopBit;
+    config.enableRx     = 1U;
+    config.enableTx     = 1U;
+    config.instance     = BENCHMARK_UART_INSTANCE;
+    if (kStatus_HAL_UartSuccess != HAL_UartInit(handle, &config))
+    {
+        (void)PRINTF("UART interrupt: USART%u could not be initialized\r\n", BENCHMARK_UART_INSTANCE);
+        return;
+    }
+    /* The transmitter is looped back to the receiver inside the USART, no pin is used. */
+    BENCHMARK_UART_BASE->CFG |= USART_CFG_LOOP_MASK;
+    (void)HAL_UartInstallCallback(handle, BENCHMARK_UartCallback, NULL);
+
+    BENCHMARK_StartCycleCounter();
+
+    for (uint32_t run = 0U; run < BENCHMARK_RUN_COUNT; run++)
+    {
+        /*
+         * The interrupt is held in the NVIC until the byte is received, so that the count starts from a pending
+         * interrupt rather than from the transmission.
+         */
+        (void)HAL_UartReceiveNonBlocking(handle, &rxData, 1U);
+        DisableIRQ(BENCHMARK_UART_IRQ);
+        (void)HAL_UartSendBlocking(handle, &txData, 1U);
+        while (0U == NVIC_GetPendingIRQ(BENCHMARK_UART_IRQ))
+        {
+        }
+
+        s_benchmarkUartStamp = 0U;
+        start                = DWT->CYCCNT;
+        (void)EnableIRQ(BENCHMARK_UART_IRQ);
+        while (0U == s_benchmarkUartStamp)
+        {
+        }
+        cycles    = s_benchmarkUartStamp - start;
+        minCycles = (cycles < minCycles) ? cycles : minCycles;
+        maxCycles = (cycles > maxCycles) ? cycles : maxCycles;
+    }
+
+    (void)HAL_UartDeinit(handle);
+
+    (void)PRINTF("UART interrupt, cycles from the pending interrupt to the byte stored: min %u, max %u\r\n",
+                 minCycles, maxCycles);
+}
+#endif
+
+void BENCHMARK_Run(void)
+{
+    BENCHMARK_ListInsert();
+    BENCHMARK_GpioBusWrite();
+#if (BENCHMARK_UART_ISR_ENABLE > 0U)
+    BENCHMARK_UartIsr();
+#endif
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _BENCHMARK_H_
+#define _BENCHMARK_H_
+
+#include "fsl_common.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Whether the DWT cycle count benchmarks are run at startup (1 - enable, 0 - disable). */
+#ifndef BENCHMARK_ENABLE
+#define BENCHMARK_ENABLE (0U)
+#endif
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Measures the cycles taken by LIST_AddTail and LIST_AddHead against the list length.
+ *
+ * The insertion masks the interrupts for all its length, so the cycles are the IRQ-masked time. It is constant
+ * by default, and grows with the list length if GENERIC_LIST_DUPLICATED_CHECKING is set.
+ */
+void BENCHMARK_ListInsert(void);
+
+/*!
+ * @brief Measures the rate of 8-bit writes to a GPIO bus, pin by pin and with the bus operations.
+ *
+ * The bus is on the pins 8 to 15 of port 1, written pin by pin with GPIO_PinWrite, with GPIO_BusWrite on the
+ * consecutive pins and on the same pins in two runs, and with GPIO_BusMaskedWrite. The pins are not set as
+ * outputs, so only the output latches change, which takes as many cycles.
+ */
+void BENCHMARK_GpioBusWrite(void);
+
+/*!
+ * @brief Measures the cycles from a pending USART interrupt to the received byte handed to the callback.
+ *
+ * USART1 is looped back internally and a byte is sent with its interrupt masked in the NVIC. Once the interrupt is
+ * pending, it is unmasked and the count runs until the receive callback, the exception entry, the adapter handler
+ * and the store of the byte included. It is run in the non-transactional non-blocking mode of the UART adapter
+ * without DMA, and shows the effect of HAL_UART_ISR_STATIC_BINDING.
+ */
+void BENCHMARK_UartIsr(void);
+
+/*!
+ * @brief Runs all the benchmarks and prints the results, once the debug console is initialized.
+ */
+void BENCHMARK_Run(void);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _BENCHMARK_H_ */
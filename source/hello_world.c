@@ -11,7 +11,11 @@
 #include "board.h"
 
 #include "pin_mux.h"
+#include "benchmark.h"
 #include <stdbool.h>
+#if (defined(BOOT_PROFILE_ENABLE) && (BOOT_PROFILE_ENABLE > 0U))
+#include "boot_profile.h"
+#endif
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
@@ -20,32 +24,93 @@
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
+static void APP_InitFullSpeed(void);
 
 /*******************************************************************************
  * Code
  ******************************************************************************/
+/* Initialization that needs the core on the PLL, the boot report covers the clock switch and the benchmark runs at
+ * 150 MHz. */
+static void APP_InitFullSpeed(void)
+{
+#if (defined(BOOT_PROFILE_ENABLE) && (BOOT_PROFILE_ENABLE > 0U))
+    BOOT_PROFILE_Report();
+#endif
+#if (defined(BENCHMARK_ENABLE) && (BENCHMARK_ENABLE > 0U))
+    BENCHMARK_Run();
+#endif
+}
+
+#if (defined(DEBUG_CONSOLE_RX_LOW_POWER) && (DEBUG_CONSOLE_RX_LOW_POWER > 0U))
+/* Enter deep sleep while waiting for the input, the start bit of the next character wakes up the MCU. */
+void DbgConsole_LowPowerIdle(void)
+{
+    BOARD_EnterDeepSleep();
+}
+#endif
+
 /*!
  * @brief Main function
  */
 int main(void)
 {
     char ch;
+#if (defined(BOARD_FAST_BOOT) && (BOARD_FAST_BOOT > 0U))
+    bool fullSpeed = false;
+#endif
+
+#if (defined(BOOT_PROFILE_ENABLE) && (BOOT_PROFILE_ENABLE > 0U))
+    BOOT_PROFILE_Mark(kBOOT_PROFILE_Main);
+#endif
 
     /* Init board hardware. */
     /* attach 12 MHz clock to USART0 (debug console) */
     CLOCK_AttachClk(BOARD_DEBUG_UART_CLK_ATTACH);
 
     BOARD_InitPins();
+#if (defined(BOARD_FAST_BOOT) && (BOARD_FAST_BOOT > 0U))
+    /* The PLL locks while the application is initialized from the IRC. */
+    BOARD_BootClockPLL150MStart();
+#else
     BOARD_BootClockPLL150M(); /* Rev B device can only support max core frequency to 96Mhz.
                                 Rev C device can support 150Mhz,use BOARD_BootClockPLL150M() to boot core to 150Mhz.
                                 DEVICE_ID1 register in SYSCON shows the device version.
                                 More details please refer to user manual and errata. */
+#endif
+#if (defined(BOOT_PROFILE_ENABLE) && (BOOT_PROFILE_ENABLE > 0U))
+    BOOT_PROFILE_Mark(kBOOT_PROFILE_ClockInit);
+#endif
+    /* The system FIFO is partitioned before the console takes its entries. */
+    BOARD_InitSystemFifo();
     BOARD_InitDebugConsole();
+#if (defined(BOOT_PROFILE_ENABLE) && (BOOT_PROFILE_ENABLE > 0U))
+    BOOT_PROFILE_Mark(kBOOT_PROFILE_ConsoleInit);
+#endif
 
+    /* Runs from the IRC in the fast boot, while the PLL locks. */
     PRINTF("hello world.\r\n");
 
+#if !(defined(BOARD_FAST_BOOT) && (BOARD_FAST_BOOT > 0U))
+    APP_InitFullSpeed();
+#endif
+
     while (1)
     {
+#if (defined(BOARD_FAST_BOOT) && (BOARD_FAST_BOOT > 0U))
+        if (!fullSpeed)
+        {
+            /* Poll the switch before the loop blocks in GETCHAR, until the PLL locks. */
+            if (!BOARD_BootClockPLL150MSwitch())
+            {
+                continue;
+            }
+#if (defined(BOOT_PROFILE_ENABLE) && (BOOT_PROFILE_ENABLE > 0U))
+            BOOT_PROFILE_Mark(kBOOT_PROFILE_ClockSwitch);
+#endif
+            fullSpeed = true;
+            APP_InitFullSpeed();
+        }
+#endif
         ch = GETCHAR();
         PUTCHAR(ch);
     }
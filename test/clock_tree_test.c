@@ -0,0 +1,166 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Test of the clock tree model. A valid 150 MHz configuration is described and checked, then each out of spec change
+ * of it should be reported by its own violation bit only.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fsl_clock_tree.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_CHECK(condition)                                                          \
+    do                                                                                 \
+    {                                                                                  \
+        if (!(condition))                                                              \
+        {                                                                              \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            exit(1);                                                                   \
+        }                                                                              \
+    } while (0)
+
+/* The register fields set by the test, as laid out in the LPC54102 user manual */
+#define TEST_PDRUNCFG_IRC_OSC (1U << 3U)
+#define TEST_PDRUNCFG_IRC (1U << 4U)
+#define TEST_PDRUNCFG_SYS_PLL (1U << 22U)
+#define TEST_MAINCLKSELB_PLL_OUT (2U)
+#define TEST_SYSPLLCLKSEL_IRC (0U)
+#define TEST_SYSPLLCLKSEL_CLKIN (1U)
+#define TEST_CLKOUTSELA_WDT_OSC (2U)
+#define TEST_ASYNCAPBCLKSELA_IRC (0U)
+#define TEST_ASYNCAPBCLKSELB_SELA (3U)
+#define TEST_FLASHCFG_FLASHTIM(cycles) (((uint32_t)(cycles)) << 12U)
+#define TEST_FRGCTRL_DIV (0xFFU)
+#define TEST_ASYNCAPBCLKCTRL_USART0 (1U << 1U)
+#define TEST_ASYNCAPBCLKCTRL_FRG0 (1U << 15U)
+
+#define TEST_CORE_CLOCK_HZ (150000000U)
+#define TEST_IRC_HZ (12000000U)
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* The IRC feeds the PLL at 150 MHz, which runs the core, and the asynchronous APB clock with the FRG. */
+static void TEST_GetValidRegs(clock_tree_regs_t *regs)
+{
+    (void)memset(regs, 0, sizeof(*regs));
+    regs->pdruncfg        = ~(TEST_PDRUNCFG_IRC_OSC | TEST_PDRUNCFG_IRC | TEST_PDRUNCFG_SYS_PLL);
+    regs->mainclkselb     = TEST_MAINCLKSELB_PLL_OUT;
+    regs->syspllclksel    = TEST_SYSPLLCLKSEL_IRC;
+    regs->syspllstat      = 1U;
+    regs->ahbclkdiv       = 1U;
+    regs->flashcfg        = TEST_FLASHCFG_FLASHTIM(kCLOCK_Flash7Cycle);
+    regs->asyncapbctrl    = 1U;
+    regs->asyncapbclksela = TEST_ASYNCAPBCLKSELA_IRC;
+    regs->asyncapbclkselb = TEST_ASYNCAPBCLKSELB_SELA;
+    regs->asyncclkdiv     = 1U;
+    regs->frgctrl         = TEST_FRGCTRL_DIV;
+    regs->asyncapbclkctrl = TEST_ASYNCAPBCLKCTRL_USART0 | TEST_ASYNCAPBCLKCTRL_FRG0;
+    regs->pllRate         = TEST_CORE_CLOCK_HZ;
+}
+
+static void TEST_ValidTree(void)
+{
+    clock_tree_regs_t regs;
+    clock_tree_info_t info;
+
+    TEST_GetValidRegs(&regs);
+    TEST_CHECK(0U == CLOCK_EvaluateClockTree(&regs, &info));
+    TEST_CHECK(0U == info.violations);
+    TEST_CHECK(TEST_CORE_CLOCK_HZ == info.clock[kCLOCK_MainClk].freq);
+    TEST_CHECK(TEST_CORE_CLOCK_HZ == info.clock[kCLOCK_CoreSysClk].freq);
+    TEST_CHECK(TEST_CORE_CLOCK_HZ == info.clock[kCLOCK_BusClk].freq);
+    TEST_CHECK(TEST_IRC_HZ == info.clock[kCLOCK_Irc].freq);
+    TEST_CHECK(0U == info.clock[kCLOCK_WdtOsc].freq);
+    TEST_CHECK(TEST_IRC_HZ == info.clock[kCLOCK_AsyncApbClk].freq);
+    TEST_CHECK(TEST_IRC_HZ == info.clock[kCLOCK_FRG].freq);
+    TEST_CHECK(0U == info.clock[kCLOCK_Adc].freq);
+    TEST_CHECK(kCLOCK_Flash7Cycle == info.flashCyclesRequired);
+
+    /* The FRG multiplier divides the asynchronous APB clock by (256 + MULT) / 256. */
+    regs.frgctrl = TEST_FRGCTRL_DIV | (128U << 8U);
+    TEST_CHECK(0U == CLOCK_EvaluateClockTree(&regs, &info));
+    TEST_CHECK(((uint64_t)TEST_IRC_HZ * 256U) / (256U + 128U) == info.clock[kCLOCK_FRG].freq);
+}
+
+static void TEST_FlashAccessCycles(void)
+{
+    TEST_CHECK(kCLOCK_Flash1Cycle == CLOCK_GetFLASHAccessCyclesForFreq(12000000U));
+    TEST_CHECK(kCLOCK_Flash2Cycle == CLOCK_GetFLASHAccessCyclesForFreq(12000001U));
+    TEST_CHECK(kCLOCK_Flash6Cycle == CLOCK_GetFLASHAccessCyclesForFreq(100000000U));
+    TEST_CHECK(kCLOCK_Flash7Cycle == CLOCK_GetFLASHAccessCyclesForFreq(TEST_CORE_CLOCK_HZ));
+}
+
+/* Each change breaks the valid tree in one way, only its violation bit should be reported. */
+static void TEST_Violations(void)
+{
+    clock_tree_regs_t regs;
+    clock_tree_info_t info;
+
+    TEST_GetValidRegs(&regs);
+    regs.ahbclkdiv = 0U;
+    TEST_CHECK((uint32_t)kCLOCK_TreeCoreClkStopped == CLOCK_EvaluateClockTree(&regs, &info));
+
+    TEST_GetValidRegs(&regs);
+    regs.pllRate = SDK_DEVICE_MAXIMUM_CPU_CLOCK_FREQUENCY + 1U;
+    TEST_CHECK((uint32_t)kCLOCK_TreeClkTooHigh == CLOCK_EvaluateClockTree(&regs, &info));
+
+    TEST_GetValidRegs(&regs);
+    regs.flashcfg = TEST_FLASHCFG_FLASHTIM(kCLOCK_Flash6Cycle);
+    TEST_CHECK((uint32_t)kCLOCK_TreeFlashTooFast == CLOCK_EvaluateClockTree(&regs, &info));
+
+    TEST_GetValidRegs(&regs);
+    regs.syspllstat = 0U;
+    TEST_CHECK((uint32_t)kCLOCK_TreePllNotLocked == CLOCK_EvaluateClockTree(&regs, &info));
+    TEST_GetValidRegs(&regs);
+    regs.pdruncfg |= TEST_PDRUNCFG_SYS_PLL;
+    TEST_CHECK((uint32_t)kCLOCK_TreePllNotLocked == CLOCK_EvaluateClockTree(&regs, &info));
+
+    TEST_GetValidRegs(&regs);
+    regs.syspllclksel = TEST_SYSPLLCLKSEL_CLKIN;
+    regs.extClkRate   = CLOCK_PLL_MIN_INPUT_FREQ - 1U;
+    TEST_CHECK((uint32_t)kCLOCK_TreePllInputTooLow == CLOCK_EvaluateClockTree(&regs, &info));
+
+    TEST_GetValidRegs(&regs);
+    regs.clkoutsela = TEST_CLKOUTSELA_WDT_OSC;
+    regs.clkoutdiv  = 1U;
+    TEST_CHECK((uint32_t)kCLOCK_TreeSourceStopped == CLOCK_EvaluateClockTree(&regs, &info));
+
+    TEST_GetValidRegs(&regs);
+    regs.asyncclkdiv = 0U;
+    TEST_CHECK((uint32_t)kCLOCK_TreeAsyncApbStopped == CLOCK_EvaluateClockTree(&regs, &info));
+
+    TEST_GetValidRegs(&regs);
+    regs.frgctrl = 0U;
+    TEST_CHECK((uint32_t)kCLOCK_TreeFrgDivInvalid == CLOCK_EvaluateClockTree(&regs, &info));
+    TEST_CHECK(0U == info.clock[kCLOCK_FRG].freq);
+
+    /* The violations are OR'ed. */
+    TEST_GetValidRegs(&regs);
+    regs.flashcfg = TEST_FLASHCFG_FLASHTIM(kCLOCK_Flash1Cycle);
+    regs.frgctrl  = 0U;
+    TEST_CHECK(((uint32_t)kCLOCK_TreeFlashTooFast | (uint32_t)kCLOCK_TreeFrgDivInvalid) ==
+               CLOCK_EvaluateClockTree(&regs, &info));
+    TEST_CHECK(info.violations == ((uint32_t)kCLOCK_TreeFlashTooFast | (uint32_t)kCLOCK_TreeFrgDivInvalid));
+}
+
+int main(void)
+{
+    TEST_ValidTree();
+    TEST_FlashAccessCycles();
+    TEST_Violations();
+    (void)printf("clock_tree_test passed\n");
+
+    return 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Test of the GPIO waveform encoders. The encoded words are played back on a model of the GPIO NOT register, the
+ * pin levels should follow the levels or the bit cells encoded.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fsl_gpio_wave_encode.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_CHECK(condition)                                                          \
+    do                                                                                 \
+    {                                                                                  \
+        if (!(condition))                                                              \
+        {                                                                              \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            exit(1);                                                                   \
+        }                                                                              \
+    } while (0)
+
+/* A WS2812 like cell of 4 steps on pin 5: 0 is high for 1 step, 1 is high for 3 steps */
+#define TEST_CELL_PIN_MASK (1U << 5U)
+#define TEST_CELL_ZERO_LEVELS (0x1U)
+#define TEST_CELL_ONE_LEVELS (0x7U)
+#define TEST_CELL_STEPS (4U)
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void TEST_EncodeLevels(void)
+{
+    static const uint32_t levels[] = {0x0000000FU, 0x000000F0U, 0x0000FFFFU, 0x0000FFFFU, 0x00000000U};
+    const uint32_t mask            = 0x000000FFU;
+    const uint32_t startLevels     = 0xFFFF0000U;
+    uint32_t words[ARRAY_SIZE(levels)];
+    uint32_t port = startLevels;
+
+    TEST_CHECK(kStatus_Success == GPIO_WaveEncode(mask, levels, words, ARRAY_SIZE(levels), startLevels));
+
+    for (uint32_t i = 0U; i < ARRAY_SIZE(levels); i++)
+    {
+        /* Only the waveform pins toggle, the other pins keep their levels. */
+        TEST_CHECK(0U == (words[i] & ~mask));
+        port ^= words[i];
+        TEST_CHECK((port & mask) == (levels[i] & mask));
+        TEST_CHECK((port & ~mask) == (startLevels & ~mask));
+    }
+    /* Two equal steps leave the pins as they are. */
+    TEST_CHECK(0U == words[3]);
+}
+
+static void TEST_EncodeLevelsInPlace(void)
+{
+    uint32_t words[] = {1U, 3U, 2U, 0U};
+
+    TEST_CHECK(kStatus_Success == GPIO_WaveEncode(0x3U, words, words, ARRAY_SIZE(words), 0U));
+    TEST_CHECK(1U == words[0]);
+    TEST_CHECK(2U == words[1]);
+    TEST_CHECK(1U == words[2]);
+    TEST_CHECK(2U == words[3]);
+}
+
+static void TEST_EncodeLevelsInvalid(void)
+{
+    uint32_t levels = 0U;
+    uint32_t words  = 0U;
+
+    TEST_CHECK(kStatus_InvalidArgument == GPIO_WaveEncode(1U, &levels, &words, 0U, 0U));
+}
+
+static void TEST_EncodeBits(void)
+{
+    static const gpio_wave_cell_t cell = {TEST_CELL_PIN_MASK, TEST_CELL_ZERO_LEVELS, TEST_CELL_ONE_LEVELS,
+                                          TEST_CELL_STEPS};
+    static const uint8_t data[]        = {0xA5U, 0x3CU};
+    const uint32_t bitCount            = 12U;
+    uint32_t words[12U * TEST_CELL_STEPS + 1U];
+    uint32_t port = 0U;
+    uint32_t pattern;
+    uint32_t index = 0U;
+
+    words[ARRAY_SIZE(words) - 1U] = 0xDEADBEEFU;
+    TEST_CHECK(kStatus_Success == GPIO_WaveEncodeBits(&cell, data, bitCount, words, ARRAY_SIZE(words) - 1U));
+
+    for (uint32_t bit = 0U; bit < bitCount; bit++)
+    {
+        /* The bits are played the most significant bit of each byte first. */
+        pattern = (0U != (data[bit / 8U] & (0x80U >> (bit % 8U)))) ? TEST_CELL_ONE_LEVELS : TEST_CELL_ZERO_LEVELS;
+        for (uint32_t step = 0U; step < TEST_CELL_STEPS; step++)
+        {
+            TEST_CHECK(0U == (words[index] & ~TEST_CELL_PIN_MASK));
+            port ^= words[index];
+            index++;
+            TEST_CHECK(((port & TEST_CELL_PIN_MASK) != 0U) == (((pattern >> step) & 1U) != 0U));
+        }
+    }
+    /* The words beyond the bits encoded are not written. */
+    TEST_CHECK(0xDEADBEEFU == words[ARRAY_SIZE(words) - 1U]);
+}
+
+static void TEST_EncodeBitsInvalid(void)
+{
+    gpio_wave_cell_t cell = {TEST_CELL_PIN_MASK, TEST_CELL_ZERO_LEVELS, TEST_CELL_ONE_LEVELS, TEST_CELL_STEPS};
+    const uint8_t data    = 0xFFU;
+    uint32_t words[8U * TEST_CELL_STEPS];
+
+    TEST_CHECK(kStatus_OutOfRange == GPIO_WaveEncodeBits(&cell, &data, 8U, words, ARRAY_SIZE(words) - 1U));
+    TEST_CHECK(kStatus_InvalidArgument == GPIO_WaveEncodeBits(&cell, &data, 0U, words, ARRAY_SIZE(words)));
+
+    cell.steps = 0U;
+    TEST_CHECK(kStatus_InvalidArgument == GPIO_WaveEncodeBits(&cell, &data, 8U, words, ARRAY_SIZE(words)));
+    cell.steps = 33U;
+    TEST_CHECK(kStatus_InvalidArgument == GPIO_WaveEncodeBits(&cell, &data, 8U, words, ARRAY_SIZE(words)));
+    cell.steps   = TEST_CELL_STEPS;
+    cell.pinMask = 0U;
+    TEST_CHECK(kStatus_InvalidArgument == GPIO_WaveEncodeBits(&cell, &data, 8U, words, ARRAY_SIZE(words)));
+}
+
+int main(void)
+{
+    TEST_EncodeLevels();
+    TEST_EncodeLevelsInPlace();
+    TEST_EncodeLevelsInvalid();
+    TEST_EncodeBits();
+    TEST_EncodeBitsInvalid();
+    (void)printf("gpio_wave_test passed\n");
+
+    return 0;
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_COMMON_H_
+#define _FSL_COMMON_H_
+
+/*
+ * Host stand-in of drivers/fsl_common.h for the host tests. It only provides the status codes and helpers used by
+ * the pure driver sources built on the host, the values are the same as in drivers/fsl_common.h. The device headers
+ * and the peripheral drivers are not available on the host.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define MAKE_STATUS(group, code) ((((group)*100) + (code)))
+
+#define MAKE_VERSION(major, minor, bugfix) (((major) << 16) | ((minor) << 8) | (bugfix))
+
+#define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
+
+enum _status_groups
+{
+    kStatusGroup_Generic = 0,
+};
+
+enum _generic_status
+{
+    kStatus_Success              = MAKE_STATUS(kStatusGroup_Generic, 0),
+    kStatus_Fail                 = MAKE_STATUS(kStatusGroup_Generic, 1),
+    kStatus_ReadOnly             = MAKE_STATUS(kStatusGroup_Generic, 2),
+    kStatus_OutOfRange           = MAKE_STATUS(kStatusGroup_Generic, 3),
+    kStatus_InvalidArgument      = MAKE_STATUS(kStatusGroup_Generic, 4),
+    kStatus_Timeout              = MAKE_STATUS(kStatusGroup_Generic, 5),
+    kStatus_NoTransferInProgress = MAKE_STATUS(kStatusGroup_Generic, 6),
+};
+
+typedef int32_t status_t;
+
+#endif /* _FSL_COMMON_H_ */
@@ -0,0 +1,146 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Stress test of the MPSC queue on the host atomics. Several producer threads push their elements while a single
+ * consumer pops them, every element should be taken once, and the elements of a producer in pushing order.
+ */
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "mpsc_queue.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_PRODUCER_COUNT (4U)
+#define TEST_ELEMENT_COUNT (200000U) /* per producer */
+
+#define TEST_CHECK(condition)                                                          \
+    do                                                                                 \
+    {                                                                                  \
+        if (!(condition))                                                              \
+        {                                                                              \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            exit(1);                                                                   \
+        }                                                                              \
+    } while (0)
+
+typedef struct _test_element
+{
+    mpsc_queue_element_t link; /* it should be the first member */
+    uint32_t producer;
+    uint32_t sequence;
+} test_element_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static mpsc_queue_label_t s_queue;
+static test_element_t *s_elements[TEST_PRODUCER_COUNT];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void *TEST_Producer(void *param)
+{
+    uint32_t producer = (uint32_t)(uintptr_t)param;
+
+    for (uint32_t i = 0U; i < TEST_ELEMENT_COUNT; i++)
+    {
+        MPSC_QUEUE_Push(&s_queue, &s_elements[producer][i].link);
+    }
+
+    return NULL;
+}
+
+static void TEST_PushPopOrder(void)
+{
+    test_element_t elements[3];
+
+    MPSC_QUEUE_Init(&s_queue);
+    TEST_CHECK(MPSC_QUEUE_IsEmpty(&s_queue));
+    TEST_CHECK(NULL == MPSC_QUEUE_Pop(&s_queue));
+
+    for (uint32_t i = 0U; i < 3U; i++)
+    {
+        MPSC_QUEUE_Push(&s_queue, &elements[i].link);
+    }
+    TEST_CHECK(!MPSC_QUEUE_IsEmpty(&s_queue));
+    TEST_CHECK(&elements[0].link == MPSC_QUEUE_GetHead(&s_queue));
+    TEST_CHECK(&elements[0].link == MPSC_QUEUE_Pop(&s_queue));
+
+    /* An element pushed while the consumer chain is not empty is taken after it. */
+    MPSC_QUEUE_Push(&s_queue, &elements[0].link);
+    TEST_CHECK(&elements[1].link == MPSC_QUEUE_Pop(&s_queue));
+    TEST_CHECK(&elements[2].link == MPSC_QUEUE_Pop(&s_queue));
+    TEST_CHECK(&elements[0].link == MPSC_QUEUE_Pop(&s_queue));
+    TEST_CHECK(NULL == MPSC_QUEUE_Pop(&s_queue));
+    TEST_CHECK(MPSC_QUEUE_IsEmpty(&s_queue));
+}
+
+static void TEST_Stress(void)
+{
+    pthread_t threads[TEST_PRODUCER_COUNT];
+    uint32_t nextSequence[TEST_PRODUCER_COUNT] = {0U};
+    uint32_t received = 0U;
+    mpsc_queue_element_handle_t link;
+    test_element_t *element;
+
+    MPSC_QUEUE_Init(&s_queue);
+    for (uint32_t p = 0U; p < TEST_PRODUCER_COUNT; p++)
+    {
+        s_elements[p] = calloc(TEST_ELEMENT_COUNT, sizeof(test_element_t));
+        TEST_CHECK(NULL != s_elements[p]);
+        for (uint32_t i = 0U; i < TEST_ELEMENT_COUNT; i++)
+        {
+            s_elements[p][i].producer = p;
+            s_elements[p][i].sequence = i;
+        }
+    }
+    for (uint32_t p = 0U; p < TEST_PRODUCER_COUNT; p++)
+    {
+        TEST_CHECK(0 == pthread_create(&threads[p], NULL, TEST_Producer, (void *)(uintptr_t)p));
+    }
+
+    /* The consumer runs concurrently with the producers. */
+    while (received < (TEST_PRODUCER_COUNT * TEST_ELEMENT_COUNT))
+    {
+        link = MPSC_QUEUE_Pop(&s_queue);
+        if (NULL == link)
+        {
+            continue;
+        }
+        element = (test_element_t *)(void *)link;
+        TEST_CHECK(element->producer < TEST_PRODUCER_COUNT);
+        TEST_CHECK(element->sequence == nextSequence[element->producer]);
+        nextSequence[element->producer]++;
+        received++;
+    }
+
+    for (uint32_t p = 0U; p < TEST_PRODUCER_COUNT; p++)
+    {
+        TEST_CHECK(0 == pthread_join(threads[p], NULL));
+        TEST_CHECK(TEST_ELEMENT_COUNT == nextSequence[p]);
+        free(s_elements[p]);
+    }
+    TEST_CHECK(NULL == MPSC_QUEUE_Pop(&s_queue));
+    TEST_CHECK(MPSC_QUEUE_IsEmpty(&s_queue));
+}
+
+int main(void)
+{
+    TEST_PushPopOrder();
+    TEST_Stress();
+    (void)printf("mpsc_queue_test passed\n");
+
+    return 0;
+}
@@ -0,0 +1,304 @@
+#!/usr/bin/env python3
+#
+# Copyright 2019 NXP
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Generates a table of precomputed System PLL setups, applied with CLOCK_SetPLLFreqFromTable().
+#
+# The setups are computed the way CLOCK_SetupPLLData() computes them at run time, including the actual PLL rate
+# given by CLOCK_GetSystemPLLOutFromSetup(), so retargeting the PLL from the table needs no search.
+#
+# Usage: pll_table_gen.py [--flags FLAG,...] [--output BASENAME] INPUT_HZ:OUTPUT_HZ[:ss][:div2] ...
+#   ss     Use the spread spectrum (fractional) mode, PLL_CONFIGFLAG_FORCENOFRACT not set.
+#   div2   Use the feedback divider by 2, PLL_SETUPFLAG_USEFEEDBACKDIV2.
+# Example: pll_table_gen.py 12000000:48000000 12000000:96000000 12000000:150000000
+
+import argparse
+import math
+import os
+import sys
+import textwrap
+
+# Constants of drivers/fsl_clock.c
+NVALMAX = 0x100
+PVALMAX = 0x20
+MVALMAX = 0x8000
+PLL_MAX_N_DIV = 0x100
+PLL_MIN_CCO_FREQ_MHZ = 75000000
+PLL_MAX_CCO_FREQ_MHZ = 150000000
+PLL_LOWER_IN_LIMIT = 4000
+PLL_MIN_IN_SSMODE = 2000000
+PLL_MAX_IN_SSMODE = 4000000
+
+# SYSCON register fields of device/LPC54102_cm4.h
+SYSPLLCTRL_SELR_SHIFT = 0
+SYSPLLCTRL_SELI_SHIFT = 4
+SYSPLLCTRL_SELP_SHIFT = 10
+SYSPLLCTRL_BYPASSCCODIV2_SHIFT = 16
+SYSPLLCTRL_UPLIMOFF_SHIFT = 17
+SYSPLLCTRL_BANDSEL_SHIFT = 18
+SYSPLLCTRL_DIRECTI_SHIFT = 19
+SYSPLLCTRL_DIRECTO_SHIFT = 20
+SYSPLLSSCTRL0_SEL_EXT_SHIFT = 18
+SYSPLLSSCTRL1_PD_SHIFT = 28
+SSCG1_MD_FRACT_MASK = 0x7FF
+SSCG1_MD_INT_SHIFT = 11
+SSCG1_MD_INT_MASK = 0xFF << SSCG1_MD_INT_SHIFT
+
+SETUP_FLAGS = ('POWERUP', 'WAITLOCK', 'ADGVOLT')
+
+
+class PllError(Exception):
+    pass
+
+
+def encode_n(n):
+    if n == 0:
+        return 0x3FF
+    if n == 1:
+        return 0x302
+    if n == 2:
+        return 0x202
+    x = 0x080
+    for _ in range(n, NVALMAX + 1):
+        x = (((x ^ (x >> 2) ^ (x >> 3) ^ (x >> 4)) & 1) << 7) | ((x >> 1) & 0x7F)
+    return x & 0x3FF
+
+
+def encode_p(p):
+    if p == 0:
+        return 0x7F
+    if p == 1:
+        return 0x62
+    if p == 2:
+        return 0x42
+    x = 0x10
+    for _ in range(p, PVALMAX + 1):
+        x = (((x ^ (x >> 2)) & 1) << 4) | ((x >> 1) & 0xF)
+    return x & 0x7F
+
+
+def encode_m(m):
+    if m == 0:
+        return 0x1FFFF
+    if m == 1:
+        return 0x18003
+    if m == 2:
+        return 0x10003
+    x = 0x04000
+    for _ in range(m, MVALMAX + 1):
+        x = (((x ^ (x >> 1)) & 1) << 14) | ((x >> 1) & 0x3FFF)
+    return x & 0x1FFFF
+
+
+def find_sel(m):
+    selp = (m >> 1) + 1 if m < 60 else PVALMAX - 1
+    if m > 16384:
+        seli = 1
+    elif m > 8192:
+        seli = 2
+    elif m > 2048:
+        seli = 4
+    elif m >= 501:
+        seli = 8
+    elif m >= 60:
+        seli = 4 * (1024 // (m + 9))
+    else:
+        seli = (m & 0x3C) + 4
+    return selp, min(seli, 0x3F), 0
+
+
+def pll_config(fin, fout, use_div2, use_ss):
+    """Mirrors CLOCK_GetPllConfigInternal(), returns the register values and the divider values."""
+    pre_div = 1
+    post_div = 0
+    direct_out = 1
+    bypass_div2 = 0 if use_div2 else 1
+    mult_div = 2 - bypass_div2
+
+    if fout > PLL_MAX_CCO_FREQ_MHZ:
+        raise PllError('output rate too high')
+    if fout < PLL_MIN_CCO_FREQ_MHZ // (PVALMAX << 1):
+        raise PllError('output rate too low')
+    if use_ss:
+        if fin < PLL_MIN_IN_SSMODE:
+            raise PllError('input rate too low')
+        pre_div = fin // ((PLL_MIN_IN_SSMODE + PLL_MAX_IN_SSMODE) // 2)
+        if pre_div > NVALMAX:
+            raise PllError('input rate too high')
+        if pre_div == 0:
+            raise PllError('input rate too low for the spread spectrum pre-divider')
+    elif fin < PLL_LOWER_IN_LIMIT:
+        raise PllError('input rate too low')
+
+    fcco = fout
+    while fcco < PLL_MIN_CCO_FREQ_MHZ:
+        post_div += 1
+        if post_div > PVALMAX:
+            raise PllError('output rate outside the integer limits')
+        fcco = fout * (post_div * 2)
+        direct_out = 0
+
+    if (fin > PLL_LOWER_IN_LIMIT) and (fcco >= fin) and not use_ss:
+        a = math.gcd(fcco, mult_div * fin)
+        if a > 20000:
+            a = (mult_div * fin) // a
+            if (a != 0) and (a < PLL_MAX_N_DIV):
+                pre_div = a
+
+    direct_in = 0 if pre_div > 1 else 1
+    n_div_out = fin // pre_div
+    mult = (fcco // n_div_out) // mult_div
+
+    if not use_ss:
+        if (n_div_out * ((mult_div * mult * 2) + 1)) < (fcco * 2):
+            mult += 1
+        selp, seli, selr = find_sel(mult)
+        bandsel = 1
+        uplimoff = 0
+        ssctrl0 = encode_m(mult) | (1 << SYSPLLSSCTRL0_SEL_EXT_SHIFT)
+        ssctrl1 = 1 << SYSPLLSSCTRL1_PD_SHIFT
+    else:
+        selp = seli = selr = 0
+        bandsel = 0
+        uplimoff = 1
+        fract = ((fcco % (mult_div * n_div_out)) << 11) // (mult_div * n_div_out)
+        ssctrl0 = 0
+        ssctrl1 = ((mult << SSCG1_MD_INT_SHIFT) & SSCG1_MD_INT_MASK) | (fract & SSCG1_MD_FRACT_MASK)
+
+    ctrl = ((selr << SYSPLLCTRL_SELR_SHIFT) | (seli << SYSPLLCTRL_SELI_SHIFT) | (selp << SYSPLLCTRL_SELP_SHIFT) |
+            (bypass_div2 << SYSPLLCTRL_BYPASSCCODIV2_SHIFT) | (uplimoff << SYSPLLCTRL_UPLIMOFF_SHIFT) |
+            (bandsel << SYSPLLCTRL_BANDSEL_SHIFT) | (direct_in << SYSPLLCTRL_DIRECTI_SHIFT) |
+            (direct_out << SYSPLLCTRL_DIRECTO_SHIFT))
+
+    return {
+        'syspllctrl': ctrl,
+        'syspllndec': encode_n(pre_div),
+        'syspllpdec': encode_p(post_div),
+        'syspllssctrl': (ssctrl0, ssctrl1),
+        'preDiv': pre_div,
+        'postDiv': post_div,
+        'mult': mult,
+    }
+
+
+def pll_rate(fin, setup):
+    """Mirrors CLOCK_GetSystemPLLOutFromSetup() for a setup built by pll_config()."""
+    ctrl = setup['syspllctrl']
+    ssctrl1 = setup['syspllssctrl'][1]
+
+    in_rate = fin
+    if (ctrl & (1 << SYSPLLCTRL_DIRECTI_SHIFT)) == 0:
+        in_rate //= max(setup['preDiv'], 1)
+
+    if ssctrl1 & (1 << SYSPLLSSCTRL1_PD_SHIFT):
+        mult = setup['mult']
+        if (ctrl & (1 << SYSPLLCTRL_BYPASSCCODIV2_SHIFT)) == 0:
+            mult <<= 1
+        rate = in_rate * max(mult, 1)
+    else:
+        mult = (ssctrl1 & SSCG1_MD_INT_MASK) >> SSCG1_MD_INT_SHIFT
+        fract = ssctrl1 & SSCG1_MD_FRACT_MASK
+        rate = in_rate * mult + (in_rate * fract) // 0x800
+
+    if (ctrl & (1 << SYSPLLCTRL_DIRECTO_SHIFT)) == 0:
+        rate //= (2 * setup['postDiv']) if setup['postDiv'] != 0 else 2
+
+    return rate & 0xFFFFFFFF
+
+
+def rate_name(hz):
+    if hz % 1000000 == 0:
+        return '%dM' % (hz // 1000000)
+    if hz % 1000 == 0:
+        return '%dK' % (hz // 1000)
+    return '%d' % hz
+
+
+def parse_entry(text):
+    fields = text.split(':')
+    if len(fields) < 2:
+        raise argparse.ArgumentTypeError('expected INPUT_HZ:OUTPUT_HZ[:ss][:div2], got %s' % text)
+    options = set(fields[2:])
+    if not options <= {'ss', 'div2'}:
+        raise argparse.ArgumentTypeError('unknown option in %s' % text)
+    return int(fields[0], 0), int(fields[1], 0), 'div2' in options, 'ss' in options
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate precomputed System PLL setups.')
+    parser.add_argument('--flags', default='WAITLOCK',
+                        help='PLL_SETUPFLAG_* of the setups, comma separated, default WAITLOCK')
+    parser.add_argument('--output', default=os.path.join(os.path.dirname(__file__), '..', 'board', 'clock_pll_table'),
+                        help='base name of the generated .c and .h files')
+    parser.add_argument('entries', nargs='+', type=parse_entry, metavar='INPUT_HZ:OUTPUT_HZ[:ss][:div2]')
+    args = parser.parse_args()
+
+    flags = [f for f in args.flags.split(',') if f]
+    for flag in flags:
+        if flag not in SETUP_FLAGS:
+            parser.error('unknown flag %s' % flag)
+
+    rows = []
+    for fin, fout, use_div2, use_ss in args.entries:
+        try:
+            setup = pll_config(fin, fout, use_div2, use_ss)
+        except PllError as e:
+            parser.error('%d Hz to %d Hz: %s' % (fin, fout, e))
+        name = 'kCLOCK_PllSetup%sTo%s%s%s' % (rate_name(fin), rate_name(fout), 'Ss' if use_ss else '',
+                                              'Div2' if use_div2 else '')
+        rows.append((name, fin, fout, use_div2, use_ss, setup, pll_rate(fin, setup)))
+
+    setup_flags = [('PLL_SETUPFLAG_' + f) for f in flags]
+    if any(r[3] for r in rows):
+        setup_flags.append('PLL_SETUPFLAG_USEFEEDBACKDIV2')
+    command = textwrap.wrap(' '.join(['pll_table_gen.py'] + sys.argv[1:]), 112, break_on_hyphens=False)
+    banner = ('/*\n * Copyright 2019 NXP\n * All rights reserved.\n *\n * SPDX-License-Identifier: BSD-3-Clause\n *\n'
+              ' * Generated by tools/pll_table_gen.py, do not edit. Command line:\n' +
+              ''.join([(' *   %s\n' % line) for line in command]) + ' */\n\n')
+    width = max([len(r[0]) for r in rows] + [len('kCLOCK_PllSetupCount')])
+    guard = '_' + os.path.basename(args.output).upper() + '_H_'
+    header = os.path.basename(args.output) + '.h'
+
+    with open(args.output + '.h', 'w', newline='\n') as h:
+        h.write(banner)
+        h.write('#ifndef %s\n#define %s\n\n#include "fsl_clock.h"\n\n' % (guard, guard))
+        h.write('/*! @brief Indexes of the precomputed System PLL setups of g_clockPllSetupTable */\n')
+        h.write('typedef enum _clock_pll_setup_index\n{\n')
+        for i, row in enumerate(rows):
+            h.write('    %-*s = %dU, /*!< %d Hz to %d Hz */\n' % (width, row[0], i, row[1], row[6]))
+        h.write('    %-*s = %dU, /*!< Number of setups */\n} clock_pll_setup_index_t;\n\n' %
+                (width, 'kCLOCK_PllSetupCount', len(rows)))
+        h.write('/*! @brief Precomputed System PLL setups, applied with CLOCK_SetPLLFreqFromTable() */\n')
+        h.write('extern const pll_setup_entry_t g_clockPllSetupTable[kCLOCK_PllSetupCount];\n\n')
+        h.write('#endif /* %s */\n' % guard)
+
+    with open(args.output + '.c', 'w', newline='\n') as c:
+        c.write(banner)
+        c.write('#include "%s"\n\n' % header)
+        c.write('const pll_setup_entry_t g_clockPllSetupTable[kCLOCK_PllSetupCount] = {\n')
+        for name, fin, fout, use_div2, use_ss, setup, rate in rows:
+            entry_flags = [f for f in setup_flags if (f != 'PLL_SETUPFLAG_USEFEEDBACKDIV2') or use_div2]
+            flags_text = ' | '.join(entry_flags) or '0U'
+            c.write('    /* %s: %d Hz to %d Hz, %s mode, M = %d, N = %d, P = %d */\n' %
+                    (name, fin, fout, 'spread spectrum' if use_ss else 'integer', setup['mult'], setup['preDiv'],
+                     setup['postDiv']))
+            c.write('    [%s] =\n        {\n' % name)
+            c.write('            .inputRate = %dU,\n' % fin)
+            c.write('            .setup =\n                {\n')
+            c.write('                    .syspllctrl   = 0x%08XU,\n' % setup['syspllctrl'])
+            c.write('                    .syspllndec   = 0x%03XU,\n' % setup['syspllndec'])
+            c.write('                    .syspllpdec   = 0x%02XU,\n' % setup['syspllpdec'])
+            c.write('                    .syspllssctrl = {0x%08XU, 0x%08XU},\n' % setup['syspllssctrl'])
+            c.write('                    .pllRate      = %dU,\n' % rate)
+            c.write('                    .flags        = %s,\n' % flags_text)
+            c.write('                },\n        },\n')
+        c.write('};\n')
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -52,6 +52,9 @@
 
 #include "fsl_common.h"
 #include "serial_manager.h"
+#if (defined(DEBUG_CONSOLE_IDLE_VETO_ENABLE) && (DEBUG_CONSOLE_IDLE_VETO_ENABLE > 0U))
+#include "idle.h"
+#endif
 
 #include "fsl_debug_console.h"
 
@@ -149,6 +152,13 @@ static volatile uint8_t s_debugConsoleReadWaitSemaphore;
 
 #define DEBUG_CONSOLE_CREATE_BINARY_SEMAPHORE(binary)
 #ifdef DEBUG_CONSOLE_TRANSFER_NON_BLOCKING
+#if (defined(DEBUG_CONSOLE_RX_LOW_POWER) && (DEBUG_CONSOLE_RX_LOW_POWER > 0U))
+#define DEBUG_CONSOLE_TAKE_BINARY_SEMAPHORE_BLOCKING(binary) \
+    {                                                        \
+        DbgConsole_WaitLowpower(&binary);                    \
+        binary = false;                                      \
+    }
+#else
 #define DEBUG_CONSOLE_TAKE_BINARY_SEMAPHORE_BLOCKING(binary) \
     {                                                        \
         while (!binary)                                      \
@@ -156,6 +166,7 @@ static volatile uint8_t s_debugConsoleReadWaitSemaphore;
         }                                                    \
         binary = false;                                      \
     }
+#endif /* DEBUG_CONSOLE_RX_LOW_POWER */
 #define DEBUG_CONSOLE_GIVE_BINARY_SEMAPHORE_FROM_ISR(binary) (binary = true)
 #else
 #define DEBUG_CONSOLE_TAKE_BINARY_SEMAPHORE_BLOCKING(binary)
@@ -204,6 +215,11 @@ typedef struct _debug_console_state_struct
 static debug_console_state_struct_t s_debugConsoleState;
 serial_handle_t g_serialHandle; /*!< serial manager handle */
 
+#if (defined(DEBUG_CONSOLE_IDLE_VETO_ENABLE) && (DEBUG_CONSOLE_IDLE_VETO_ENABLE > 0U))
+/*! @brief Deep sleep veto of the idle module. */
+static idle_veto_handle_t s_debugConsoleIdleVeto;
+#endif
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -315,6 +331,37 @@ static void DbgConsole_SerialManagerRxCallback(void *callbackParam,
 
 #endif
 
+#if (defined(DEBUG_CONSOLE_RX_ENABLE) && (DEBUG_CONSOLE_RX_ENABLE > 0U)) &&                           \
+    (defined(DEBUG_CONSOLE_RX_LOW_POWER) && (DEBUG_CONSOLE_RX_LOW_POWER > 0U)) &&                     \
+    (DEBUG_CONSOLE_SYNCHRONIZATION_MODE == DEBUG_CONSOLE_SYNCHRONIZATION_BM) && !defined(OSA_USED) && \
+    defined(DEBUG_CONSOLE_TRANSFER_NON_BLOCKING)
+static void DbgConsole_WaitLowpower(volatile uint8_t *flag)
+{
+    uint32_t regPrimask;
+
+    while (0U == *flag)
+    {
+        /* The flag is checked again with the interrupt disabled, so that a character received just before is not
+         * missed. A pending interrupt still wakes up the MCU, and is served once the interrupt is enabled. */
+        regPrimask = DisableGlobalIRQ();
+        if (0U == *flag)
+        {
+            if ((status_t)kStatus_Success == DbgConsole_EnterLowpower())
+            {
+                DbgConsole_LowPowerIdle();
+                (void)DbgConsole_ExitLowpower();
+            }
+            else
+            {
+                /* The transmission is ongoing, the USART needs the system clock. */
+                __WFI();
+            }
+        }
+        EnableGlobalIRQ(regPrimask);
+    }
+}
+#endif
+
 status_t DbgConsole_ReadOneCharacter(uint8_t *ch)
 {
 #if (defined(DEBUG_CONSOLE_RX_ENABLE) && (DEBUG_CONSOLE_RX_ENABLE > 0U))
@@ -623,6 +670,22 @@ static void DbgConsole_PrintCallback(char *buf, int32_t *indicator, char dbgVal,
 
 /*************Code for DbgConsole Init, Deinit, Printf, Scanf *******************************/
 
+#if (defined(DEBUG_CONSOLE_IDLE_VETO_ENABLE) && (DEBUG_CONSOLE_IDLE_VETO_ENABLE > 0U))
+/* The serial manager refuses the low power mode while writes are pending, the deep sleep is then vetoed. */
+static bool DbgConsole_IdleVeto(idle_veto_handle_t *handle, idle_event_t event)
+{
+    (void)handle;
+
+    if (kIDLE_EventDeepSleepEnter == event)
+    {
+        return ((status_t)kStatus_Success == DbgConsole_EnterLowpower());
+    }
+    (void)DbgConsole_ExitLowpower();
+
+    return true;
+}
+#endif
+
 /* See fsl_debug_console.h for documentation of this function. */
 status_t DbgConsole_Init(uint8_t instance, uint32_t baudRate, serial_port_type_t device, uint32_t clkSrcFreq)
 {
@@ -638,6 +701,8 @@ status_t DbgConsole_Init(uint8_t instance, uint32_t baudRate, serial_port_type_t
         .stopBitCount = kSerialManager_UartOneStopBit,
         .enableRx     = 1,
         .enableTx     = 1,
+        .enableRxRTS  = DEBUG_CONSOLE_UART_FLOW_CONTROL_ENABLE,
+        .enableTxCTS  = DEBUG_CONSOLE_UART_FLOW_CONTROL_ENABLE,
     };
 #endif
 
@@ -744,12 +809,20 @@ status_t DbgConsole_Init(uint8_t instance, uint32_t baudRate, serial_port_type_t
 
     g_serialHandle = s_debugConsoleState.serialHandle;
 
+#if (defined(DEBUG_CONSOLE_IDLE_VETO_ENABLE) && (DEBUG_CONSOLE_IDLE_VETO_ENABLE > 0U))
+    s_debugConsoleIdleVeto.callback = DbgConsole_IdleVeto;
+    IDLE_RegisterVeto(&s_debugConsoleIdleVeto);
+#endif
+
     return kStatus_Success;
 }
 
 /* See fsl_debug_console.h for documentation of this function. */
 status_t DbgConsole_Deinit(void)
 {
+#if (defined(DEBUG_CONSOLE_IDLE_VETO_ENABLE) && (DEBUG_CONSOLE_IDLE_VETO_ENABLE > 0U))
+    IDLE_UnregisterVeto(&s_debugConsoleIdleVeto);
+#endif
     {
         if (s_debugConsoleState.serialHandle != NULL)
         {
@@ -776,6 +849,34 @@ status_t DbgConsole_Deinit(void)
     return (status_t)kStatus_Success;
 }
 
+/* See fsl_debug_console.h for documentation of this function. */
+status_t DbgConsole_EnterLowpower(void)
+{
+    if ((NULL == s_debugConsoleState.serialHandle) ||
+        (kStatus_SerialManager_Success != SerialManager_EnterLowpower(s_debugConsoleState.serialHandle)))
+    {
+        return (status_t)kStatus_Fail;
+    }
+    return (status_t)kStatus_Success;
+}
+
+/* See fsl_debug_console.h for documentation of this function. */
+status_t DbgConsole_ExitLowpower(void)
+{
+    if ((NULL == s_debugConsoleState.serialHandle) ||
+        (kStatus_SerialManager_Success != SerialManager_ExitLowpower(s_debugConsoleState.serialHandle)))
+    {
+        return (status_t)kStatus_Fail;
+    }
+    return (status_t)kStatus_Success;
+}
+
+/* See fsl_debug_console.h for documentation of this function. */
+__attribute__((weak)) void DbgConsole_LowPowerIdle(void)
+{
+    __WFI();
+}
+
 #if ((SDK_DEBUGCONSOLE > 0U) ||                                                   \
      ((SDK_DEBUGCONSOLE == 0U) && defined(DEBUG_CONSOLE_TRANSFER_NON_BLOCKING) && \
       (defined(DEBUG_CONSOLE_TX_RELIABLE_ENABLE) && (DEBUG_CONSOLE_TX_RELIABLE_ENABLE > 0U))))
@@ -130,6 +130,37 @@ status_t DbgConsole_Init(uint8_t instance, uint32_t baudRate, serial_port_type_t
  */
 status_t DbgConsole_Deinit(void);
 
+/*!
+ * @brief Prepares the peripheral used for debug messages for deep sleep.
+ *
+ * Call this function with the global interrupt disabled, just before entering deep sleep. When it succeeds, the
+ * start bit of the next received character wakes up the MCU, and the character is not lost.
+ * DbgConsole_ExitLowpower should be called after waking up.
+ *
+ * @return Indicates whether the debug console is ready for deep sleep or not.
+ * @retval kStatus_Success The debug console is ready for deep sleep.
+ * @retval kStatus_Fail The transmission is not finished or the peripheral does not support the wake up, the MCU
+ * should only enter sleep mode.
+ */
+status_t DbgConsole_EnterLowpower(void);
+
+/*!
+ * @brief Restores the peripheral used for debug messages after deep sleep.
+ *
+ * @return Indicates whether the restore was successful or not.
+ */
+status_t DbgConsole_ExitLowpower(void);
+
+/*!
+ * @brief Low power idle hook of the debug console.
+ *
+ * When DEBUG_CONSOLE_RX_LOW_POWER is enabled, the debug console calls this function while it waits for received
+ * characters, with the global interrupt disabled and the peripheral already prepared by DbgConsole_EnterLowpower.
+ * The default implementation is a weak function entering sleep mode, the application could override it to enter
+ * deep sleep instead.
+ */
+void DbgConsole_LowPowerIdle(void);
+
 #if SDK_DEBUGCONSOLE
 /*!
  * @brief Writes formatted output to the standard output stream.
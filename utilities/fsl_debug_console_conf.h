@@ -69,6 +69,33 @@
 #define DEBUG_CONSOLE_RX_ENABLE (1U)
 #endif /* DEBUG_CONSOLE_RX_ENABLE */
 
+/*!@ brief Whether enable the hardware RTS/CTS flow control of the UART debug console
+ * If the macro is zero, the flow control of the debug console is disabled.
+ * When it is enabled, the RTS and CTS pins of the debug UART should be routed in the pin mux configuration. The
+ * transmitter is gated by CTS, and in non-blocking mode RTS follows the fill level of the receive buffer.
+ */
+#ifndef DEBUG_CONSOLE_UART_FLOW_CONTROL_ENABLE
+#define DEBUG_CONSOLE_UART_FLOW_CONTROL_ENABLE (0U)
+#endif /* DEBUG_CONSOLE_UART_FLOW_CONTROL_ENABLE */
+
+/*!@ brief Whether the debug console waits for received characters in low power mode
+ * If the macro is non-zero, the bare metal non-blocking debug console calls DbgConsole_LowPowerIdle instead of
+ * polling while it waits for received characters, and the start bit of the next character wakes up the MCU.
+ */
+#ifndef DEBUG_CONSOLE_RX_LOW_POWER
+#define DEBUG_CONSOLE_RX_LOW_POWER (0U)
+#endif /* DEBUG_CONSOLE_RX_LOW_POWER */
+
+/*!@ brief Whether the debug console vetoes the deep sleep of the idle module
+ * If the macro is non-zero, the debug console registers a veto of the idle module, the deep sleep is then only
+ * entered once the pending writes are sent, with the start bit of a received character as a wake-up source. The
+ * application then links component/idle and runs it with IDLE_Init and IDLE_Enter. The low power mode of the serial
+ * manager needs the non-blocking mode.
+ */
+#ifndef DEBUG_CONSOLE_IDLE_VETO_ENABLE
+#define DEBUG_CONSOLE_IDLE_VETO_ENABLE (0U)
+#endif /* DEBUG_CONSOLE_IDLE_VETO_ENABLE */
+
 /*!@ brief define the MAX log length debug console support , that is when you call printf("log", x);, the log
  * length can not bigger than this value.
  * This macro decide the local log buffer length, the buffer locate at stack, the stack maybe overflow if